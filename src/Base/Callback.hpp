@@ -34,6 +34,7 @@ using RefinerCallback =
     , tag::compatibility,  CkCallback
     , tag::bndint,         CkCallback
     , tag::matched,        CkCallback
+    , tag::imbalance,      CkCallback
     , tag::refined,        CkCallback
   > >;
 
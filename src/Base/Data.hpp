@@ -118,7 +118,7 @@ class Data {
     //!   equations among other systems
     //! \return Pointer to data of type tk::real for use with var()
     //! \see Example client code in Statistics::setupOrdinary() and
-    //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
+    //!   Statistics::accumulate() in Statistics/Statistics.cpp.
     const tk::real*
     cptr( ncomp_t component, ncomp_t offset ) const
     { return cptr( component, offset, int2type< Layout >() ); }
@@ -144,7 +144,7 @@ class Data {
     //! \param[in] unknown Unknown index
     //! \return Const reference to data of type tk::real
     //! \see Example client code in Statistics::setupOrdinary() and
-    //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
+    //!   Statistics::accumulate() in Statistics/Statistics.cpp.
     const tk::real&
     var( const tk::real* pt, ncomp_t unknown ) const
     { return var( pt, unknown, int2type< Layout >() ); }
@@ -170,7 +170,7 @@ class Data {
     //! \param[in] unknown Unknown index
     //! \return Non-const reference to data of type tk::real
     //! \see Example client code in Statistics::setupOrdinary() and
-    //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
+    //!   Statistics::accumulate() in Statistics/Statistics.cpp.
     //! \see "Avoid Duplication in const and Non-const Member Function," and
     //!   "Use const whenever possible," Scott Meyers, Effective C++, 3d ed.
     tk::real&
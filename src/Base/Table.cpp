@@ -12,18 +12,91 @@
 */
 // *****************************************************************************
 
-#include <utility>
-#include <stddef.h>
+#include <cmath>
+#include <algorithm>
 
 #include "Table.hpp"
 #include "Exception.hpp"
 
+using tk::Table;
+
+Table::Table( std::initializer_list< std::pair< tk::real, tk::real > > xy ) :
+  m_x(),
+  m_y(),
+  m_uniform( false ),
+  m_idx( 0.0 ),
+  m_last( 0 )
+// *****************************************************************************
+//  Constructor from a list of (x,y) pairs
+//! \param[in] xy List of (x,y) pairs, x assumed to be in increasing order
+//! \details Some tables, e.g., those concatenated from restarted runs, step
+//!   back in x. Pairs whose x is lower than the largest x so far are skipped,
+//!   so that, as with a linear scan, the first interval containing a sample
+//!   point is used. Repeated x values are kept: they delimit zero-length
+//!   intervals that are never sampled, so the interval following a repeated x
+//!   starts from its last y. The abscissa values are considered uniformly
+//!   spaced if all intervals agree with the average interval to within a
+//!   relative tolerance close to machine precision.
+// *****************************************************************************
+{
+  m_x.reserve( xy.size() );
+  m_y.reserve( xy.size() );
+  for (const auto& p : xy) {
+    if (!m_x.empty() && p.first < m_x.back()) continue;
+    m_x.push_back( p.first );
+    m_y.push_back( p.second );
+  }
+
+  if (m_x.size() > 2) {
+    auto dx = (m_x.back() - m_x.front()) / static_cast<tk::real>(m_x.size()-1);
+    m_uniform = true;
+    for (std::size_t i=0; i<m_x.size()-1; ++i)
+      if (std::abs( m_x[i+1] - m_x[i] - dx ) > 1.0e-12 * dx) {
+        m_uniform = false;
+        break;
+      }
+    if (m_uniform) m_idx = 1.0 / dx;
+  }
+}
+
+std::size_t
+Table::interval( tk::real x, std::size_t guess ) const
+// *****************************************************************************
+//  Find interval containing x given a starting guess
+//! \param[in] x Value of abscissa, m_x.front() <= x < m_x.back()
+//! \param[in] guess Lower index of interval to check first
+//! \return Lower index, i, of interval such that m_x[i] <= x < m_x[i+1],
+//!   which is never a zero-length interval at a repeated x
+//! \details For uniformly spaced abscissa values the guess is ignored and the
+//!   interval is computed directly and only corrected for roundoff. Otherwise
+//!   the interval given by the guess and the one following it are checked
+//!   before falling back to binary search.
+// *****************************************************************************
+{
+  const auto n = m_x.size();
+
+  if (m_uniform) {
+    auto i = static_cast< std::size_t >( (x - m_x[0]) * m_idx );
+    i = std::min( i, n-2 );
+    if (x < m_x[i]) --i;
+    else if (i+2 < n && m_x[i+1] <= x) ++i;
+    return i;
+  }
+
+  if (guess+1 < n && m_x[guess] <= x) {
+    if (x < m_x[guess+1]) return guess;
+    if (guess+2 < n && x < m_x[guess+2]) return guess+1;
+  }
+
+  auto u = std::upper_bound( begin(m_x), end(m_x), x );
+  return static_cast< std::size_t >( u - begin(m_x) ) - 1;
+}
+
 tk::real
-tk::sample( tk::real x, const tk::Table& table )
+Table::sample( tk::real x ) const
 // *****************************************************************************
-//  Sample a discrete y = f(x) function at x
+//  Sample the function at x
 //! \param[in] x Value of abscissa at which to sample y = f(x)
-//! \param[in] table tk::Table to sample
 //! \details If x is lower than the first x value in the function table, the
 //!   first function value is returned. If x is larger than the last x value in
 //!   the function table, the last function value is returned. In other words,
@@ -32,23 +105,56 @@ tk::sample( tk::real x, const tk::Table& table )
 //!   sample between the two closest x values of the table around the abscissa
 //!   given.
 //! \return Sampled value from discrete table
-//! \note The x column in the table is assumed to be in increasing order.
-//! \see walker::invhts_eq_A005H, walker::prod_A005H for example tables
 // *****************************************************************************
 {
-  Assert( !table.empty(), "Empty table to sample from" );
+  Assert( !empty(), "Empty table to sample from" );
+
+  if (x < m_x.front()) return m_y.front();
+  if (x >= m_x.back()) return m_y.back();
+
+  auto i = interval( x, m_last.load( std::memory_order_relaxed ) );
+  m_last.store( i, std::memory_order_relaxed );
+  return interpolate( i, x );
+}
 
-  if (x < table.front().first) return table.front().second;
+void
+Table::sample( std::size_t n, const tk::real* x, tk::real* y ) const
+// *****************************************************************************
+//  Sample the function at an array of abscissa values
+//! \param[in] n Number of abscissa values
+//! \param[in] x Array of n abscissa values at which to sample y = f(x)
+//! \param[in,out] y Array of n sampled values
+//! \details Same as sampling at each x separately, but the interval found for
+//!   an abscissa value is used as the first guess for the next one, which
+//!   makes sampling at sorted or clustered abscissa values cheap.
+// *****************************************************************************
+{
+  Assert( !empty(), "Empty table to sample from" );
 
-  for (std::size_t i=0; i<table.size()-1; ++i) {
-    if (table[i].first < x && x < table[i+1].first) {
-      auto t1 = table[i].first;
-      auto y1 = table[i].second;
-      auto t2 = table[i+1].first;
-      auto y2 = table[i+1].second;
-      return y1 + (y2-y1)/(t2-t1)*(x-t1);
+  auto i = m_last.load( std::memory_order_relaxed );
+  for (std::size_t j=0; j<n; ++j) {
+    if (x[j] < m_x.front())
+      y[j] = m_y.front();
+    else if (x[j] >= m_x.back())
+      y[j] = m_y.back();
+    else {
+      i = interval( x[j], i );
+      y[j] = interpolate( i, x[j] );
     }
   }
+  m_last.store( i, std::memory_order_relaxed );
+}
 
-  return table.back().second;
+tk::real
+tk::sample( tk::real x, const tk::Table& table )
+// *****************************************************************************
+//  Sample a discrete y = f(x) function at x
+//! \param[in] x Value of abscissa at which to sample y = f(x)
+//! \param[in] table tk::Table to sample
+//! \return Sampled value from discrete table
+//! \see tk::Table::sample()
+//! \see walker::invhts_eq_A005H, walker::prod_A005H for example tables
+// *****************************************************************************
+{
+  return table.sample( x );
 }
@@ -8,7 +8,12 @@
   \brief     Basic functionality for storing and sampling a discrete y = f(x)
              function
   \details   Basic functionality for storing and sampling a discrete y = f(x)
-             function.
+             function. The abscissa and ordinate values are stored in
+             separate arrays. If the abscissa values are uniformly spaced, the
+             interval containing a sample point is computed directly,
+             otherwise it is found by binary search, preceded by checking the
+             interval found by the previous lookup, which is the common case
+             when a table is sampled at monotonically advancing time.
 */
 // *****************************************************************************
 #ifndef Table_h
@@ -16,13 +21,83 @@
 
 #include <vector>
 #include <utility>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
 
 #include "Types.hpp"
 
 namespace tk {
 
-//! Type alias for declaring, defining, and storing a discrete y = f(x) function
-using Table = std::vector< std::pair< tk::real, tk::real > >;
+//! Class for declaring, defining, and storing a discrete y = f(x) function
+class Table {
+
+  public:
+    //! Default constructor: empty table
+    Table() : m_x(), m_y(), m_uniform( false ), m_idx( 0.0 ),
+      m_last( 0 ) {}
+
+    //! Constructor from a list of (x,y) pairs
+    Table( std::initializer_list< std::pair< tk::real, tk::real > > xy );
+
+    //! Copy constructor: copy the table, restart the cached interval
+    Table( const Table& t ) : m_x( t.m_x ), m_y( t.m_y ),
+      m_uniform( t.m_uniform ), m_idx( t.m_idx ), m_last( 0 ) {}
+
+    //! Copy assignment: copy the table, restart the cached interval
+    Table& operator=( const Table& t ) {
+      m_x = t.m_x;
+      m_y = t.m_y;
+      m_uniform = t.m_uniform;
+      m_idx = t.m_idx;
+      m_last.store( 0, std::memory_order_relaxed );
+      return *this;
+    }
+
+    //! Sample the function at x
+    tk::real sample( tk::real x ) const;
+
+    //! Sample the function at an array of abscissa values
+    void sample( std::size_t n, const tk::real* x, tk::real* y ) const;
+
+    //! Query number of (x,y) pairs in table
+    //! \return Number of (x,y) pairs in table
+    std::size_t size() const noexcept { return m_x.size(); }
+
+    //! Query if the table is empty
+    //! \return True if there are no (x,y) pairs in the table
+    bool empty() const noexcept { return m_x.empty(); }
+
+    //! Query if the abscissa values are uniformly spaced
+    //! \return True if the abscissa values are uniformly spaced
+    bool uniform() const noexcept { return m_uniform; }
+
+  private:
+    std::vector< tk::real > m_x;        //!< Abscissa values, non-decreasing
+    std::vector< tk::real > m_y;        //!< Ordinate values
+    bool m_uniform;                     //!< True if x is uniformly spaced
+    tk::real m_idx;                     //!< Inverse spacing if m_uniform
+    //! \brief Lower index of interval found by the last lookup
+    //! \details Mutable so that sampling remains a const operation, atomic
+    //!   since a table may be sampled concurrently by multiple threads. Its
+    //!   value is only a hint, so relaxed memory ordering suffices.
+    mutable std::atomic< std::size_t > m_last;
+
+    //! Find interval containing x given a starting guess
+    std::size_t interval( tk::real x, std::size_t guess ) const;
+
+    //! Interpolate linearly in interval given
+    //! \param[in] i Lower index of interval
+    //! \param[in] x Value of abscissa at which to interpolate
+    //! \return Interpolated value
+    tk::real interpolate( std::size_t i, tk::real x ) const {
+      auto t1 = m_x[i];
+      auto y1 = m_y[i];
+      auto t2 = m_x[i+1];
+      auto y2 = m_y[i+1];
+      return y1 + (y2-y1)/(t2-t1)*(x-t1);
+    }
+};
 
 //! Sample a discrete y = f(x) function at x
 tk::real sample( tk::real x, const tk::Table& table );
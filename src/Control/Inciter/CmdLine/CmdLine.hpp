@@ -33,6 +33,7 @@ using CmdLineMembers = brigand::list<
   , tag::verbose,        bool
   , tag::chare,          bool
   , tag::nonblocking,    bool
+  , tag::memckpt,        bool
   , tag::benchmark,      bool
   , tag::feedback,       bool
   , tag::help,           bool
@@ -47,6 +48,7 @@ using CmdLineMembers = brigand::list<
   , tag::error,          std::vector< std::string >
   , tag::lbfreq,         kw::lbfreq::info::expect::type
   , tag::rsfreq,         kw::rsfreq::info::expect::type
+  , tag::diskfreq,       kw::diskfreq::info::expect::type
 >;
 
 //! \brief CmdLine : Control< specialized to Inciter >
@@ -61,6 +63,7 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
     using keywords = tk::cmd_keywords< kw::verbose
                                      , kw::charestate
                                      , kw::nonblocking
+                                     , kw::memckpt
                                      , kw::benchmark
                                      , kw::feedback
                                      , kw::virtualization
@@ -76,6 +79,7 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
                                      , kw::quiescence
                                      , kw::lbfreq
                                      , kw::rsfreq
+                                     , kw::diskfreq
                                      , kw::trace
                                      , kw::version
                                      , kw::license
@@ -126,14 +130,19 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
       get< tag::io, tag::diag >() = "diag";
       get< tag::io, tag::particles >() = "track.h5part";
       get< tag::io, tag::restart >() = "restart";
+      get< tag::io, tag::aggregate >() = false;
+      get< tag::io, tag::inflight >() = 0;
+      get< tag::io, tag::compress >() = 0;
       get< tag::virtualization >() = 0.0;
       get< tag::verbose >() = false; // Quiet output by default
       get< tag::chare >() = false; // No chare state output by default
       get< tag::nonblocking>() = false; // Blocking migration by default
+      get< tag::memckpt >() = false; // Checkpoint to disk by default
       get< tag::benchmark >() = false; // No benchmark mode by default
       get< tag::feedback >() = false; // No detailed feedback by default
       get< tag::lbfreq >() = 1; // Load balancing every time-step by default
       get< tag::rsfreq >() = 1000;// Chkpt/restart after this many time steps
+      get< tag::diskfreq >() = 10; // Write every 10th in-memory chkpt to disk
       get< tag::trace >() = true; // Output call and stack trace by default
       get< tag::version >() = false; // Do not display version info by default
       get< tag::license >() = false; // Do not display license info by default
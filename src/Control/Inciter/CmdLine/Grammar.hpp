@@ -44,6 +44,11 @@ namespace cmd {
          tk::grm::process_cmd_switch< use, kw::nonblocking,
                                       tag::nonblocking > {};
 
+  //! Match switch on in-memory checkpointing
+  struct memckpt :
+         tk::grm::process_cmd_switch< use, kw::memckpt,
+                                      tag::memckpt > {};
+
 
   //! Match and set benchmark switch (i.e., benchmark mode)
   struct benchmark :
@@ -107,6 +112,13 @@ namespace cmd {
                                tk::grm::number,
                                tag::rsfreq > {};
 
+  //! Match and set frequency of writing in-memory checkpoints to disk
+  struct diskfreq :
+         tk::grm::process_cmd< use, kw::diskfreq,
+                               tk::grm::Store< tag::diskfreq >,
+                               tk::grm::number,
+                               tag::diskfreq > {};
+
   //! Match switch on trace output
   struct trace :
          tk::grm::process_cmd_switch< use, kw::trace,
@@ -127,6 +139,7 @@ namespace cmd {
          pegtl::sor< verbose,
                      charestate,
                      nonblocking,
+                     memckpt,
                      benchmark,
                      feedback,
                      virtualization,
@@ -136,6 +149,7 @@ namespace cmd {
                      quiescence,
                      lbfreq,
                      rsfreq,
+                     diskfreq,
                      trace,
                      version,
                      license,
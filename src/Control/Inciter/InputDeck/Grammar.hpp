@@ -669,7 +669,9 @@ namespace deck {
            tk::grm::interval< use< kw::ttyi >, tag::tty >,
            discroption< use, kw::scheme, inciter::ctr::Scheme, tag::scheme >,
            discroption< use, kw::limiter, inciter::ctr::Limiter, tag::limiter >,
-           tk::grm::discrparam< use, kw::cweight, tag::cweight >
+           tk::grm::discrparam< use, kw::cweight, tag::cweight >,
+           tk::grm::discrparam< use, kw::shock_detector_coeff,
+                                tag::shock_detector_coeff >
          > {};
 
   //! PDE parameter vector
@@ -1067,6 +1069,17 @@ namespace deck {
                                              pegtl::digit,
                                              tag::amr,
                                              tag::tolderef >,
+                           tk::grm::control< use< kw::amr_imbalance >,
+                                             pegtl::digit,
+                                             tag::amr,
+                                             tag::imbalance >,
+                           tk::grm::process< use< kw::amr_rebalance >,
+                             tk::grm::Store< tag::amr, tag::rebalance >,
+                             pegtl::alpha >,
+                           tk::grm::control< use< kw::amr_maxrebal >,
+                                             pegtl::digit,
+                                             tag::amr,
+                                             tag::maxrebal >,
                            tk::grm::process< use< kw::amr_t0ref >,
                              tk::grm::Store< tag::amr, tag::t0ref >,
                              pegtl::alpha >,
@@ -1095,6 +1108,10 @@ namespace deck {
                                              pegtl::digit,
                                              tag::pref,
                                              tag::ndofmax >,
+                           tk::grm::control< use< kw::pref_lbtol >,
+                                             pegtl::digit,
+                                             tag::pref,
+                                             tag::lbtol >,
                            tk::grm::process<
                              use< kw::pref_indicator >,
                              tk::grm::store_inciter_option<
@@ -1117,6 +1134,19 @@ namespace deck {
                                  tag::filetype >,
                                pegtl::alpha >,
              tk::grm::interval< use< kw::interval >, tag::field >,
+             tk::grm::process< use< kw::aggregate >,
+                               tk::grm::Store< tag::cmd, tag::io,
+                                               tag::aggregate >,
+                               pegtl::alpha >,
+             tk::grm::control< use< kw::inflight >, pegtl::digit,
+                               tag::cmd, tag::io, tag::inflight >,
+             tk::grm::control< use< kw::compress >, pegtl::digit,
+                               tag::cmd, tag::io, tag::compress >,
+             pegtl::if_must<
+               tk::grm::vector<
+                 kw::errbound,
+                 tk::grm::Store_back< tag::cmd, tag::io, tag::errbound >,
+                 use< kw::end > > >,
              pegtl::if_must<
                tk::grm::vector<
                  kw::sideset,
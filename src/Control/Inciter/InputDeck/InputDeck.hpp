@@ -68,6 +68,10 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::slot_cyl,
                                    kw::problem,
                                    kw::plotvar,
+                                   kw::aggregate,
+                                   kw::inflight,
+                                   kw::compress,
+                                   kw::errbound,
                                    kw::interval,
                                    kw::partitioning,
                                    kw::algorithm,
@@ -168,6 +172,9 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::amr_refvar,
                                    kw::amr_tolref,
                                    kw::amr_tolderef,
+                                   kw::amr_rebalance,
+                                   kw::amr_imbalance,
+                                   kw::amr_maxrebal,
                                    kw::amr_edgelist,
                                    kw::amr_coordref,
                                    kw::amr_xminus,
@@ -182,6 +189,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::pref_non_conformity,
                                    kw::pref_ndofmax,
                                    kw::pref_tolref,
+                                   kw::pref_lbtol,
                                    kw::scheme,
                                    kw::diagcg,
                                    kw::alecg,
@@ -198,6 +206,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::hll,
                                    kw::limiter,
                                    kw::cweight,
+                                   kw::shock_detector_coeff,
                                    kw::nolimiter,
                                    kw::wenop1,
                                    kw::superbeep1,
@@ -256,6 +265,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::discr, tag::ndof >() = 1;
       get< tag::discr, tag::limiter >() = LimiterType::NOLIMITER;
       get< tag::discr, tag::cweight >() = 1.0;
+      get< tag::discr, tag::shock_detector_coeff >() = 0.0;
       get< tag::discr, tag::ndof >() = 1;
       get< tag::discr, tag::rdof >() = 1;
       // Default field output file type
@@ -269,6 +279,9 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::amr, tag::error >() = AMRErrorType::JUMP;
       get< tag::amr, tag::tolref >() = 0.2;
       get< tag::amr, tag::tolderef >() = 0.05;
+      get< tag::amr, tag::rebalance >() = false;
+      get< tag::amr, tag::imbalance >() = 1.5;
+      get< tag::amr, tag::maxrebal >() = 10;
       auto rmax =
         std::numeric_limits< kw::amr_xminus::info::expect::type >::max() / 100;
       get< tag::amr, tag::xminus >() = rmax;
@@ -282,6 +295,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::pref, tag::indicator >() = PrefIndicatorType::SPECTRAL_DECAY;
       get< tag::pref, tag::ndofmax >() = 10;
       get< tag::pref, tag::tolref >() = 0.5;
+      get< tag::pref, tag::lbtol >() = 0.1;
       // Default txt floating-point output precision in digits
       get< tag::prec, tag::diag >() = std::cout.precision();
       get< tag::prec, tag::history >() = std::cout.precision();
@@ -57,6 +57,9 @@ using amr = tk::TaggedTuple< brigand::list<
   , tag::error,   AMRErrorType                    //!< Error estimator for AMR
   , tag::tolref,  tk::real                        //!< Refine tolerance
   , tag::tolderef, tk::real                       //!< De-refine tolerance
+  , tag::rebalance, bool                          //!< Rebalance after t0ref
+  , tag::imbalance, tk::real                      //!< Load imbalance threshold
+  , tag::maxrebal, kw::amr_maxrebal::info::expect::type //!< Max rebal rounds
   //! List of edges-node pairs
   , tag::edge,    std::vector< kw::amr_edgelist::info::expect::type >
   //! Refinement tagging edges with end-point coordinates lower than x coord
@@ -79,6 +82,7 @@ using pref = tk::TaggedTuple< brigand::list<
   , tag::indicator,   PrefIndicatorType   //!< Choice of adaptive indicator
   , tag::ndofmax,     std::size_t         //!< Max number of degree of freedom
   , tag::tolref,      tk::real            //!< Threshold of p-refinement
+  , tag::lbtol,       tk::real            //!< Load imbalance tolerance
 > >;
 
 //! Discretization parameters storage
@@ -97,6 +101,8 @@ using discretization = tk::TaggedTuple< brigand::list<
   , tag::scheme, inciter::ctr::SchemeType       //!< Spatial discretization type
   , tag::limiter,inciter::ctr::LimiterType      //!< Limiter type
   , tag::cweight,kw::cweight::info::expect::type//!< WENO central stencil weight
+  , tag::shock_detector_coeff,                  //!< Troubled-cell threshold
+      kw::shock_detector_coeff::info::expect::type
   , tag::rdof,   std::size_t          //!< Number of reconstructed solution DOFs
   , tag::ndof,   std::size_t                   //!< Number of solution DOFs
 > >;
@@ -137,6 +143,14 @@ using ios = tk::TaggedTuple< brigand::list<
   , tag::screen,    kw::screen::info::expect::type  //!< Screen output filename
     //! List of side sets to save as field output
   , tag::surface,   std::vector< kw::sideset::info::expect::type >
+    //! True to aggregate field output per compute node
+  , tag::aggregate, bool
+    //! Max number of field outputs in flight per chare
+  , tag::inflight,  kw::inflight::info::expect::type
+    //! Lossless compression level of field output
+  , tag::compress,  kw::compress::info::expect::type
+    //! Absolute error bounds for lossy field output per variable
+  , tag::errbound,  std::vector< kw::errbound::info::expect::type >
     //! Diagnostics filename
   , tag::diag,      kw::diagnostics_cmd::info::expect::type
   , tag::particles, std::string                     //!< Particles filename
@@ -1001,6 +1001,95 @@ struct filetype_info {
 };
 using filetype = keyword< filetype_info, TAOCPP_PEGTL_STRING("filetype") >;
 
+struct aggregate_info {
+  static std::string name() { return "Aggregate field output"; }
+  static std::string shortDescription() { return
+    "Write field output of all chares on a compute node into a single file"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to request that the mesh
+    chunks and field data of all chares (work units) residing on a compute node
+    are merged and written into a single ExodusII file, instead of writing a
+    separate file per chare. This reduces the number of files, and thus the
+    load on the parallel file system, by the degree of overdecomposition. Each
+    chare's chunk is written as a separate element block, and the side sets
+    and surface output of all chares are merged as well. This option is
+    ignored for ROOT output.
+    Example: "aggregate true".)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using aggregate = keyword< aggregate_info, TAOCPP_PEGTL_STRING("aggregate") >;
+
+struct inflight_info {
+  static std::string name() { return "Number of in-flight field outputs"; }
+  static std::string shortDescription() { return
+    "Set the number of field outputs allowed to overlap with time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to set the maximum number
+    of field output dumps per chare (work unit) that may be in flight, i.e.,
+    handed to the mesh writer but not yet written to file, while time stepping
+    continues. The default, zero, waits for each field output to be written
+    before continuing. Outputs that also write the mesh, the last output, and
+    outputs followed by a checkpoint are always waited for, and load balancing
+    waits for all outputs in flight before migrating work units. This option
+    has no effect with aggregated field output or nonblocking migration.
+    Example: "inflight 2".)"; }
+  struct expect {
+    using type = std::size_t;
+    static std::string description() { return "uint"; }
+  };
+};
+using inflight = keyword< inflight_info, TAOCPP_PEGTL_STRING("inflight") >;
+
+struct compress_info {
+  static std::string name() { return "Field output compression level"; }
+  static std::string shortDescription() { return
+    "Set the lossless compression level of field output"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to set the level of
+    lossless (deflate) compression of ExodusII field output files, 1 being the
+    fastest and 9 the strongest compression. If set, the files are written in
+    the HDF5-based NetCDF-4 format. The default, 0, writes uncompressed files.
+    Example: "compress 4".)"; }
+  struct expect {
+    using type = int;
+    static constexpr type lower = 0;
+    static constexpr type upper = 9;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+        std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using compress = keyword< compress_info, TAOCPP_PEGTL_STRING("compress") >;
+
+struct errbound_info {
+  static std::string name() { return "Field output error bounds"; }
+  static std::string shortDescription() { return
+    "Set absolute error bounds for lossy field output"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to configure lossy field
+    output with an absolute error bound for each output variable. The list of
+    real numbers, closed by an 'end', is assigned to the output variables in the
+    order they appear in the field output file, element variables first, node
+    variables next. If fewer bounds than variables are given, the last bound is
+    used for the remaining variables. A bound of zero leaves a variable
+    unchanged. The trailing bits of the floating-point numbers not needed to
+    satisfy the bound are zeroed, which makes the data compress better; this
+    is thus best combined with the 'compress' keyword. Example:
+    "errbound 1.0e-8 1.0e-5 end".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "reals"; }
+  };
+};
+using errbound = keyword< errbound_info, TAOCPP_PEGTL_STRING("errbound") >;
+
 struct overwrite_info {
   static std::string name() { return "overwrite"; }
   static std::string shortDescription() { return
@@ -1701,6 +1790,55 @@ struct term_info {
 };
 using term = keyword< term_info, TAOCPP_PEGTL_STRING("term") >;
 
+struct lagtol_info {
+  static std::string name() { return "lagtol"; }
+  static std::string shortDescription() { return
+    "Set tolerance for advancing particles with lagged statistics"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to enable pipelined time stepping in walker with
+    statistical moments lagged by one time step, and to specify the tolerance
+    on the change of the moments between subsequent time steps that allows it.
+    If the maximum relative change of the moments in a time step does not
+    exceed the tolerance, the particles are advanced in the next time step
+    using the moments of the previous time step, while the moments of the
+    current time step are still being estimated. This hides the latency of the
+    global reduction of the statistics, but the moments used by the
+    differential equations are one time step old. The relative change of the
+    moments is reported in the statistics output file. Time steps at which
+    central PDFs are estimated are never pipelined. The default, zero,
+    disables pipelining.)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using lagtol = keyword< lagtol_info, TAOCPP_PEGTL_STRING("lagtol") >;
+
+struct particle_rng_info {
+  static std::string name() { return "particle_rng"; }
+  static std::string shortDescription() { return
+    "Draw random numbers from per-particle streams"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in walker as a keyword in the walker...end block
+    as "particle_rng true" (or false) to draw the random numbers of each
+    particle from a counter-based random number stream derived from the global
+    particle id, the time step, and the equation, instead of from a stream per
+    processing element. The particle properties then do not depend on the
+    number of processing elements, the virtualization, or load balancing,
+    provided the actual number of particles, reported under load distribution,
+    is the same. Statistics are then only affected by the order of summation.
+    Requires all random number generators selected to be Random123 generators.
+    The default is false.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using particle_rng =
+  keyword< particle_rng_info, TAOCPP_PEGTL_STRING("particle_rng") >;
+
 struct t0_info {
   static std::string name() { return "t0"; }
   static std::string shortDescription() { return
@@ -3824,9 +3962,11 @@ struct benchmark_info {
   static std::string name() { return "benchmark"; }
   static std::string shortDescription() { return "Select benchmark mode"; }
   static std::string longDescription() { return
-    R"(This keyword is used to select benchmark mode. In benchmark mode no large
-       file output is performed, overriding the configuration in the control
-       file.)";
+    R"(This keyword is used to select benchmark mode. What benchmark mode does
+       depends on the executable. In inciter no large file output is performed,
+       overriding the configuration in the control file. In rngtest the
+       throughput of the Random123 random number generators is measured before
+       running the test batteries.)";
   }
   using alias = Alias< b >;
 };
@@ -3848,6 +3988,26 @@ struct nonblocking_info {
 using nonblocking =
   keyword< nonblocking_info, TAOCPP_PEGTL_STRING("nonblocking") >;
 
+struct memckpt_info {
+  static std::string name() { return "memckpt"; }
+  static std::string shortDescription()
+  { return "Select in-memory checkpointing"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select in-memory (double) checkpointing during
+       time stepping, instead of the default checkpointing to disk. If
+       selected, checkpoints taken every 'rsfreq' time steps are stored in
+       memory of buddy processing elements, from which the Charm++ runtime
+       system can recover without reading from the file system. A checkpoint
+       is still written to disk at the end of time stepping so that a
+       subsequent run can be restarted, and every 'diskfreq'-th in-memory
+       checkpoint is also written to disk. Requires Charm++ built with in-memory
+       checkpointing support (syncft), otherwise checkpoints are written to
+       disk.)";
+  }
+};
+
+using memckpt = keyword< memckpt_info, TAOCPP_PEGTL_STRING("memckpt") >;
+
 struct lbfreq_info {
   static std::string name() { return "Load balancing frequency"; }
   static std::string shortDescription()
@@ -3897,6 +4057,32 @@ struct rsfreq_info {
 };
 using rsfreq = keyword< rsfreq_info, TAOCPP_PEGTL_STRING("rsfreq") >;
 
+struct diskfreq_info {
+  static std::string name() { return "In-memory checkpoint disk frequency"; }
+  static std::string shortDescription()
+  { return "Set frequency of writing in-memory checkpoints to disk"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the frequency of also writing in-memory
+       checkpoints to disk, used only if in-memory checkpointing is selected,
+       see also 'memckpt'. The default is 10, which means that every 10th
+       in-memory checkpoint is also written to checkpoint/restart files on
+       disk, so that a failed run can be restarted from the file system even
+       if the in-memory checkpoints are lost. Zero means that checkpoints are
+       only written to disk at the end of time stepping.)";
+  }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using diskfreq = keyword< diskfreq_info, TAOCPP_PEGTL_STRING("diskfreq") >;
+
 struct feedback_info {
   static std::string name() { return "feedback"; }
   static std::string shortDescription() { return "Enable on-screen feedback"; }
@@ -4093,6 +4279,27 @@ struct screen_info {
 };
 using screen = keyword< screen_info, TAOCPP_PEGTL_STRING("screen") >;
 
+struct costmodel_info {
+  static std::string name() { return "costmodel"; }
+  static std::string shortDescription() {
+    return "Specify the file storing the cost of statistical tests"; }
+  static std::string longDescription() { return
+    R"(This option is used to set the name of a file storing the measured run
+    time of each statistical test of an RNG battery with each RNG tested. If
+    the file exists, the measured times are used to distribute the tests across
+    the processing elements (PEs) so that the longest tests start first and the
+    PEs finish at about the same time. After the battery has run, the file is
+    updated with the run times measured. If not given, all tests are assumed
+    to take the same time.)";
+  }
+  using alias = Alias< m >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using costmodel = keyword< costmodel_info, TAOCPP_PEGTL_STRING("costmodel") >;
+
 struct restart_info {
   static std::string name() { return "checkpoint/restart directory name"; }
   static std::string shortDescription()
@@ -5003,6 +5210,34 @@ struct cweight_info {
 };
 using cweight = keyword< cweight_info, TAOCPP_PEGTL_STRING("cweight") >;
 
+struct shock_detector_coeff_info {
+  static std::string name() { return "shock_detector_coeff"; }
+  static std::string shortDescription() { return
+    R"(Set threshold of troubled-cell indicator gating the DG limiter)"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the threshold of the troubled-cell (shock)
+    indicator for discontinuous Galerkin (DG) methods. The indicator measures
+    the jump of the solution across the faces of a cell, normalized by the cell
+    size and the magnitude of the solution, similar to that of Krivodonova et
+    al., Applied Numerical Mathematics, 48(3-4), 323-338, 2004. The limiter is
+    only applied in cells whose indicator exceeds this threshold and in their
+    face-neighbors. A value of zero (the default) disables the indicator and
+    the limiter is applied in all cells. Example: "shock_detector_coeff 1.0".)";
+  }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 1.0e+6;
+    static std::string description() { return "real"; }
+    static std::string choices() {
+      return "real between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "]";
+    }
+  };
+};
+using shock_detector_coeff = keyword< shock_detector_coeff_info,
+  TAOCPP_PEGTL_STRING("shock_detector_coeff") >;
+
 struct sideset_info {
   static std::string name() { return "sideset"; }
   static std::string shortDescription() { return
@@ -5910,6 +6145,74 @@ struct amr_tolderef_info {
 using amr_tolderef =
   keyword< amr_tolderef_info, TAOCPP_PEGTL_STRING("tol_derefine") >;
 
+struct amr_rebalance_info {
+  static std::string name() { return "Rebalance mesh after refinement at t<0"; }
+  static std::string shortDescription() { return
+    "Enable migrating elements between chares after initial refinement"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to enable diffusive load rebalancing after initial
+    (t<0) mesh refinement. If enabled and the ratio of the largest and smallest
+    number of elements per chare exceeds the value configured by the
+    'imbalance' keyword, chares hand elements along their chare boundary to
+    less loaded neighbor chares before the mesh is reordered and the
+    discretization is created.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using amr_rebalance =
+  keyword< amr_rebalance_info, TAOCPP_PEGTL_STRING("rebalance") >;
+
+struct amr_imbalance_info {
+  static std::string name() { return "Load imbalance threshold"; }
+  static std::string shortDescription() { return
+    "Configure the load imbalance threshold triggering mesh rebalancing"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the threshold on the ratio of the largest
+    and smallest number of mesh elements per chare above which elements are
+    migrated between neighbor chares after initial (t<0) mesh refinement. Only
+    used if 'rebalance' is enabled.)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 1.0;
+    static std::string description() { return "real"; }
+    static std::string choices() {
+      return "real larger than " + std::to_string(lower);
+    }
+  };
+};
+using amr_imbalance =
+  keyword< amr_imbalance_info, TAOCPP_PEGTL_STRING("imbalance") >;
+
+struct amr_maxrebal_info {
+  static std::string name() { return "Maximum number of rebalancing rounds"; }
+  static std::string shortDescription() { return
+    "Configure the maximum number of mesh rebalancing rounds"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the maximum number of rounds of element
+    migration between neighbor chares after initial (t<0) mesh refinement.
+    Each round moves elements only across chare boundaries, so a large
+    imbalance may need multiple rounds to diffuse. Rebalancing stops when the
+    imbalance drops below the threshold set by 'imbalance' or after this many
+    rounds, whichever comes first. The default is 10. Only used if
+    'rebalance' is enabled.)"; }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = std::numeric_limits< type >::max();
+    static std::string description() { return "uint"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using amr_maxrebal =
+  keyword< amr_maxrebal_info, TAOCPP_PEGTL_STRING("maxrebal") >;
+
 struct amr_info {
   static std::string name() { return "AMR"; }
   static std::string shortDescription() { return
@@ -5926,6 +6229,9 @@ struct amr_info {
     + amr_refvar::string() + "\' | \'"
     + amr_tolref::string() + "\' | \'"
     + amr_tolderef::string() + "\' | \'"
+    + amr_rebalance::string() + "\' | \'"
+    + amr_imbalance::string() + "\' | \'"
+    + amr_maxrebal::string() + "\' | \'"
     + amr_error::string() + "\' | \'"
     + amr_coordref::string() + "\' | \'"
     + amr_edgelist::string() + "\'.";
@@ -6019,6 +6325,34 @@ struct pref_tolref_info {
 };
 using pref_tolref = keyword< pref_tolref_info, TAOCPP_PEGTL_STRING("tolref") >;
 
+struct pref_lbtol_info {
+  static std::string name() { return "Load imbalance tolerance for p-adaptive "
+    "DG"; }
+  static std::string shortDescription() { return "Configure the load "
+    "imbalance tolerance triggering load balancing for the p-adaptive DG "
+    "scheme"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to configure the tolerance of load imbalance
+    that triggers load balancing for the p-adaptive DG scheme. The keyword must
+    be used in pref ... end block. With p-adaptive refinement the load of DG
+    chares is predicted from the number of degrees of freedom of their
+    elements. At the frequency configured by the lbfreq command line argument,
+    load balancing is only initiated if the largest predicted load on a single
+    PE exceeds the average predicted load across all PEs by more than this
+    fraction. Example specification: 'lbtol 0.1'.)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 10.0;
+    static std::string description() { return "real"; }
+    static std::string choices() {
+      return "real between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using pref_lbtol = keyword< pref_lbtol_info, TAOCPP_PEGTL_STRING("lbtol") >;
+
 struct pref_info {
   static std::string name() { return "pref"; }
   static std::string shortDescription() { return
@@ -6029,7 +6363,8 @@ struct pref_info {
     in this block: )" + std::string("\'")
     + pref_indicator::string() + "\' | \'"
     + pref_ndofmax::string() + "\' | \'"
-    + pref_tolref::string() + "\' | \'";
+    + pref_tolref::string() + "\' | \'"
+    + pref_lbtol::string() + "\'";
   }
 };
 using pref = keyword< pref_info, TAOCPP_PEGTL_STRING("pref") >;
@@ -31,6 +31,7 @@ namespace ctr {
 using CmdLineMembers = brigand::list<
     tag::io,         ios
   , tag::verbose,    bool
+  , tag::benchmark,  bool
   , tag::chare,      bool
   , tag::help,       bool
   , tag::helpctr,    bool
@@ -51,8 +52,10 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
     //! RNGTest command-line keywords
     //! \see tk::grm::use and its documentation
     using keywords = tk::cmd_keywords< kw::verbose
+                                     , kw::benchmark
                                      , kw::charestate
                                      , kw::control
+                                     , kw::costmodel
                                      , kw::help
                                      , kw::helpctr
                                      , kw::helpkw
@@ -104,6 +107,7 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
       get< tag::io, tag::screen >() =
         tk::baselogname( tk::rngtest_executable() );
       get< tag::verbose >() = false; // Use quiet output by default
+      get< tag::benchmark >() = false; // No benchmark mode by default
       get< tag::chare >() = false; // No chare state output by default
       get< tag::trace >() = true; // Output call and stack trace by default
       get< tag::version >() = false; // Do not display version info by default
@@ -35,6 +35,11 @@ namespace cmd {
          tk::grm::process_cmd_switch< use, kw::verbose,
                                       tag::verbose > {};
 
+  //! Match and set benchmark switch (i.e., benchmark mode)
+  struct benchmark :
+         tk::grm::process_cmd_switch< use, kw::benchmark,
+                                      tag::benchmark > {};
+
   //! Match and set chare state switch
   struct charestate :
          tk::grm::process_cmd_switch< use, kw::charestate,
@@ -88,6 +93,7 @@ namespace cmd {
   //! Match all command line keywords
   struct keywords :
          pegtl::sor< verbose,
+                     benchmark,
                      charestate,
                      help,
                      helpctr,
@@ -97,7 +103,8 @@ namespace cmd {
                      version,
                      license,
                      io< kw::screen, tag::screen >,
-                     io< kw::control, tag::control > > {};
+                     io< kw::control, tag::control >,
+                     io< kw::costmodel, tag::costmodel > > {};
 
   //! \brief Grammar entry point: parse keywords until end of string
   struct read_string :
@@ -41,6 +41,7 @@ using ios = tk::TaggedTuple< brigand::list<
     tag::nrestart,  int                             //!< Number of restarts
   , tag::control,  std::string                      //!< Control filename
   , tag::screen,    kw::screen::info::expect::type  //!< Screen output filename
+  , tag::costmodel, kw::costmodel::info::expect::type //!< Test cost filename
 > >;
 
 //! Parameters storage
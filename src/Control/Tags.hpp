@@ -56,6 +56,7 @@ struct rng123 { static std::string name() { return "rng123"; } };
 struct seqlen { static std::string name() { return "seqlen"; } };
 struct verbose { static std::string name() { return "verbose"; } };
 struct nonblocking { static std::string name() { return "nonblocking"; } };
+struct memckpt { static std::string name() { return "memckpt"; } };
 struct benchmark { static std::string name() { return "benchmark"; } };
 struct lboff {};
 struct feedback { static std::string name() { return "feedback"; } };
@@ -67,6 +68,7 @@ struct operator_reorder {
 struct error { static std::string name() { return "error"; } };
 struct lbfreq { static std::string name() { return "lbfreq"; } };
 struct rsfreq { static std::string name() { return "rsfreq"; } };
+struct diskfreq { static std::string name() { return "diskfreq"; } };
 struct dtfreq { static std::string name() { return "dtfreq"; } };
 struct pdf { static std::string name() { return "pdf"; } };
 struct ordpdf {};
@@ -114,12 +116,16 @@ struct pde { static std::string name() { return "pde"; } };
 struct pref { static std::string name() { return "pref"; } };
 struct tolref { static std::string name() { return "tolref"; } };
 struct ndofmax { static std::string name() { return "ndofmax"; } };
+struct lbtol { static std::string name() { return "lbtol"; } };
 struct indicator{ static std::string name() { return "indicator"; } };
 struct amr { static std::string name() { return "amr"; } };
 struct tolderef { static std::string name() { return "tolderef"; } };
 struct t0ref { static std::string name() { return "t0ref"; } };
 struct dtref { static std::string name() { return "dtref"; } };
 struct dtref_uniform { static std::string name() { return "dtref_uniform"; } };
+struct rebalance { static std::string name() { return "rebalance"; } };
+struct imbalance { static std::string name() { return "imbalance"; } };
+struct maxrebal { static std::string name() { return "maxrebal"; } };
 struct partitioner { static std::string name() { return "partitioner"; } };
 struct scheme { static std::string name() { return "scheme"; } };
 struct initpolicy { static std::string name() { return "initpolicy"; } };
@@ -129,6 +135,9 @@ struct nstep { static std::string name() { return "nstep"; } };
 struct term { static std::string name() { return "term"; } };
 struct t0 { static std::string name() { return "t0"; } };
 struct dt { static std::string name() { return "dt"; } };
+struct lagtol { static std::string name() { return "lagtol"; } };
+struct particle_rng {
+  static std::string name() { return "particle_rng"; } };
 struct cfl { static std::string name() { return "cfl"; } };
 struct fct { static std::string name() { return "fct"; } };
 struct fctclip { static std::string name() { return "fctclip"; } };
@@ -154,9 +163,14 @@ struct dump {};
 struct plot {};
 struct glob {};
 struct control { static std::string name() { return "control"; } };
+struct costmodel { static std::string name() { return "costmodel"; } };
 struct stat { static std::string name() { return "stat"; } };
 struct field { static std::string name() { return "field"; } };
 struct surface { static std::string name() { return "surface"; } };
+struct aggregate { static std::string name() { return "aggregate"; } };
+struct inflight { static std::string name() { return "inflight"; } };
+struct compress { static std::string name() { return "compress"; } };
+struct errbound { static std::string name() { return "errbound"; } };
 struct atwood {};
 struct b { static std::string name() { return "b"; } };
 struct S { static std::string name() { return "S"; } };
@@ -277,6 +291,8 @@ struct ndof{ static std::string name() { return "ndof"; } };
 struct rdof{ static std::string name() { return "rdof"; } };
 struct limiter { static std::string name() { return "limiter"; } };
 struct cweight { static std::string name() { return "cweight"; } };
+struct shock_detector_coeff {
+  static std::string name() { return "shock_detector_coeff"; } };
 struct update {};
 struct ch {};
 struct pe {};
@@ -706,6 +706,10 @@ namespace deck {
                      tk::grm::discrparam< use, kw::nstep, tag::nstep >,
                      tk::grm::discrparam< use, kw::term, tag::term >,
                      tk::grm::discrparam< use, kw::dt, tag::dt >,
+                     tk::grm::discrparam< use, kw::lagtol, tag::lagtol >,
+                     tk::grm::process< use< kw::particle_rng >,
+                       tk::grm::Store< tag::discr, tag::particle_rng >,
+                       pegtl::alpha >,
                      tk::grm::interval< use< kw::ttyi >, tag::tty >,
                      tk::grm::interval< use< kw::pari >, tag::particles >
                    > {};
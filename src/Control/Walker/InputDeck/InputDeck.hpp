@@ -65,6 +65,8 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::nstep
                                  , kw::term
                                  , kw::dt
+                                 , kw::lagtol
+                                 , kw::particle_rng
                                  , kw::ttyi
                                  , kw::pari
                                  , kw::rngs
@@ -250,6 +252,8 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
         std::numeric_limits< kw::nstep::info::expect::type >::max();
       get< tag::discr, tag::term >() = 1.0;
       get< tag::discr, tag::dt >() = 0.5;
+      get< tag::discr, tag::lagtol >() = 0.0;
+      get< tag::discr, tag::particle_rng >() = false;
       // Default txt floating-point output precision in digits
       get< tag::prec, tag::stat >() = std::cout.precision();
       get< tag::prec, tag::pdf >() = std::cout.precision();
@@ -51,6 +51,8 @@ using discretization = tk::TaggedTuple< brigand::list<
   , tag::nstep,     kw::nstep::info::expect::type   //!< Number of time steps
   , tag::term,      kw::term::info::expect::type    //!< Termination time
   , tag::dt,        kw::dt::info::expect::type      //!< Size of time step
+  , tag::lagtol,    kw::lagtol::info::expect::type  //!< Lagged moments tol
+  , tag::particle_rng, bool                         //!< Per-particle RNGs
   , tag::binsize,   std::vector< std::vector< tk::real > >  //!< PDF binsizes
   , tag::extent,    std::vector< std::vector< tk::real > >  //!< PDF extents
 > >;
@@ -49,6 +49,7 @@
 #include "BetaCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 
 namespace walker {
 
@@ -110,18 +111,27 @@ class Beta {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      ParticleBlock blk( m_ncomp, m_ncomp );
+      for (ncomp_t p=0; p<npar; p+=ParticleBlock::size) {
+        blk.load( particles, p, m_offset, m_ncomp );
+        const auto n = blk.npar();
+
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        blk.gaussian( m_rng, stream );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * (1.0 - par) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += 0.5*m_b[i]*(m_S[i] - par)*dt + d*dW[i];
+          tk::real* y = blk.y(i);
+          const tk::real* dW = blk.dW(i);
+          const tk::real b = m_b[i], S = m_S[i], k = m_k[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real d = k * y[q] * (1.0 - y[q]) * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            y[q] += 0.5*b*(S - y[q])*dt + d*dW[q];
+          }
         }
+
+        blk.store( particles, m_offset );
       }
     }
 
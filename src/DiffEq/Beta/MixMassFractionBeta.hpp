@@ -85,6 +85,7 @@
 #include "MixMassFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 #include "Table.hpp"
 #include "CoupledEq.hpp"
 #include "HydroTimeScales.hpp"
@@ -225,30 +226,40 @@ class MixMassFractionBeta {
 
       // Advance particles
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      ParticleBlock blk( m_ncomp*4, m_ncomp );
+      std::vector< tk::real > g( ParticleBlock::size, 0.0 );
+      using std::abs;
+      const bool grad =
+        abs(m_dY[0]) > eps || abs(m_dY[1]) > eps || abs(m_dY[2]) > eps;
+      for (ncomp_t p=0; p<npar; p+=ParticleBlock::size) {
+        blk.load( particles, p, m_offset, m_ncomp );
+        const auto n = blk.npar();
+
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Access coupled particle velocity
-        tk::real u = 0.0, v = 0.0, w = 0.0;
-        using std::abs;
-        if (abs(m_dY[0]) > eps || abs(m_dY[1]) > eps || abs(m_dY[2]) > eps) {
-          u = particles( p, 0, m_velocity_offset );
-          v = particles( p, 1, m_velocity_offset );
-          w = particles( p, 2, m_velocity_offset );
-        }
+        blk.gaussian( m_rng, stream );
+
+        // Access coupled particle velocity projected on imposed mean gradient
+        if (grad)
+          for (ncomp_t q=0; q<n; ++q)
+            g[q] = m_dY[0]*particles( p+q, 0, m_velocity_offset )
+                 - m_dY[1]*particles( p+q, 1, m_velocity_offset )
+                 - m_dY[2]*particles( p+q, 2, m_velocity_offset );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& Y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * Y * (1.0 - Y) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          Y += 0.5*m_b[i]*(m_S[i] - Y)*dt + d*dW[i]
-             - (m_dY[0]*u - m_dY[1]*v - m_dY[2]*w)*dt;
+          tk::real* Y = blk.y(i);
+          const tk::real* dW = blk.dW(i);
+          const tk::real b = m_b[i], S = m_S[i], k = m_k[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real d = k * Y[q] * (1.0 - Y[q]) * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            Y[q] += 0.5*b*(S - Y[q])*dt + d*dW[q] - g[q]*dt;
+          }
           // Compute instantaneous values derived from updated Y
-          derived( particles, p, i );
+          derived( blk, i );
         }
+
+        blk.store( particles, m_offset );
       }
     }
 
@@ -327,6 +338,21 @@ class MixMassFractionBeta {
       particles( p, m_ncomp*3+i, m_offset ) = 1.0 - Y;
     }
 
+    //! Compute instantaneous values derived from updated Y for a block
+    //! \param[in,out] blk Block of particles
+    //! \param[in] i Component index
+    void derived( ParticleBlock& blk, ncomp_t i ) const {
+      const tk::real* Y = blk.y(i);
+      tk::real* r = blk.y( m_ncomp+i );
+      tk::real* v = blk.y( m_ncomp*2+i );
+      tk::real* c = blk.y( m_ncomp*3+i );
+      for (ncomp_t q=0; q<blk.npar(); ++q) {
+        r[q] = rho( Y[q], i );
+        v[q] = vol( Y[q], i );
+        c[q] = 1.0 - Y[q];
+      }
+    }
+
     //! Initialize imposed mean scalar gradient from user input
     std::array< tk::real, 3 > initScalarGradient() {
       const auto& mg = g_inputdeck.get< tag::param, eq, tag::mean_gradient >();
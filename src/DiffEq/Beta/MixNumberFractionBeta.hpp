@@ -86,6 +86,7 @@
 #include "MixNumberFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 
 namespace walker {
 
@@ -166,20 +167,31 @@ class MixNumberFractionBeta {
       coeff.update( m_depvar, m_ncomp, moments, m_bprime, m_kprime, m_b, m_k );
       // Advance particles
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      ParticleBlock blk( m_ncomp*3, m_ncomp );
+      for (ncomp_t p=0; p<npar; p+=ParticleBlock::size) {
+        blk.load( particles, p, m_offset, m_ncomp );
+        const auto n = blk.npar();
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        blk.gaussian( m_rng, stream );
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& X = particles( p, i, m_offset );
-          tk::real d = m_k[i] * X * (1.0 - X) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          X += 0.5*m_b[i]*(m_S[i] - X)*dt + d*dW[i];
+          tk::real* X = blk.y(i);
+          const tk::real* dW = blk.dW(i);
+          const tk::real b = m_b[i], S = m_S[i], k = m_k[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real d = k * X[q] * (1.0 - X[q]) * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            X[q] += 0.5*b*(S - X[q])*dt + d*dW[q];
+          }
           // Compute instantaneous values derived from updated X
-          particles( p, m_ncomp+i, m_offset ) = rho( X, i );
-          particles( p, m_ncomp*2+i, m_offset ) = vol( X, i );
+          tk::real* r = blk.y( m_ncomp+i );
+          tk::real* v = blk.y( m_ncomp*2+i );
+          for (ncomp_t q=0; q<n; ++q) {
+            r[q] = rho( X[q], i );
+            v[q] = vol( X[q], i );
+          }
         }
+        blk.store( particles, m_offset );
       }
     }
 
@@ -56,6 +56,7 @@
 #include "DirichletCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 
 namespace walker {
 
@@ -120,23 +121,36 @@ class Dirichlet {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      ParticleBlock blk( m_ncomp, m_ncomp );
+      std::vector< tk::real > yn( ParticleBlock::size );
+      for (ncomp_t p=0; p<npar; p+=ParticleBlock::size) {
+        blk.load( particles, p, m_offset, m_ncomp );
+        const auto n = blk.npar();
+
         // Compute Nth scalar
-        tk::real yn = 1.0 - particles(p, 0, m_offset);
-        for (ncomp_t i=1; i<m_ncomp; ++i)
-          yn -= particles( p, i, m_offset );
+        const tk::real* y0 = blk.y(0);
+        for (ncomp_t q=0; q<n; ++q) yn[q] = 1.0 - y0[q];
+        for (ncomp_t i=1; i<m_ncomp; ++i) {
+          const tk::real* y = blk.y(i);
+          for (ncomp_t q=0; q<n; ++q) yn[q] -= y[q];
+        }
 
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        blk.gaussian( m_rng, stream );
 
         // Advance first m_ncomp (K=N-1) scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * yn * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += 0.5*m_b[i]*( m_S[i]*yn - (1.0-m_S[i]) * par )*dt + d*dW[i];
+          tk::real* y = blk.y(i);
+          const tk::real* dW = blk.dW(i);
+          const tk::real b = m_b[i], S = m_S[i], k = m_k[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real d = k * y[q] * yn[q] * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            y[q] += 0.5*b*( S*yn[q] - (1.0-S) * y[q] )*dt + d*dW[q];
+          }
         }
+
+        blk.store( particles, m_offset );
       }
     }
 
@@ -90,6 +90,7 @@
 #include "GeneralizedDirichletCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 
 namespace walker {
 
@@ -154,36 +155,53 @@ class GeneralizedDirichlet {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      const auto bs = ParticleBlock::size;
+      ParticleBlock blk( m_ncomp, m_ncomp );
+      std::vector< tk::real > Y( m_ncomp*bs ), U( m_ncomp*bs ), a( bs );
+      for (ncomp_t p=0; p<npar; p+=bs) {
+        blk.load( particles, p, m_offset, m_ncomp );
+        const auto n = blk.npar();
+
         // Y_i = 1 - sum_{k=1}^{i} y_k
-        std::vector< tk::real > Y( m_ncomp );
-        Y[0] = 1.0 - particles( p, 0, m_offset );
-        for (ncomp_t i=1; i<m_ncomp; ++i)
-          Y[i] = Y[i-1] - particles( p, i, m_offset );
+        const tk::real* y0 = blk.y(0);
+        for (ncomp_t q=0; q<n; ++q) Y[q] = 1.0 - y0[q];
+        for (ncomp_t i=1; i<m_ncomp; ++i) {
+          const tk::real* y = blk.y(i);
+          for (ncomp_t q=0; q<n; ++q) Y[i*bs+q] = Y[(i-1)*bs+q] - y[q];
+        }
 
         // U_i = prod_{j=1}^{K-i} 1/Y_{K-j}
-        std::vector< tk::real > U( m_ncomp );
-        U[m_ncomp-1] = 1.0;
+        for (ncomp_t q=0; q<n; ++q) U[(m_ncomp-1)*bs+q] = 1.0;
         for (long i=static_cast<long>(m_ncomp)-2; i>=0; --i) {
           auto j = static_cast< std::size_t >( i );
-          U[j] = U[j+1]/Y[j];
+          for (ncomp_t q=0; q<n; ++q) U[j*bs+q] = U[(j+1)*bs+q]/Y[j*bs+q];
         }
 
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        blk.gaussian( m_rng, stream );
 
         // Advance first m_ncomp (K=N-1) scalars
+        const tk::real* YK = Y.data() + (m_ncomp-1)*bs;
         ncomp_t k=0;
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * Y[m_ncomp-1] * U[i] * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          tk::real a=0.0;
-          for (ncomp_t j=i; j<m_ncomp-1; ++j) a += m_cij[k++]/Y[j];
-          par += U[i]/2.0*( m_b[i]*( m_S[i]*Y[m_ncomp-1] - (1.0-m_S[i])*par ) +
-                            par*Y[m_ncomp-1]*a )*dt + d*dW[i];
+          tk::real* y = blk.y(i);
+          const tk::real* dW = blk.dW(i);
+          const tk::real* Ui = U.data() + i*bs;
+          std::fill( begin(a), begin(a)+n, 0.0 );
+          for (ncomp_t j=i; j<m_ncomp-1; ++j) {
+            const tk::real c = m_cij[k++];
+            for (ncomp_t q=0; q<n; ++q) a[q] += c/Y[j*bs+q];
+          }
+          const tk::real b = m_b[i], S = m_S[i], kappa = m_k[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real d = kappa * y[q] * YK[q] * Ui[q] * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            y[q] += Ui[q]/2.0*( b*( S*YK[q] - (1.0-S)*y[q] ) +
+                                y[q]*YK[q]*a[q] )*dt + d*dW[q];
+          }
         }
+
+        blk.store( particles, m_offset );
       }
     }
 
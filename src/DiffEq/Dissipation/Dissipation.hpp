@@ -130,6 +130,7 @@ class Dissipation {
       for (auto p=decltype(npar){0}; p<npar; ++p) {
         // Generate a Gaussian random number with zero mean and unit variance
         tk::real dW;
+        m_rng.particle( stream, p, m_offset );
         m_rng.gaussian( stream, m_ncomp, &dW );
         // Advance particle frequency
         tk::real& Op = particles( p, 0, m_offset );
@@ -173,9 +173,11 @@ struct InitBeta {
 
       for (ncomp_t s=0; s<bc.size(); s+=4) {
         // generate beta random numbers for all particles using parameters in bc
-        for (ncomp_t p=0; p<particles.nunk(); ++p)
+        for (ncomp_t p=0; p<particles.nunk(); ++p) {
+          rng.particle( stream, p, offset + c );
           rng.beta( stream, 1, bc[s], bc[s+1], bc[s+2], bc[s+3],
                     &particles( p, c, offset ) );
+        }
       }
     }
 
@@ -217,6 +219,7 @@ struct InitGaussian {
         for (ncomp_t p=0; p<particles.nunk(); ++p) {
           auto& par = particles( p, c, offset );
           // sample from Gaussian with zero mean and unit variance
+          rng.particle( stream, p, offset + c );
           rng.gaussian( stream, 1, &par );
           // scale to given mean and variance
           par = par * sqrt(gc[s+1]) + gc[s];
@@ -267,6 +270,7 @@ struct InitCorrGaussian {
     // means and covariance matrix given by user
     for (ncomp_t p=0; p<particles.nunk(); ++p) {
       std::vector< double > r( ncomp );
+      rng.particle( stream, p, offset );
       rng.gaussianmv( stream, 1, ncomp, mean.data(), cov.data(), r.data() );
       for (ncomp_t c=0; c<ncomp; ++c)
         particles( p, c, offset ) = r[c];
@@ -305,8 +309,10 @@ struct InitGamma {
       const auto& gc = gamma[c];
       // generate gamma random numbers for all particles using parameters in gc
       for (ncomp_t s=0; s<gc.size(); s+=2)
-        for (ncomp_t p=0; p<particles.nunk(); ++p)
+        for (ncomp_t p=0; p<particles.nunk(); ++p) {
+          rng.particle( stream, p, offset + c );
           rng.gamma( stream, 1, gc[s], gc[s+1], &particles( p, c, offset ) );
+        }
     }
 
   }
@@ -339,6 +345,7 @@ struct InitDirichlet {
     for (ncomp_t p=0; p<particles.nunk(); ++p) {
       // Generate N gamma-distributed random numbers with prescribed shape and
       // unit scale scale parameters.
+      rng.particle( stream, p, offset );
       for (std::size_t c=0; c<ncomp+1; ++c) {
         rng.gamma( stream, 1, dir[c], 1.0, Y.data()+c );
       }
@@ -84,6 +84,7 @@
 #include "DiagOrnsteinUhlenbeckCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 
 namespace walker {
 
@@ -148,18 +149,26 @@ class DiagOrnsteinUhlenbeck {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      ParticleBlock blk( m_ncomp, m_ncomp );
+      for (ncomp_t p=0; p<npar; p+=ParticleBlock::size) {
+        blk.load( particles, p, m_offset, m_ncomp );
+        const auto n = blk.npar();
+
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        blk.gaussian( m_rng, stream );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
+          tk::real* y = blk.y(i);
+          const tk::real* dW = blk.dW(i);
           tk::real d = m_sigmasq[i] * dt;
           d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += m_theta[i]*(m_mu[i] - par)*dt + d*dW[i];
+          const tk::real theta = m_theta[i], mu = m_mu[i];
+          for (ncomp_t q=0; q<n; ++q)
+            y[q] += theta*(mu - y[q])*dt + d*dW[q];
         }
+
+        blk.store( particles, m_offset );
       }
     }
 
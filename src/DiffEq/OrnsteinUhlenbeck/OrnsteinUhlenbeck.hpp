@@ -89,6 +89,7 @@
 #include "OrnsteinUhlenbeckCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 
 namespace walker {
 
@@ -124,6 +125,8 @@ class OrnsteinUhlenbeck {
       m_sigma(),
       m_theta(),
       m_mu(),
+      m_chol(),
+      m_zero( m_ncomp, 0.0 ),
       coeff( m_ncomp,
              g_inputdeck.get< tag::param, tag::ou, tag::sigmasq >().at(c),
              g_inputdeck.get< tag::param, tag::ou, tag::theta >().at(c),
@@ -137,6 +140,12 @@ class OrnsteinUhlenbeck {
       #endif
         LAPACKE_dpotrf( LAPACK_ROW_MAJOR, 'U', n, m_sigma.data(), n );
       Assert( info == 0, "Error in Cholesky-decomposition" );
+
+      // Store upper triangle of Cholesky factor packed row-wise for
+      // generating correlated Gaussian random numbers
+      for (ncomp_t i=0; i<m_ncomp; ++i)
+        for (ncomp_t j=i; j<m_ncomp; ++j)
+          m_chol.push_back( m_sigma[ i*m_ncomp+j ] );
     }
 
     //! Initalize SDE, prepare for time integration
@@ -154,6 +163,10 @@ class OrnsteinUhlenbeck {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \details The correlated Wiener increments for a block of particles
+    //!   are generated in a single call as multi-variate Gaussian random
+    //!   numbers with zero mean, correlated by the Cholesky factor of the
+    //!   diffusion matrix computed in the constructor.
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
@@ -161,20 +174,25 @@ class OrnsteinUhlenbeck {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+      const auto sqrtdt = std::sqrt( dt );
+      ParticleBlock blk( m_ncomp, m_ncomp );
+      for (ncomp_t p=0; p<npar; p+=ParticleBlock::size) {
+        blk.load( particles, p, m_offset, m_ncomp );
+        const auto n = blk.npar();
+
+        // Generate correlated Gaussian random numbers for the block
+        blk.gaussianmv( m_rng, stream, m_zero.data(), m_chol.data() );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          par += m_theta[i]*(m_mu[i] - par)*dt;
-          for (ncomp_t j=0; j<m_ncomp; ++j) {
-            tk::real d = m_sigma[ j*m_ncomp+i ] * sqrt(dt);     // use transpose
-            par += d*dW[j];
-          }
+          tk::real* y = blk.y(i);
+          const tk::real* dW = blk.dW(i);
+          const tk::real theta = m_theta[i], mu = m_mu[i];
+          for (ncomp_t q=0; q<n; ++q)
+            y[q] += theta*(mu - y[q])*dt + sqrtdt*dW[q];
         }
+
+        blk.store( particles, m_offset );
       }
     }
 
@@ -190,6 +208,11 @@ class OrnsteinUhlenbeck {
     std::vector< kw::sde_theta::info::expect::type > m_theta;
     std::vector< kw::sde_mu::info::expect::type > m_mu;
 
+    //! Cholesky factor of the diffusion matrix, upper triangle packed row-wise
+    std::vector< tk::real > m_chol;
+    //! Zero mean for the correlated Wiener increments
+    std::vector< tk::real > m_zero;
+
     //! Coefficients policy
     Coefficients coeff;
 };
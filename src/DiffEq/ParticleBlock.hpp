@@ -0,0 +1,163 @@
+// *****************************************************************************
+/*!
+  \file      src/DiffEq/ParticleBlock.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Block of particle properties advanced together by the SDEs
+  \details   Block of particle properties advanced together by the SDEs. The
+    advance() member functions of the differential equations copy the
+    components of a block of particles into a ParticleBlock, draw the random
+    numbers for the whole block with a single call to the random number
+    generator, update the components as contiguous arrays, and copy them back.
+    Independent of the particle data layout, tk::Particles, the components are
+    stored component-major inside the block, so that the loops over the
+    particles of a block are unit-stride and can be vectorized. If the random
+    number generator stream is positioned per particle, see
+    tk::RNG::particle(), the numbers are drawn particle by particle, keyed by
+    the offset of the equation in the particle array.
+*/
+// *****************************************************************************
+#ifndef ParticleBlock_h
+#define ParticleBlock_h
+
+#include <vector>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "Particles.hpp"
+#include "RNG.hpp"
+#include "SystemComponents.hpp"
+
+namespace walker {
+
+//! Block of particle properties stored component-major
+class ParticleBlock {
+
+  private:
+    using ncomp_t = tk::ctr::ncomp_t;
+
+  public:
+    //! Maximum number of particles in a block
+    static constexpr ncomp_t size = 256;
+
+    //! Constructor
+    //! \param[in] ncomp Number of particle components stored in the block
+    //! \param[in] nrng Number of random numbers drawn per particle
+    explicit ParticleBlock( ncomp_t ncomp, ncomp_t nrng = 0 ) :
+      m_ncomp( ncomp ),
+      m_nrng( nrng ),
+      m_first( 0 ),
+      m_offset( 0 ),
+      m_npar( 0 ),
+      m_y( ncomp * size ),
+      m_r( nrng * size ),
+      m_dW( nrng * size ) {}
+
+    //! Copy components of a block of particles into the block
+    //! \param[in] particles Particle properties array
+    //! \param[in] first Index of the first particle of the block
+    //! \param[in] offset Offset in the particle array to copy from
+    //! \param[in] n Number of components to copy, the rest is left untouched
+    //!   and is expected to be computed before store()
+    void load( const tk::Particles& particles,
+               ncomp_t first,
+               ncomp_t offset,
+               ncomp_t n )
+    {
+      Assert( n <= m_ncomp, "Too many components to load into block" );
+      m_first = first;
+      m_offset = offset;
+      m_npar = std::min( size, particles.nunk() - first );
+      for (ncomp_t q=0; q<m_npar; ++q)
+        for (ncomp_t i=0; i<n; ++i)
+          m_y[ i*size + q ] = particles( m_first+q, i, offset );
+    }
+
+    //! Copy all components of the block back to the particles
+    //! \param[in,out] particles Particle properties array
+    //! \param[in] offset Offset in the particle array to copy to
+    void store( tk::Particles& particles, ncomp_t offset ) const {
+      for (ncomp_t q=0; q<m_npar; ++q)
+        for (ncomp_t i=0; i<m_ncomp; ++i)
+          particles( m_first+q, i, offset ) = m_y[ i*size + q ];
+    }
+
+    //! \brief Draw Gaussian random numbers with zero mean and unit variance
+    //!   for all particles of the block
+    //! \param[in] rng Random number generator
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \details The numbers are drawn particle by particle, in the same order
+    //!   as drawing nrng numbers for each particle separately would.
+    void gaussian( const tk::RNG& rng, int stream ) {
+      if (rng.particle( stream, m_first, m_offset ))
+        for (ncomp_t q=0; q<m_npar; ++q) {
+          if (q) rng.particle( stream, m_first+q, m_offset );
+          rng.gaussian( stream, m_nrng, m_r.data() + q*m_nrng );
+        }
+      else
+        rng.gaussian( stream, m_nrng*m_npar, m_r.data() );
+      transpose();
+    }
+
+    //! \brief Draw multi-variate Gaussian random numbers for all particles of
+    //!   the block
+    //! \param[in] rng Random number generator
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \param[in] mean Mean vector of dimension nrng
+    //! \param[in] cov Upper triangular Cholesky factor of the covariance
+    //!   matrix packed row-wise, see tk::RNG::gaussianmv()
+    void gaussianmv( const tk::RNG& rng, int stream,
+                     const tk::real* mean, const tk::real* cov )
+    {
+      if (rng.particle( stream, m_first, m_offset ))
+        for (ncomp_t q=0; q<m_npar; ++q) {
+          if (q) rng.particle( stream, m_first+q, m_offset );
+          rng.gaussianmv( stream, 1, m_nrng, mean, cov, m_r.data() + q*m_nrng );
+        }
+      else
+        rng.gaussianmv( stream, m_npar, m_nrng, mean, cov, m_r.data() );
+      transpose();
+    }
+
+    //! Number of particles in the block
+    //! \return Number of particles loaded into the block
+    ncomp_t npar() const { return m_npar; }
+
+    //! Index of the first particle of the block
+    //! \return Index of the first particle in the particle properties array
+    ncomp_t first() const { return m_first; }
+
+    //! Access a component of all particles of the block
+    //! \param[in] i Component index
+    //! \return Pointer to the contiguous array of component i
+    tk::real* y( ncomp_t i ) { return m_y.data() + i*size; }
+
+    //! Access random numbers of a component of all particles of the block
+    //! \param[in] i Component index
+    //! \return Pointer to the contiguous array of random numbers of component i
+    const tk::real* dW( ncomp_t i ) const { return m_dW.data() + i*size; }
+
+  private:
+    const ncomp_t m_ncomp;              //!< Number of components in block
+    const ncomp_t m_nrng;               //!< Number of RNGs per particle
+    ncomp_t m_first;                    //!< First particle of the block
+    ncomp_t m_offset;                   //!< Offset of the equation loaded
+    ncomp_t m_npar;                     //!< Number of particles in block
+    std::vector< tk::real > m_y;        //!< Components, component-major
+    std::vector< tk::real > m_r;        //!< Random numbers, particle-major
+    std::vector< tk::real > m_dW;       //!< Random numbers, component-major
+
+    //! Reorder random numbers from particle-major to component-major
+    void transpose() {
+      for (ncomp_t q=0; q<m_npar; ++q)
+        for (ncomp_t i=0; i<m_nrng; ++i)
+          m_dW[ i*size + q ] = m_r[ q*m_nrng + i ];
+    }
+};
+
+} // walker::
+
+#endif // ParticleBlock_h
@@ -147,6 +147,7 @@ class SkewNormal {
       for (auto p=decltype(npar){0}; p<npar; ++p) {
         // Generate Gaussian random numbers with zero mean and unit variance
         std::vector< tk::real > dW( m_ncomp );
+        m_rng.particle( stream, p, m_offset );
         m_rng.gaussian( stream, m_ncomp, dW.data() );
 
         // Advance all m_ncomp scalars
@@ -25,6 +25,7 @@
 #include "VelocityCoeffPolicy.hpp"
 #include "RNG.hpp"
 #include "Particles.hpp"
+#include "ParticleBlock.hpp"
 #include "CoupledEq.hpp"
 
 namespace walker {
@@ -195,48 +196,65 @@ class Velocity {
         }
       }
 
+      // Compute diffusion
+      tk::real d = m_c0 * eps * dt;
+      d = (d > 0.0 ? std::sqrt(d) : 0.0);
+
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      ParticleBlock blk( m_ncomp + m_numderived, m_ncomp );
+      for (ncomp_t p=0; p<npar; p+=ParticleBlock::size) {
+        blk.load( particles, p, m_offset, m_ncomp + m_numderived );
+        const auto n = blk.npar();
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        blk.gaussian( m_rng, stream );
         // Access particle velocity
-        tk::real& Up = particles( p, 0, m_offset );
-        tk::real& Vp = particles( p, 1, m_offset );
-        tk::real& Wp = particles( p, 2, m_offset );
-        // Compute diffusion
-        tk::real d = m_c0 * eps * dt;
-        d = (d > 0.0 ? std::sqrt(d) : 0.0);
-        // Compute velocity fluctuation
-        tk::real u = Up - U[0];
-        tk::real v = Vp - U[1];
-        tk::real w = Wp - U[2];
-        // Update particle velocity based on Langevin model
-        Up += (m_G[0]*u + m_G[1]*v + m_G[2]*w)*dt + d*dW[0];
-        Vp += (m_G[3]*u + m_G[4]*v + m_G[5]*w)*dt + d*dW[1];
-        Wp += (m_G[6]*u + m_G[7]*v + m_G[8]*w)*dt + d*dW[2];
+        tk::real* Up = blk.y(0);
+        tk::real* Vp = blk.y(1);
+        tk::real* Wp = blk.y(2);
+        const tk::real* dWu = blk.dW(0);
+        const tk::real* dWv = blk.dW(1);
+        const tk::real* dWw = blk.dW(2);
+        for (ncomp_t q=0; q<n; ++q) {
+          // Compute velocity fluctuation
+          tk::real u = Up[q] - U[0];
+          tk::real v = Vp[q] - U[1];
+          tk::real w = Wp[q] - U[2];
+          // Update particle velocity based on Langevin model
+          Up[q] += (m_G[0]*u + m_G[1]*v + m_G[2]*w)*dt + d*dWu[q];
+          Vp[q] += (m_G[3]*u + m_G[4]*v + m_G[5]*w)*dt + d*dWv[q];
+          Wp[q] += (m_G[6]*u + m_G[7]*v + m_G[8]*w)*dt + d*dWw[q];
+        }
         // Add gravity
         if (m_solve == ctr::DepvarType::PRODUCT ||
             m_solve == ctr::DepvarType::FLUCTUATING_MOMENTUM)
         {
           for (ncomp_t c=0; c<mixncomp; ++c) {
-            auto rhoi = particles( p, mixncomp + c, m_mixmassfracbeta_offset );
-            if (std::abs(rhoi) > epsilon) {
-              // add gravity force to particle momentum
-              Up += (rhoi - R[c]) * m_gravity[0] * dt;
-              Vp += (rhoi - R[c]) * m_gravity[1] * dt;
-              Wp += (rhoi - R[c]) * m_gravity[2] * dt;
-              // compute derived particle velocity
-              particles( p, m_ncomp+(c*3)+0, m_offset ) = (Up + RU[c*3+0])/rhoi;
-              particles( p, m_ncomp+(c*3)+1, m_offset ) = (Vp + RU[c*3+1])/rhoi;
-              particles( p, m_ncomp+(c*3)+2, m_offset ) = (Wp + RU[c*3+2])/rhoi;
+            tk::real* Us = blk.y( m_ncomp+(c*3)+0 );
+            tk::real* Vs = blk.y( m_ncomp+(c*3)+1 );
+            tk::real* Ws = blk.y( m_ncomp+(c*3)+2 );
+            for (ncomp_t q=0; q<n; ++q) {
+              auto rhoi =
+                particles( p+q, mixncomp + c, m_mixmassfracbeta_offset );
+              if (std::abs(rhoi) > epsilon) {
+                // add gravity force to particle momentum
+                Up[q] += (rhoi - R[c]) * m_gravity[0] * dt;
+                Vp[q] += (rhoi - R[c]) * m_gravity[1] * dt;
+                Wp[q] += (rhoi - R[c]) * m_gravity[2] * dt;
+                // compute derived particle velocity
+                Us[q] = (Up[q] + RU[c*3+0])/rhoi;
+                Vs[q] = (Vp[q] + RU[c*3+1])/rhoi;
+                Ws[q] = (Wp[q] + RU[c*3+2])/rhoi;
+              }
             }
           }
         } else {
-          Up += m_gravity[0] * dt;
-          Vp += m_gravity[1] * dt;
-          Wp += m_gravity[2] * dt;
+          for (ncomp_t q=0; q<n; ++q) {
+            Up[q] += m_gravity[0] * dt;
+            Vp[q] += m_gravity[1] * dt;
+            Wp[q] += m_gravity[2] * dt;
+          }
         }
+        blk.store( particles, m_offset );
       }
     }
 
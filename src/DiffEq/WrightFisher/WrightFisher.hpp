@@ -220,6 +220,7 @@ class WrightFisher {
 
         // Advance the first m_ncomp (N-1) scalars
         if (info == 0) {
+          m_rng.particle( stream, p, m_offset );
           ncomp_t i = 0;
           for (i=0; i<m_ncomp-1; ++i) {
             tk::real& par = particles( p, i, m_offset );
@@ -11,6 +11,8 @@
 // *****************************************************************************
 
 #include <numeric>
+#include <limits>
+#include <cstdint>
 
 #include "NoWarning/exodusII.hpp"
 
@@ -23,7 +25,9 @@ using tk::ExodusIIMeshWriter;
 ExodusIIMeshWriter::ExodusIIMeshWriter( const std::string& filename,
                                         ExoWriter mode,
                                         int cpuwordsize,
-                                        int iowordsize ) :
+                                        int iowordsize,
+                                        int compress,
+                                        bool int64maps ) :
   m_filename( filename ), m_outFile( 0 )
 // *****************************************************************************
 //  Constructor: create/open Exodus II file
@@ -33,6 +37,13 @@ ExodusIIMeshWriter::ExodusIIMeshWriter( const std::string& filename,
 //!   appending
 //! \param[in] cpuwordsize Set CPU word size, see ExodusII documentation
 //! \param[in] iowordsize Set I/O word size, see ExodusII documentation
+//! \param[in] compress Compression (deflate) level, 1..9, for newly created
+//!   files. If nonzero, the file is created in the HDF5-based NetCDF-4 format,
+//!   which is required for compression. Zero (default) writes uncompressed.
+//! \param[in] int64maps True to store id maps of newly created files as 64-bit
+//!   integers, e.g., for global node ids that do not fit into 32 bits. If
+//!   true, the file is created in the HDF5-based NetCDF-4 format, which is
+//!   required for 64-bit integer storage.
 // *****************************************************************************
 {
   // Increase verbosity from ExodusII library in debug mode
@@ -42,11 +53,21 @@ ExodusIIMeshWriter::ExodusIIMeshWriter( const std::string& filename,
 
   if (mode == ExoWriter::CREATE) {
 
+    int mode_flags = EX_CLOBBER | EX_LARGE_MODEL;
+    if (compress > 0) mode_flags |= EX_NETCDF4;
+    if (int64maps) mode_flags |= EX_NETCDF4 | EX_MAPS_INT64_DB;
+
     m_outFile = ex_create( filename.c_str(),
-                           EX_CLOBBER | EX_LARGE_MODEL,
+                           mode_flags,
                            &cpuwordsize,
                            &iowordsize );
 
+    if (compress > 0 && m_outFile > 0)
+      ErrChk( ex_set_option( m_outFile, EX_OPT_COMPRESSION_LEVEL,
+                             compress ) == 0,
+              "Failed to set compression level for ExodusII file: "
+              + filename );
+
   } else if (mode == ExoWriter::OPEN) {
 
     float version;
@@ -222,6 +243,43 @@ ExodusIIMeshWriter::writeNodes( const std::vector< tk::real >& x,
           "Failed to write coordinates to ExodusII file: " + m_filename );
 }
 
+void
+ExodusIIMeshWriter::writeNodeMap( const std::vector< std::size_t >& gid ) const
+// *****************************************************************************
+//  Write node number map to ExodusII file
+//! \param[in] gid Global node ids (0-based) of the nodes written to file
+//! \details The node number map associates the file-internal node ids to
+//!   global node ids, see also ExodusIIMeshReader::readNodemap(). If the file
+//!   was created with 64-bit id maps, the map is written as 64-bit integers,
+//!   otherwise all ids must fit into 32-bit integers.
+// *****************************************************************************
+{
+  // Write node number map with 1-based node ids
+  if (ex_int64_status( m_outFile ) & EX_MAPS_INT64_DB) {
+
+    ex_set_int64_status( m_outFile, EX_MAPS_INT64_API );
+    std::vector< int64_t > map( gid.size() );
+    std::size_t i = 0;
+    for (auto g : gid) map[ i++ ] = static_cast< int64_t >( g+1 );
+    ErrChk( ex_put_id_map( m_outFile, EX_NODE_MAP, map.data() ) == 0,
+            "Failed to write node number map to ExodusII file: " + m_filename );
+
+  } else {
+
+    std::vector< int > map( gid.size() );
+    std::size_t i = 0;
+    for (auto g : gid) {
+      ErrChk( g < static_cast< std::size_t >( std::numeric_limits<int>::max() ),
+              "Global node id too large for 32-bit node number map in "
+              "ExodusII file: " + m_filename );
+      map[ i++ ] = static_cast< int >( g+1 );
+    }
+    ErrChk( ex_put_id_map( m_outFile, EX_NODE_MAP, map.data() ) == 0,
+            "Failed to write node number map to ExodusII file: " + m_filename );
+
+  }
+}
+
 void
 ExodusIIMeshWriter::writeElements( const UnsMesh& mesh ) const
 // *****************************************************************************
@@ -301,29 +359,43 @@ ExodusIIMeshWriter::writeSidesets( const UnsMesh& mesh ) const
 //  Write side sets and their face connectivity to ExodusII file
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
+{
+  writeSidesets( mesh.bface(), mesh.faceid() );
+}
+
+void
+ExodusIIMeshWriter::writeSidesets(
+  const std::map< int, std::vector< std::size_t > >& bface,
+  const std::map< int, std::vector< std::size_t > >& faceid ) const
+// *****************************************************************************
+//  Write side sets and their face connectivity to ExodusII file without mesh
+//! \param[in] bface File-internal element ids adjacent to side sets for each
+//!   side set
+//! \param[in] faceid Element-relative face ids for each side set
+// *****************************************************************************
 {
   // Write all side sets face list and connectivity in mesh
-  for (const auto& s : mesh.bface()) {
+  for (const auto& s : bface) {
     // Write side set parameters
     ErrChk( ex_put_set_param( m_outFile, EX_SIDE_SET, s.first,
                               static_cast<int64_t>(s.second.size()), 0 ) == 0,
       "Failed to write side set parameters to ExodusII file: " + m_filename );
 
     // ExodusII wants 32-bit integers as IDs of element ids
-    std::vector< int > bface( s.second.size() );
+    std::vector< int > bf( s.second.size() );
     std::size_t i = 0;
-    for (auto f : s.second) bface[ i++ ] = static_cast<int>(f)+1;
+    for (auto f : s.second) bf[ i++ ] = static_cast<int>(f)+1;
     // ExodusII wants 32-bit integers as element-relative face IDs
-    const auto& fi = tk::cref_find( mesh.faceid(), s.first );
-    std::vector< int > faceid( fi.size() );
+    const auto& fi = tk::cref_find( faceid, s.first );
+    std::vector< int > fid( fi.size() );
     i = 0;
-    for (auto f : fi) faceid[ i++ ] = static_cast<int>(f)+1;
+    for (auto f : fi) fid[ i++ ] = static_cast<int>(f)+1;
 
     // Write side set data: ExodusII-file internal element ids adjacent to side
     // set and face id relative to element indicating which face is aligned with
     // the side set.
-    ErrChk( ex_put_set( m_outFile, EX_SIDE_SET, s.first, bface.data(),
-                        faceid.data() ) == 0,
+    ErrChk( ex_put_set( m_outFile, EX_SIDE_SET, s.first, bf.data(),
+                        fid.data() ) == 0,
       "Failed to write side set face list to ExodusII file: " + m_filename );
   }
 }
@@ -334,21 +406,32 @@ ExodusIIMeshWriter::writeNodesets( const UnsMesh& mesh ) const
 //  Write side sets and their node list to ExodusII file
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
+{
+  writeNodesets( mesh.bnode() );
+}
+
+void
+ExodusIIMeshWriter::writeNodesets(
+  const std::map< int, std::vector< std::size_t > >& bnode ) const
+// *****************************************************************************
+//  Write side sets and their node list to ExodusII file without mesh
+//! \param[in] bnode File-internal node ids for each side set
+// *****************************************************************************
 {
   // Write all side set node lists in mesh
-  for (const auto& s : mesh.bnode()) {
+  for (const auto& s : bnode) {
     // Write side set parameters
     ErrChk( ex_put_set_param( m_outFile, EX_NODE_SET, s.first,
                               static_cast<int64_t>(s.second.size()), 0 ) == 0,
       "Failed to write side set parameters to ExodusII file: " + m_filename );
 
     // ExodusII wants 32-bit integers as IDs of node ids
-    std::vector< int > bnode( s.second.size() );
+    std::vector< int > bn( s.second.size() );
     std::size_t i = 0;
-    for (auto n : s.second) bnode[ i++ ] = static_cast<int>(n)+1;
+    for (auto n : s.second) bn[ i++ ] = static_cast<int>(n)+1;
 
     // Write side set data
-    ErrChk( ex_put_set( m_outFile, EX_NODE_SET, s.first, bnode.data(),
+    ErrChk( ex_put_set( m_outFile, EX_NODE_SET, s.first, bn.data(),
                         nullptr ) == 0,
       "Failed to write side set node list to ExodusII file: " + m_filename );
   }
@@ -516,12 +599,14 @@ ExodusIIMeshWriter::writeNodeScalar( uint64_t it,
 void
 ExodusIIMeshWriter::writeElemScalar( uint64_t it,
                                      int varid,
-                                     const std::vector< tk::real >& var ) const
+                                     const std::vector< tk::real >& var,
+                                     int blockid ) const
 // *****************************************************************************
 //  Write elem scalar field to ExodusII file
 //! \param[in] it Iteration number
 //! \param[in] varid Variable id
 //! \param[in] var Vector of variable to output
+//! \param[in] blockid Element block id the variable is associated to
 // *****************************************************************************
 {
   if (!var.empty()) {
@@ -529,7 +614,7 @@ ExodusIIMeshWriter::writeElemScalar( uint64_t it,
                         static_cast< int >( it ),
                         EX_ELEM_BLOCK,
                         varid,
-                        1,
+                        blockid,
                         static_cast< int64_t >( var.size() ),
                         var.data() ) == 0,
             "Failed to write elem scalar to ExodusII file: " + m_filename );
@@ -38,7 +38,9 @@ class ExodusIIMeshWriter {
     explicit ExodusIIMeshWriter( const std::string& filename,
                                  ExoWriter mode,
                                  int cpuwordsize = sizeof(double),
-                                 int iowordsize = sizeof(double) );
+                                 int iowordsize = sizeof(double),
+                                 int compress = 0,
+                                 bool int64maps = false );
 
     //! Destructor
     ~ExodusIIMeshWriter() noexcept;
@@ -97,7 +99,8 @@ class ExodusIIMeshWriter {
     //!  Write elem scalar field to ExodusII file
     void writeElemScalar( uint64_t it,
                           int varid,
-                          const std::vector< tk::real >& var ) const;
+                          const std::vector< tk::real >& var,
+                          int blockid = 1 ) const;
 
     //! Write header without mesh, function overloading
     void writeHeader( const char* title, int64_t ndim, int64_t nnodes,
@@ -109,12 +112,25 @@ class ExodusIIMeshWriter {
                      const std::vector< tk::real >& y,
                      const std::vector< tk::real >& z ) const;
 
+    //! Write node number map to ExodusII file
+    void writeNodeMap( const std::vector< std::size_t >& gid ) const;
+
     //! Write element block to ExodusII file
     void writeElemBlock( int& elclass,
                          int64_t nnpe,
                          const std::string& eltype,
                          const std::vector< std::size_t >& inpoel ) const;
 
+    //! Write side sets and their face connectivity without mesh, function
+    //! overloading
+    void writeSidesets(
+      const std::map< int, std::vector< std::size_t > >& bface,
+      const std::map< int, std::vector< std::size_t > >& faceid ) const;
+
+    //! Write side sets and their node list without mesh, function overloading
+    void writeNodesets(
+      const std::map< int, std::vector< std::size_t > >& bnode ) const;
+
   private:
     //! Write ExodusII header
     void writeHeader( const UnsMesh& mesh ) const;
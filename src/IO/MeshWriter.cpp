@@ -13,10 +13,19 @@
 */
 // *****************************************************************************
 
+#include <unordered_map>
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
 #include "QuinoaConfig.hpp"
 #include "MeshWriter.hpp"
 #include "Reorder.hpp"
 #include "ExodusIIMeshWriter.hpp"
+#include "ContainerUtil.hpp"
 
 #ifdef HAS_ROOT
   #include "RootMeshWriter.hpp"
@@ -26,11 +35,35 @@ using tk::MeshWriter;
 
 MeshWriter::MeshWriter( ctr::FieldFileType filetype,
                         Centering bnd_centering,
-                        bool benchmark ) :
+                        bool benchmark,
+                        bool aggregate,
+                        int compress,
+                        const std::vector< tk::real >& errbound ) :
   m_filetype( filetype ),
   m_bndCentering( bnd_centering ),
   m_benchmark( benchmark ),
-  m_nchare( 0 )
+  m_aggregate( aggregate && filetype == ctr::FieldFileType::EXODUSII ),
+  m_compress( compress ),
+  m_errbound( errbound ),
+  m_rawbytes( 0 ),
+  m_written(),
+  m_bounded(),
+  m_nchare( 0 ),
+  m_nepoch( 0 ),
+  m_chunk(),
+  m_cb(),
+  m_nexpect( -1 ),
+  m_moved( false ),
+  m_meshoutput( false ),
+  m_fieldoutput( false ),
+  m_itr( 0 ),
+  m_itf( 0 ),
+  m_time( 0.0 ),
+  m_basefilename(),
+  m_elemfieldnames(),
+  m_nodefieldnames(),
+  m_nodesurfnames(),
+  m_outsets()
 // *****************************************************************************
 //  Constructor: set some defaults that stay constant at all times
 //! \param[in] filetype Output file format type
@@ -40,6 +73,12 @@ MeshWriter::MeshWriter( ctr::FieldFileType filetype,
 //! \param[in] benchmark True of benchmark mode. No field output happens in
 //!   benchmark mode. This (and associated if tests) are here so client code
 //!   does not have to deal with this.
+//! \param[in] aggregate True if the mesh chunks and fields of all chares on a
+//!   compute node are to be written into a single file. Only used with
+//!   ExodusII output.
+//! \param[in] compress Lossless compression level of ExodusII output
+//! \param[in] errbound Absolute error bounds for lossy output of element and
+//!   node field variables in the order they are written
 // *****************************************************************************
 {
 }
@@ -65,6 +104,7 @@ MeshWriter::write(
   const std::string& basefilename,
   const std::vector< std::size_t >& inpoel,
   const UnsMesh::Coords& coord,
+  const std::vector< std::size_t >& gid,
   const std::map< int, std::vector< std::size_t > >& bface,
   const std::map< int, std::vector< std::size_t > >& bnode,
   const std::vector< std::size_t >& triinpoel,
@@ -89,6 +129,8 @@ MeshWriter::write(
 //! \param[in] inpoel Mesh connectivity for the mesh chunk to be written with
 //!   local ids
 //! \param[in] coord Node coordinates of the mesh chunk to be written
+//! \param[in] gid Global node ids of the mesh chunk indexed by local node ids,
+//!   used to merge chunks in aggregated output mode
 //! \param[in] bface Map of boundary-face lists mapped to corresponding side set
 //!   ids for this mesh chunk
 //! \param[in] bnode Map of boundary-node lists mapped to corresponding side set
@@ -104,8 +146,40 @@ MeshWriter::write(
 //! \param[in] outsets Unique set of surface side set ids along which to save
 //!   solution field variables
 //! \param[in] c Function to continue with after the write
+//! \details In aggregated output mode the data is only buffered here and the
+//!   callback is held until all chares writing to this compute node have
+//!   arrived, see nwrite().
 // *****************************************************************************
 {
+  if (m_aggregate && !m_benchmark) {
+
+    Assert( m_chunk.find(chareid) == end(m_chunk),
+            "Chare " + std::to_string(chareid) + " already buffered output" );
+
+    // Store data common to all chunks of this output step
+    m_meshoutput = meshoutput;
+    m_fieldoutput = fieldoutput;
+    m_itr = itr;
+    m_itf = itf;
+    m_time = time;
+    m_basefilename = basefilename;
+    m_elemfieldnames = elemfieldnames;
+    m_nodefieldnames = nodefieldnames;
+    m_nodesurfnames = nodesurfnames;
+    m_outsets = outsets;
+
+    // Buffer mesh chunk and field data of this chare
+    m_chunk[ chareid ] = Chunk{ inpoel, coord, gid, bface, bnode, triinpoel,
+                                elemfields, nodefields, nodesurfs };
+    m_cb.push_back( c );
+
+    // Write if all chares writing to this compute node have arrived
+    if (m_nexpect >= 0 && m_chunk.size() == static_cast<std::size_t>(m_nexpect))
+      writeAggregated();
+
+    return;
+  }
+
   if (!m_benchmark) {
 
     // Generate filenames for volume and surface field output
@@ -124,7 +198,9 @@ MeshWriter::write(
       if (m_filetype == ctr::FieldFileType::EXODUSII) {
 
         // Write volume mesh and field names
-        ExodusIIMeshWriter ev( vf, ExoWriter::CREATE );
+        ExodusIIMeshWriter ev( vf, ExoWriter::CREATE, sizeof(double),
+                               sizeof(double), m_compress );
+        countMesh( vf, coord[0].size(), inpoel.size() );
         // Write chare mesh (do not write side sets in parallel)
         if (m_nchare == 1) {
 
@@ -144,7 +220,8 @@ MeshWriter::write(
         // Write surface meshes and surface variable field names
         for (auto s : outsets) {
           auto sf = filename( basefilename, itr, chareid, s );
-          ExodusIIMeshWriter es( sf, ExoWriter::CREATE );
+          ExodusIIMeshWriter es( sf, ExoWriter::CREATE, sizeof(double),
+                                 sizeof(double), m_compress );
           auto b = bface.find(s);
           if (b == end(bface)) {
             // If a side set does not exist on a chare, write out a
@@ -179,6 +256,7 @@ MeshWriter::write(
           }
           es.writeMesh< 3 >( inp, scoord );
           es.writeNodeVarNames( nodesurfnames );
+          countMesh( sf, nnode, inp.size() );
         }
 
       }
@@ -201,11 +279,14 @@ MeshWriter::write(
         ExodusIIMeshWriter ev( vf, ExoWriter::OPEN );
         ev.writeTimeStamp( itf, time );
         // Write volume element variable fields
+        std::size_t b = 0;      // error bound index
         int varid = 0;
-        for (const auto& v : elemfields) ev.writeElemScalar( itf, ++varid, v );
+        for (const auto& v : elemfields)
+          ev.writeElemScalar( itf, ++varid, bounded( v, b++ ) );
         // Write volume node variable fields
         varid = 0;
-        for (const auto& v : nodefields) ev.writeNodeScalar( itf, ++varid, v );
+        for (const auto& v : nodefields)
+          ev.writeNodeScalar( itf, ++varid, bounded( v, b++ ) );
 
         // Write surface node variable fields
         std::size_t j = 0;
@@ -223,8 +304,10 @@ MeshWriter::write(
             for (int i=1; i<=nvar; ++i) es.writeNodeScalar( itf, i, {0,0,0} );
             continue;
           }
-          for (int i=1; i<=nvar; ++i)
+          for (int i=1; i<=nvar; ++i) {
+            m_rawbytes += nodesurfs[j].size() * sizeof(tk::real);
             es.writeNodeScalar( itf, i, nodesurfs[j++] );
+          }
         }
 
       }
@@ -235,6 +318,436 @@ MeshWriter::write(
   c.send();
 }
 
+std::vector< std::size_t >
+MeshWriter::nodecount( bool moved )
+// *****************************************************************************
+//  Generate contribution to the reduction counting the chares that write to
+//  each compute node in aggregated output mode
+//! \param[in] moved True if the contributing chare has migrated to a
+//!   different compute node since its previous output
+//! \return Vector to contribute with sum_ulong: 1 at the index of the compute
+//!   node the caller resides on and 1 as the last entry if moved
+// *****************************************************************************
+{
+  auto nn = static_cast< std::size_t >( CkNumNodes() );
+  std::vector< std::size_t > n( nn+1, 0 );
+  n[ static_cast< std::size_t >( CkMyNode() ) ] = 1;
+  n.back() = moved ? 1 : 0;
+  return n;
+}
+
+void
+MeshWriter::nwrite( std::size_t* n, [[maybe_unused]] int m )
+// *****************************************************************************
+// Reduction target: number of chares writing to each compute node in
+// aggregated output mode
+//! \param[in] n Number of chares writing to each compute node, followed by the
+//!   number of chares that migrated to a different compute node since their
+//!   previous output
+//! \param[in] m Size of array n
+//! \details Only the first PE of each compute node receives data to write, all
+//!   other PEs ignore this broadcast. If any chare changed compute node, the
+//!   set of mesh chunks in the aggregated files differs from the previous
+//!   output, so a new file series is started with the mesh written again.
+// *****************************************************************************
+{
+  if (CkMyPe() != CkNodeFirst( CkMyNode() )) return;
+
+  Assert( m == CkNumNodes()+1, "Size mismatch" );
+
+  if (n[ CkNumNodes() ] > 0) {
+    ++m_nepoch;
+    m_moved = true;
+  }
+
+  m_nexpect = static_cast< long >( n[ CkMyNode() ] );
+
+  // Nothing to write if no chares reside on this compute node
+  if (m_nexpect == 0) {
+    m_nexpect = -1;
+    return;
+  }
+
+  if (m_chunk.size() == static_cast< std::size_t >( m_nexpect ))
+    writeAggregated();
+}
+
+std::tuple< std::vector< std::size_t >,
+            tk::UnsMesh::Coords,
+            std::vector< std::vector< std::size_t > > >
+MeshWriter::surface( int setid,
+                     const std::vector< std::vector< std::size_t > >& map,
+                     const UnsMesh::Coords& coord ) const
+// *****************************************************************************
+//  Merge surface of all buffered chunks along a side set
+//! \param[in] setid Side set id
+//! \param[in] map Chunk-local to compute-node-local node id map for each
+//!   buffered chunk in the order of m_chunk
+//! \param[in] coord Node coordinates of the merged volume mesh
+//! \return Surface triangle connectivity with surface-local ids, surface node
+//!   coordinates, and for each chunk a list of surface-local node ids
+//!   corresponding to the surface nodes of the chunk in the order they appear
+//!   in the chunk's surface field data (empty if the chunk has no faces on the
+//!   side set)
+// *****************************************************************************
+{
+  // Collect chunk surface nodes in compute-node-local ids
+  std::vector< std::size_t > nodes;
+  std::vector< std::vector< std::size_t > > chunknodes;
+  std::size_t c = 0;
+  for (const auto& [ chareid, ch ] : m_chunk) {
+    chunknodes.emplace_back();
+    auto b = ch.bface.find( setid );
+    if (b != end(ch.bface)) {
+      std::vector< std::size_t > cn;
+      for (auto f : b->second)
+        for (std::size_t k=0; k<3; ++k)
+          cn.push_back( map[c][ ch.triinpoel[f*3+k] ] );
+      nodes.insert( end(nodes), begin(cn), end(cn) );
+      chunknodes.back() = std::move( cn );
+    }
+    ++c;
+  }
+
+  auto [inp,gid,lid] = tk::global2local( nodes );
+
+  UnsMesh::Coords scoord;
+  for (std::size_t d=0; d<3; ++d) {
+    scoord[d].resize( gid.size() );
+    for (std::size_t i=0; i<gid.size(); ++i) scoord[d][i] = coord[d][gid[i]];
+  }
+
+  // Convert chunk surface nodes to surface-local ids in the order the chunk
+  // stores its surface field data: sorted unique chunk-local ids
+  c = 0;
+  for (const auto& [ chareid, ch ] : m_chunk) {
+    auto& cn = chunknodes[c];
+    if (!cn.empty()) {
+      auto b = ch.bface.find( setid );
+      std::vector< std::size_t > local;
+      for (auto f : b->second)
+        for (std::size_t k=0; k<3; ++k) local.push_back( ch.triinpoel[f*3+k] );
+      tk::unique( local );
+      cn.clear();
+      for (auto l : local) cn.push_back( tk::cref_find( lid, map[c][l] ) );
+    }
+    ++c;
+  }
+
+  return { inp, scoord, chunknodes };
+}
+
+void
+MeshWriter::writeAggregated()
+// *****************************************************************************
+//  Write chunks of all chares on this compute node into a single file
+//! \details Chunks are merged by global node ids into a mesh with
+//!   compute-node-local ids, whose elements are written as one element block
+//!   per chare, so element fields can be written per block without
+//!   reordering. The global node ids of the merged nodes are written as the
+//!   node number map. Node fields are scattered into the merged numbering;
+//!   nodes shared by chunks receive the value of their owner chunk, the chunk
+//!   of the lowest chare id containing the node, so that the value written
+//!   does not depend on the order the chunks are merged in. Side sets of all
+//!   chunks are merged and written to the same file, as faces (written as a
+//!   block of triangles after the tetrahedra) with element-centered boundary
+//!   data and as node lists with node-centered boundary data.
+// *****************************************************************************
+{
+  auto nodeid = CkMyNode();
+  auto itr = m_itr + m_nepoch;
+
+  // Generate chunk-local to compute-node-local node id maps, global node ids
+  // and owner chunks of merged nodes (chunks are ordered by chare id, so the
+  // first chunk containing a node has the lowest chare id)
+  std::unordered_map< std::size_t, std::size_t > lid;
+  std::vector< std::vector< std::size_t > > map;
+  std::vector< std::size_t > gid, own;
+  std::size_t c = 0;
+  for (const auto& [ chareid, ch ] : m_chunk) {
+    auto npoin = ch.coord[0].size();
+    Assert( ch.gid.size() >= npoin, "Global node ids missing for chunk" );
+    map.emplace_back( npoin );
+    auto& m = map.back();
+    for (std::size_t i=0; i<npoin; ++i) {
+      auto l = lid.emplace( ch.gid[i], lid.size() );
+      if (l.second) {
+        gid.push_back( ch.gid[i] );
+        own.push_back( c );
+      }
+      m[i] = l.first->second;
+    }
+    ++c;
+  }
+
+  auto nnode = lid.size();
+  tk::destroy( lid );
+
+  // Assemble merged node coordinates
+  UnsMesh::Coords coord;
+  for (auto& x : coord) x.resize( nnode );
+  c = 0;
+  for (const auto& [ chareid, ch ] : m_chunk) {
+    for (std::size_t d=0; d<3; ++d)
+      for (std::size_t i=0; i<ch.coord[d].size(); ++i)
+        coord[d][ map[c][i] ] = ch.coord[d][i];
+    ++c;
+  }
+
+  auto vf = nodefilename( m_basefilename, itr, nodeid );
+
+  if (m_meshoutput || m_moved) {
+
+    // Write merged volume mesh with one element block per chare, with
+    // 64-bit node number map if global node ids, e.g., hashed ids of nodes
+    // added by mesh refinement, do not fit into 32 bits
+    auto int64maps = std::any_of( begin(gid), end(gid), []( std::size_t g ){
+      return g >= static_cast< std::size_t >( std::numeric_limits<int>::max() );
+    } );
+    ExodusIIMeshWriter ev( vf, ExoWriter::CREATE, sizeof(double),
+                           sizeof(double), m_compress, int64maps );
+    std::size_t nelem = 0, nblk = 0;
+    for (const auto& [ chareid, ch ] : m_chunk) {
+      nelem += ch.inpoel.size()/4;
+      if (!ch.inpoel.empty()) ++nblk;
+    }
+
+    // Merge side sets of all chunks: with element-centered boundary data, the
+    // side set faces get file-internal ids following the tetrahedra, see also
+    // ExodusIIMeshWriter::writeMesh(), and with node-centered boundary data,
+    // the side set nodes get compute-node-local ids
+    std::map< int, std::vector< std::size_t > > bface, faceid, bnode;
+    std::vector< std::size_t > triinpoel;
+    c = 0;
+    for (const auto& [ chareid, ch ] : m_chunk) {
+      if (m_bndCentering == Centering::ELEM) {
+        for (const auto& [ s, faces ] : ch.bface) {
+          auto& b = bface[s];
+          for (auto f : faces) {
+            b.push_back( nelem + triinpoel.size()/3 );
+            for (std::size_t k=0; k<3; ++k)
+              triinpoel.push_back( map[c][ ch.triinpoel[f*3+k] ] );
+          }
+        }
+      } else if (m_bndCentering == Centering::NODE) {
+        for (const auto& [ s, nodes ] : ch.bnode) {
+          auto& b = bnode[s];
+          for (auto n : nodes) b.push_back( map[c][n] );
+        }
+      } else Throw( "Centering not handled for writing mesh" );
+      ++c;
+    }
+    // Nodes shared by chunks appear in the node lists of multiple chunks
+    for (auto& [ s, b ] : bnode) tk::unique( b );
+    // Use triangles as face elements for side sets, see writeMesh()
+    for (const auto& [ s, b ] : bface) faceid[s].resize( b.size(), 0 );
+
+    ev.writeHeader( "Written by Quinoa", 3, static_cast< int64_t >( nnode ),
+                    static_cast< int64_t >( nelem + triinpoel.size()/3 ),
+                    static_cast< int64_t >( nblk + (triinpoel.empty()?0:1) ),
+                    static_cast< int64_t >( bnode.size() ),
+                    static_cast< int64_t >( bface.size() ) );
+    ev.writeNodes( coord[0], coord[1], coord[2] );
+    ev.writeNodeMap( gid );
+    countMesh( vf, nnode, nelem*4 + triinpoel.size() );
+    int elclass = 0;
+    c = 0;
+    for (const auto& [ chareid, ch ] : m_chunk) {
+      auto inpoel = ch.inpoel;
+      for (auto& p : inpoel) p = map[c][p];
+      ev.writeElemBlock( elclass, 4, "TETRAHEDRA", inpoel );
+      ++c;
+    }
+    ev.writeElemBlock( elclass, 3, "TRIANGLES", triinpoel );
+    ev.writeSidesets( bface, faceid );
+    ev.writeNodesets( bnode );
+    ev.writeElemVarNames( m_elemfieldnames );
+    ev.writeNodeVarNames( m_nodefieldnames );
+
+    // Write merged surface meshes and surface variable field names
+    for (auto s : m_outsets) {
+      auto sf = nodefilename( m_basefilename, itr, nodeid, s );
+      ExodusIIMeshWriter es( sf, ExoWriter::CREATE, sizeof(double),
+                             sizeof(double), m_compress );
+      auto [ inp, scoord, chunknodes ] = surface( s, map, coord );
+      if (inp.empty()) {
+        // See comment on empty side sets in write()
+        es.writeMesh< 3 >( std::vector< std::size_t >{1,2,3},
+          UnsMesh::Coords{{ {{0,0,0}}, {{0,0,0}}, {{0,0,0}} }} );
+      } else {
+        es.writeMesh< 3 >( inp, scoord );
+        countMesh( sf, scoord[0].size(), inp.size() );
+      }
+      es.writeNodeVarNames( m_nodesurfnames );
+    }
+
+  }
+
+  if (m_fieldoutput) {
+
+    ExodusIIMeshWriter ev( vf, ExoWriter::OPEN );
+    ev.writeTimeStamp( m_itf, m_time );
+
+    // Write element variable fields block by block (empty chunks have no
+    // block, see ExodusIIMeshWriter::writeElemBlock())
+    int blockid = 0;
+    for (const auto& [ chareid, ch ] : m_chunk) {
+      if (ch.inpoel.empty()) continue;
+      ++blockid;
+      std::size_t b = 0;      // error bound index
+      int varid = 0;
+      for (const auto& v : ch.elemfields)
+        ev.writeElemScalar( m_itf, ++varid, bounded( v, b++ ), blockid );
+    }
+
+    // Scatter node variable fields to merged numbering and write
+    for (std::size_t v=0; v<m_nodefieldnames.size(); ++v) {
+      std::vector< tk::real > f( nnode, 0.0 );
+      c = 0;
+      for (const auto& [ chareid, ch ] : m_chunk) {
+        Assert( v < ch.nodefields.size(), "Node field missing for chunk" );
+        const auto& u = ch.nodefields[v];
+        for (std::size_t i=0; i<u.size(); ++i)
+          if (own[ map[c][i] ] == c) f[ map[c][i] ] = u[i];
+        ++c;
+      }
+      ev.writeNodeScalar( m_itf, static_cast< int >( v+1 ),
+                          bounded( f, m_elemfieldnames.size() + v ) );
+    }
+
+    // Write surface node variable fields
+    auto nvar = m_nodesurfnames.size();
+    std::vector< std::size_t > offset( m_chunk.size(), 0 );
+    for (auto s : m_outsets) {
+      auto sf = nodefilename( m_basefilename, itr, nodeid, s );
+      ExodusIIMeshWriter es( sf, ExoWriter::OPEN );
+      es.writeTimeStamp( m_itf, m_time );
+      auto [ inp, scoord, chunknodes ] = surface( s, map, coord );
+      if (inp.empty()) {
+        for (std::size_t i=1; i<=nvar; ++i)
+          es.writeNodeScalar( m_itf, static_cast< int >( i ), {0,0,0} );
+        continue;
+      }
+      auto nsnode = scoord[0].size();
+      // Owner chunks of surface nodes, see owner chunks of nodes above
+      std::vector< std::size_t > sown( nsnode, m_chunk.size() );
+      for (std::size_t k=0; k<chunknodes.size(); ++k)
+        for (auto n : chunknodes[k])
+          if (sown[n] == m_chunk.size()) sown[n] = k;
+      std::vector< std::vector< tk::real > > f( nvar,
+        std::vector< tk::real >( nsnode, 0.0 ) );
+      c = 0;
+      for (const auto& [ chareid, ch ] : m_chunk) {
+        const auto& cn = chunknodes[c];
+        if (!cn.empty()) {
+          for (std::size_t i=0; i<nvar; ++i) {
+            const auto& u = ch.nodesurfs[ offset[c]++ ];
+            Assert( u.size() == cn.size(), "Size mismatch" );
+            for (std::size_t k=0; k<cn.size(); ++k)
+              if (sown[ cn[k] ] == c) f[i][ cn[k] ] = u[k];
+          }
+        }
+        ++c;
+      }
+      for (std::size_t i=0; i<nvar; ++i) {
+        m_rawbytes += f[i].size() * sizeof(tk::real);
+        es.writeNodeScalar( m_itf, static_cast< int >( i+1 ), f[i] );
+      }
+    }
+
+  }
+
+  // Prepare for next output and continue with all chares on this node
+  m_chunk.clear();
+  m_nexpect = -1;
+  m_moved = false;
+  auto cb = std::move( m_cb );
+  m_cb.clear();
+  for (auto& cbk : cb) cbk.send();
+}
+
+const std::vector< tk::real >&
+MeshWriter::bounded( const std::vector< tk::real >& v, std::size_t varid )
+// *****************************************************************************
+//  Apply error bound of field variable for lossy output
+//! \param[in] v Field variable to be written
+//! \param[in] varid Index of the field variable in the order of the output
+//!   variables, element variables first, node variables next
+//! \return Field variable v if no error bound is configured for it, otherwise
+//!   a copy (valid until the next call) whose values have their trailing
+//!   mantissa bits zeroed so that the absolute error does not exceed the bound
+//! \details Zeroing the bits below the bound does not reduce the size of the
+//!   data, but makes the subsequent lossless (deflate) compression of the
+//!   output much more effective.
+// *****************************************************************************
+{
+  static_assert( sizeof(tk::real) == sizeof(std::uint64_t),
+                 "Lossy output requires 64-bit floating-point numbers" );
+
+  m_rawbytes += v.size() * sizeof(tk::real);
+
+  if (m_errbound.empty()) return v;
+  auto bound = m_errbound[ std::min( varid, m_errbound.size()-1 ) ];
+  if (bound <= 0.0) return v;
+
+  // 2^(eb-1) <= bound
+  int eb;
+  std::frexp( bound, &eb );
+
+  m_bounded = v;
+  for (auto& x : m_bounded) {
+    if (x == 0.0 || !std::isfinite(x)) continue;
+    // 2^(ex-1) <= |x| < 2^ex, the last mantissa bit is worth 2^(ex-53)
+    int ex;
+    std::frexp( x, &ex );
+    // Number of trailing bits whose total worth remains below 2^(eb-1)
+    auto d = eb - ex + 52;
+    if (d <= 0) continue;
+    if (d > 52) { x = 0.0; continue; }
+    std::uint64_t bits;
+    std::memcpy( &bits, &x, sizeof(bits) );
+    bits &= ~((std::uint64_t(1) << d) - 1);
+    std::memcpy( &x, &bits, sizeof(bits) );
+  }
+
+  return m_bounded;
+}
+
+void
+MeshWriter::countMesh( const std::string& filename,
+                       std::size_t npoin,
+                       std::size_t nconn )
+// *****************************************************************************
+//  Account for mesh data written to file
+//! \param[in] filename Name of file the mesh is written to
+//! \param[in] npoin Number of mesh nodes written
+//! \param[in] nconn Number of connectivity entries written
+// *****************************************************************************
+{
+  m_written.insert( filename );
+  m_rawbytes += 3 * npoin * sizeof(tk::real) + nconn * sizeof(int);
+}
+
+void
+MeshWriter::stats( CkCallback c )
+// *****************************************************************************
+//  Contribute output data size statistics
+//! \param[in] c Function to send the sum (across all PEs) of the estimated
+//!   uncompressed size and the size on disk of all mesh output files to
+//! \details The uncompressed size is estimated by the size of the node
+//!   coordinates, element connectivity, and field data written.
+// *****************************************************************************
+{
+  std::size_t disk = 0;
+  for (const auto& f : m_written) {
+    std::ifstream is( f, std::ios::binary | std::ios::ate );
+    if (is.good()) disk += static_cast< std::size_t >( is.tellg() );
+  }
+
+  std::vector< std::size_t > s{ m_rawbytes, disk };
+  contribute( s, CkReduction::sum_ulong, c );
+}
+
 std::string
 MeshWriter::filename( const std::string& basefilename,
                       uint64_t itr,
@@ -277,4 +790,28 @@ MeshWriter::filename( const std::string& basefilename,
          ;
 }
 
+std::string
+MeshWriter::nodefilename( const std::string& basefilename,
+                          uint64_t itr,
+                          int nodeid,
+                          int surfid ) const
+// *****************************************************************************
+//  Compute filename for aggregated output of a compute node
+//! \param[in] basefilename String use as the base filename.
+//! \param[in] itr Iteration count since a new mesh or a new assignment of
+//!   chares to compute nodes
+//! \param[in] nodeid The compute node id whose chares' data is written
+//! \param[in] surfid Surface ID if computing a surface filename
+//! \details Same convention as for the per-chare filename, but with {NP}
+//!   being the number of compute nodes and {RANK} the compute node id.
+//! \return Filename computed
+// *****************************************************************************
+{
+  return basefilename + (surfid ? "-surf." + std::to_string(surfid) : "")
+         + ".e-s"
+         + '.' + std::to_string( itr )          // iteration count with new mesh
+         + '.' + std::to_string( CkNumNodes() ) // total number of nodes
+         + '.' + std::to_string( nodeid );      // new file per compute node
+}
+
 #include "NoWarning/meshwriter.def.h"
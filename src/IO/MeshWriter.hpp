@@ -19,6 +19,7 @@
 #include <string>
 #include <tuple>
 #include <map>
+#include <set>
 
 #include "Types.hpp"
 #include "Options/FieldFile.hpp"
@@ -36,7 +37,10 @@ class MeshWriter : public CBase_MeshWriter {
     //! Constructor: set some defaults that stay constant at all times
     MeshWriter( ctr::FieldFileType filetype,
                 Centering bnd_centering,
-                bool benchmark );
+                bool benchmark,
+                bool aggregate,
+                int compress,
+                const std::vector< tk::real >& errbound );
 
     #if defined(__clang__)
       #pragma clang diagnostic push
@@ -61,6 +65,7 @@ class MeshWriter : public CBase_MeshWriter {
                 const std::string& basefilename,
                 const std::vector< std::size_t >& inpoel,
                 const UnsMesh::Coords& coord,
+                const std::vector< std::size_t >& gid,
                 const std::map< int, std::vector< std::size_t > >& bface,
                 const std::map< int, std::vector< std::size_t > >& bnode,
                 const std::vector< std::size_t >& triinpoel,
@@ -73,6 +78,17 @@ class MeshWriter : public CBase_MeshWriter {
                 const std::set< int >& outsets,
                 CkCallback c );
 
+    //! \brief Reduction target: number of chares writing to each compute node
+    //!   in aggregated output mode
+    void nwrite( std::size_t* n, int m );
+
+    //! \brief Generate contribution to the reduction counting the chares that
+    //!   write to each compute node in aggregated output mode
+    static std::vector< std::size_t > nodecount( bool moved );
+
+    //! Contribute output data size statistics
+    void stats( CkCallback c );
+
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -83,7 +99,15 @@ class MeshWriter : public CBase_MeshWriter {
       p | m_filetype;
       p | m_bndCentering;
       p | m_benchmark;
+      p | m_aggregate;
+      p | m_compress;
+      p | m_errbound;
+      p | m_rawbytes;
+      p | m_written;
       p | m_nchare;
+      p | m_nepoch;
+      p | m_nexpect;
+      p | m_moved;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -98,14 +122,97 @@ class MeshWriter : public CBase_MeshWriter {
     Centering m_bndCentering;
     //! True if benchmark mode
     bool m_benchmark;
+    //! True if chunks of all chares on a compute node are written to one file
+    bool m_aggregate;
+    //! Lossless compression level of ExodusII output (0: uncompressed)
+    int m_compress;
+    //! Absolute error bounds for lossy output of field variables
+    std::vector< tk::real > m_errbound;
+    //! Estimated uncompressed size of the data written by this PE in bytes
+    std::size_t m_rawbytes;
+    //! Names of files written by this PE
+    std::set< std::string > m_written;
+    //! Buffer holding a field variable with trailing bits zeroed
+    std::vector< tk::real > m_bounded;
     //! Total number chares across the whole problem
     int m_nchare;
+    //! \brief Number of times the set of chares on any compute node changed
+    //!   in aggregated output mode, used to start a new file series
+    uint64_t m_nepoch;
+
+    //! Mesh chunk and field data of a single chare buffered for aggregation
+    struct Chunk {
+      std::vector< std::size_t > inpoel;
+      UnsMesh::Coords coord;
+      std::vector< std::size_t > gid;
+      std::map< int, std::vector< std::size_t > > bface;
+      std::map< int, std::vector< std::size_t > > bnode;
+      std::vector< std::size_t > triinpoel;
+      std::vector< std::vector< tk::real > > elemfields;
+      std::vector< std::vector< tk::real > > nodefields;
+      std::vector< std::vector< tk::real > > nodesurfs;
+    };
+
+    //! Chunks received for the current aggregated output step by chare id
+    std::map< int, Chunk > m_chunk;
+    //! Callbacks of chares whose chunks have been buffered
+    std::vector< CkCallback > m_cb;
+    //! Number of chares that will write to this compute node (-1: unknown)
+    long m_nexpect;
+    //! True if any chare changed compute node since the previous output
+    bool m_moved;
+    //! True if the mesh is to be written at the current aggregated output
+    bool m_meshoutput;
+    //! True if fields are to be written at the current aggregated output
+    bool m_fieldoutput;
+    //! Iteration count since a new mesh for the current aggregated output
+    uint64_t m_itr;
+    //! Field output iteration count for the current aggregated output
+    uint64_t m_itf;
+    //! Physical time of the current aggregated output
+    tk::real m_time;
+    //! Base filename of the current aggregated output
+    std::string m_basefilename;
+    //! Names of element fields of the current aggregated output
+    std::vector< std::string > m_elemfieldnames;
+    //! Names of node fields of the current aggregated output
+    std::vector< std::string > m_nodefieldnames;
+    //! Names of node surface fields of the current aggregated output
+    std::vector< std::string > m_nodesurfnames;
+    //! Side set ids along which to output surface fields
+    std::set< int > m_outsets;
+
+    //! Write chunks of all chares on this compute node into a single file
+    void writeAggregated();
+
+    //! Apply error bound of field variable for lossy output
+    const std::vector< tk::real >& bounded( const std::vector< tk::real >& v,
+                                            std::size_t varid );
+
+    //! Account for mesh data written to file
+    void countMesh( const std::string& filename,
+                    std::size_t npoin,
+                    std::size_t nconn );
+
+    //! Merge surface of all buffered chunks along a side set
+    std::tuple< std::vector< std::size_t >,
+                UnsMesh::Coords,
+                std::vector< std::vector< std::size_t > > >
+    surface( int setid,
+             const std::vector< std::vector< std::size_t > >& map,
+             const UnsMesh::Coords& coord ) const;
 
     //! Compute filename
     std::string filename( const std::string& basefilename,
                           uint64_t itr,
                           int chareid,
                           int surfid = 0 ) const;
+
+    //! Compute filename for aggregated output of a compute node
+    std::string nodefilename( const std::string& basefilename,
+                              uint64_t itr,
+                              int nodeid,
+                              int surfid = 0 ) const;
 };
 
 } // tk::
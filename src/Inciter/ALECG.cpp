@@ -15,6 +15,8 @@
 */
 // *****************************************************************************
 
+#include <algorithm>
+
 #include "QuinoaConfig.hpp"
 #include "ALECG.hpp"
 #include "Vector.hpp"
@@ -82,6 +84,9 @@ ALECG::ALECG( const CProxy_Discretization& disc,
   m_lhsc(),
   m_gradc(),
   m_rhsc(),
+  m_commbid(),
+  m_commlid(),
+  m_bidlid(),
   m_diag(),
   m_bnorm(),
   m_bnormc(),
@@ -124,6 +129,9 @@ ALECG::ALECG( const CProxy_Discretization& disc,
 
   }
 
+  // Generate index lists for communication on chare-boundaries
+  commIndex();
+
   // Activate SDAG wait for initially computing the left-hand side and normals
   thisProxy[ thisIndex ].wait4lhs();
 
@@ -665,6 +673,42 @@ ALECG::advance( tk::real newdt )
   grad();
 }
 
+void
+ALECG::commIndex()
+// *****************************************************************************
+//  Generate index lists for communication on chare-boundaries
+//! \details For each fellow chare we share nodes with, the chare-boundary and
+//!   local node IDs of the shared nodes are stored in increasing global node
+//!   ID order. Since both sides of a chare-boundary agree on this order, the
+//!   gradient and rhs messages only carry the values, and sending and
+//!   receiving need no hash-map lookups. The receive buffers are flat arrays
+//!   indexed by chare-boundary node id.
+// *****************************************************************************
+{
+  auto d = Disc();
+  const auto& bid = d->Bid();
+  const auto& lid = d->Lid();
+
+  m_commbid.clear();
+  m_commlid.clear();
+  for (const auto& [c,n] : d->NodeCommMap()) {
+    std::vector< std::size_t > gid( begin(n), end(n) );
+    std::sort( begin(gid), end(gid) );
+    auto& b = m_commbid[c];
+    auto& l = m_commlid[c];
+    for (auto g : gid) {
+      b.push_back( tk::cref_find( bid, g ) );
+      l.push_back( tk::cref_find( lid, g ) );
+    }
+  }
+
+  m_bidlid.resize( bid.size() );
+  for (const auto& [g,b] : bid) m_bidlid[b] = tk::cref_find( lid, g );
+
+  m_gradc.clear();
+  m_rhsc.clear();
+}
+
 void
 ALECG::grad()
 // *****************************************************************************
@@ -681,23 +725,24 @@ ALECG::grad()
   if (d->NodeCommMap().empty())        // in serial we are done
     comgrad_complete();
   else // send gradients contributions to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > g( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) g[ j++ ] = m_grad[ tk::cref_find(d->Bid(),i) ];
-      thisProxy[c].comgrad( std::vector<std::size_t>(begin(n),end(n)), g );
+    for (const auto& [c,bid] : m_commbid) {
+      std::vector< tk::real > g;
+      g.reserve( bid.size() * m_grad.nprop() );
+      for (auto b : bid)
+        for (ncomp_t k=0; k<m_grad.nprop(); ++k) g.push_back( m_grad(b,k,0) );
+      thisProxy[c].comgrad( thisIndex, g );
     }
 
   owngrad_complete();
 }
 
 void
-ALECG::comgrad( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& G )
+ALECG::comgrad( int fromch, const std::vector< tk::real >& G )
 // *****************************************************************************
 //  Receive contributions to nodal gradients on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive grad contributions
-//! \param[in] G Partial contributions of gradients to chare-boundary nodes
+//! \param[in] fromch Sender chare ID
+//! \param[in] G Partial contributions of gradients to chare-boundary nodes,
+//!   all components node by node, in the order of m_commbid
 //! \details This function receives contributions to m_grad, which stores the
 //!   nodal gradients at mesh nodes. While m_grad stores own
 //!   contributions, m_gradc collects the neighbor chare contributions during
@@ -705,11 +750,13 @@ ALECG::comgrad( const std::vector< std::size_t >& gid,
 //!   are combined in rhs().
 // *****************************************************************************
 {
-  Assert( G.size() == gid.size(), "Size mismatch" );
+  const auto& bid = tk::cref_find( m_commbid, fromch );
+  auto np = m_grad.nprop();
+  Assert( G.size() == bid.size()*np, "Size mismatch" );
 
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i) m_gradc[ gid[i] ] += G[i];
+  if (m_gradc.empty()) m_gradc.resize( m_bidlid.size()*np, 0.0 );
+  for (std::size_t i=0; i<bid.size(); ++i)
+    for (ncomp_t c=0; c<np; ++c) m_gradc[ bid[i]*np+c ] += G[ i*np+c ];
 
   if (++m_ngrad == Disc()->NodeCommMap().size()) {
     m_ngrad = 0;
@@ -726,13 +773,12 @@ ALECG::rhs()
   auto d = Disc();
 
   // Combine own and communicated contributions to nodal gradients
-  for (const auto& [gid,g] : m_gradc) {
-    auto bid = tk::cref_find( d->Bid(), gid );
-    for (ncomp_t c=0; c<m_grad.nprop(); ++c) m_grad(bid,c,0) += g[c];
-  }
+  auto ng = m_grad.nprop();
+  for (std::size_t b=0; b<m_gradc.size()/ng; ++b)
+    for (ncomp_t c=0; c<ng; ++c) m_grad(b,c,0) += m_gradc[ b*ng+c ];
 
   // clear gradients receive buffer
-  tk::destroy(m_gradc);
+  std::fill( begin(m_gradc), end(m_gradc), 0.0 );
 
   // Compute own portion of right-hand side for all equations
   auto prev_rkcoef = m_stage == 0 ? 0.0 : rkcoef[m_stage-1];
@@ -749,23 +795,24 @@ ALECG::rhs()
   if (d->NodeCommMap().empty())        // in serial we are done
     comrhs_complete();
   else // send contributions of rhs to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > r( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) r[ j++ ] = m_rhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[c].comrhs( std::vector<std::size_t>(begin(n),end(n)), r );
+    for (const auto& [c,lid] : m_commlid) {
+      std::vector< tk::real > r;
+      r.reserve( lid.size() * m_rhs.nprop() );
+      for (auto l : lid)
+        for (ncomp_t k=0; k<m_rhs.nprop(); ++k) r.push_back( m_rhs(l,k,0) );
+      thisProxy[c].comrhs( thisIndex, r );
     }
 
   ownrhs_complete();
 }
 
 void
-ALECG::comrhs( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& R )
+ALECG::comrhs( int fromch, const std::vector< tk::real >& R )
 // *****************************************************************************
 //  Receive contributions to right-hand side vector on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive RHS contributions
-//! \param[in] R Partial contributions of RHS to chare-boundary nodes
+//! \param[in] fromch Sender chare ID
+//! \param[in] R Partial contributions of RHS to chare-boundary nodes, all
+//!   components node by node, in the order of m_commbid
 //! \details This function receives contributions to m_rhs, which stores the
 //!   right hand side vector at mesh nodes. While m_rhs stores own
 //!   contributions, m_rhsc collects the neighbor chare contributions during
@@ -773,11 +820,13 @@ ALECG::comrhs( const std::vector< std::size_t >& gid,
 //!   are combined in solve().
 // *****************************************************************************
 {
-  Assert( R.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
+  const auto& bid = tk::cref_find( m_commbid, fromch );
+  auto np = m_rhs.nprop();
+  Assert( R.size() == bid.size()*np, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i) m_rhsc[ gid[i] ] += R[i];
+  if (m_rhsc.empty()) m_rhsc.resize( m_bidlid.size()*np, 0.0 );
+  for (std::size_t i=0; i<bid.size(); ++i)
+    for (ncomp_t c=0; c<np; ++c) m_rhsc[ bid[i]*np+c ] += R[ i*np+c ];
 
   // When we have heard from all chares we communicate with, this chare is done
   if (++m_nrhs == Disc()->NodeCommMap().size()) {
@@ -797,13 +846,11 @@ ALECG::solve()
   auto d = Disc();
 
   // Combine own and communicated contributions to rhs
-  for (const auto& b : m_rhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(lid,c,0) += b.second[c];
-  }
+  for (std::size_t b=0; b<m_rhsc.size()/ncomp; ++b)
+    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(m_bidlid[b],c,0) += m_rhsc[b*ncomp+c];
 
   // clear receive buffer
-  tk::destroy(m_rhsc);  
+  std::fill( begin(m_rhsc), end(m_rhsc), 0.0 );
 
   // Set Dirichlet BCs for lhs and rhs
   for (const auto& [b,bc] : m_bcdir) {
@@ -914,6 +961,9 @@ ALECG::resizePostAMR(
   // Resize mesh data structures
   d->resizePostAMR( chunk, coord, nodeCommMap );
 
+  // Regenerate index lists for communication on chare-boundaries
+  commIndex();
+
   // Resize auxiliary solution vectors
   auto npoin = coord[0].size();
   auto nprop = m_u.nprop();
@@ -1065,13 +1115,12 @@ ALECG::evalLB( int nrestart )
   d->restarted( nrestart );
 
   const auto lbfreq = g_inputdeck.get< tag::cmd, tag::lbfreq >();
-  const auto nonblocking = g_inputdeck.get< tag::cmd, tag::nonblocking >();
 
   // Load balancing if user frequency is reached or after the second time-step
   if ( (d->It()) % lbfreq == 0 || d->It() == 2 ) {
 
-    AtSync();
-    if (nonblocking) next();
+    // Migrate only once no field output is in flight
+    d->flush( CkCallback( CkIndex_ALECG::startLB(), thisProxy[thisIndex] ) );
 
   } else {
 
@@ -1080,6 +1129,16 @@ ALECG::evalLB( int nrestart )
   }
 }
 
+void
+ALECG::startLB()
+// *****************************************************************************
+// Start load balancing
+// *****************************************************************************
+{
+  AtSync();
+  if (g_inputdeck.get< tag::cmd, tag::nonblocking >()) next();
+}
+
 void
 ALECG::evalRestart()
 // *****************************************************************************
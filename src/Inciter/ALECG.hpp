@@ -19,6 +19,12 @@
     The implementation uses the Charm++ runtime system and is fully
     asynchronous, overlapping computation and communication. The algorithm
     utilizes the structured dagger (SDAG) Charm++ functionality.
+
+    Each RK stage communicates across chare boundaries twice: first the nodal
+    gradients, see comgrad(), then the right-hand side, see comrhs(). The
+    second exchange depends on the first, since the rhs at a node requires
+    the gradients at its neighbor nodes. Combining the two into a single
+    exchange would require a two-layer node halo, which is not implemented.
 */
 // *****************************************************************************
 #ifndef ALECG_h
@@ -127,12 +133,10 @@ class ALECG : public CBase_ALECG {
                  const std::vector< std::vector< tk::real > >& L );
 
     //! Receive contributions to gradients on chare-boundaries
-    void comgrad( const std::vector< std::size_t >& gid,
-                  const std::vector< std::vector< tk::real > >& G );
+    void comgrad( int fromch, const std::vector< tk::real >& G );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R );
+    void comrhs( int fromch, const std::vector< tk::real >& R );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a );
@@ -165,6 +169,9 @@ class ALECG : public CBase_ALECG {
     // Evaluate whether to do load balancing
     void evalLB( int nrestart );
 
+    //! Start load balancing
+    void startLB();
+
     //! Continue to next time step
     void next();
 
@@ -196,6 +203,9 @@ class ALECG : public CBase_ALECG {
       p | m_lhsc;
       p | m_gradc;
       p | m_rhsc;
+      p | m_commbid;
+      p | m_commlid;
+      p | m_bidlid;
       p | m_diag;
       p | m_bnorm;
       p | m_bnormc;
@@ -267,12 +277,22 @@ class ALECG : public CBase_ALECG {
     //! \details Key: chare id, value: lhs for all scalar components per node
     std::unordered_map< std::size_t, std::vector< tk::real > > m_lhsc;
     //! Receive buffer for communication of the nodal gradients
-    //! \details Key: chare id, value: gradients for all scalar components per
-    //!   node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_gradc;
+    //! \details Gradients for all scalar components of a chare-boundary node
+    //!   stored contiguously, nodes indexed by Discretization::Bid()
+    std::vector< tk::real > m_gradc;
     //! Receive buffer for communication of the right hand side
-    //! \details Key: chare id, value: rhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rhsc;
+    //! \details Rhs for all scalar components of a chare-boundary node stored
+    //!   contiguously, nodes indexed by Discretization::Bid()
+    std::vector< tk::real > m_rhsc;
+    //! \brief Chare-boundary node ids (see Discretization::Bid()) of nodes
+    //!   shared with fellow chares, in increasing global node ID order,
+    //!   associated to fellow chare IDs
+    std::unordered_map< int, std::vector< std::size_t > > m_commbid;
+    //! \brief Local node IDs of nodes shared with fellow chares, in increasing
+    //!   global node ID order, associated to fellow chare IDs
+    std::unordered_map< int, std::vector< std::size_t > > m_commlid;
+    //! Local node IDs associated to chare-boundary node ids
+    std::vector< std::size_t > m_bidlid;
     //! Diagnostics object
     NodeDiagnostics m_diag;
     //! Face normals in boundary points
@@ -322,6 +342,9 @@ class ALECG : public CBase_ALECG {
     //! Combine own and communicated contributions to left hand side
     void lhsmerge();
 
+    //! Generate index lists for communication on chare-boundaries
+    void commIndex();
+
     //! Compute gradients
     void grad();
 
@@ -26,10 +26,13 @@
 #include "Inciter/InputDeck/InputDeck.hpp"
 #include "Refiner.hpp"
 #include "Limiter.hpp"
+#include "ShockIndicator.hpp"
 #include "PrefIndicator.hpp"
+#include "Reconstruction.hpp"
 #include "Reorder.hpp"
 #include "Vector.hpp"
 #include "Around.hpp"
+#include "Timer.hpp"
 
 namespace inciter {
 
@@ -41,6 +44,31 @@ extern std::vector< DGPDE > g_dgpde;
 static const std::array< std::array< tk::real, 3 >, 2 >
   rkcoef{{ {{ 0.0, 3.0/4.0, 1.0/3.0 }}, {{ 1.0, 1.0/4.0, 2.0/3.0 }} }};
 
+//! Reducer yielding the largest and the total predicted load across all PEs
+static CkReduction::reducerType LoadMerger;
+
+//! Predicted load summed over the DG chares on this PE, see DG::evalLB()
+CkpvStaticDeclare( tk::real, peload );
+//! Number of DG chares on this PE that have added to peload
+CkpvStaticDeclare( std::size_t, npeload );
+
+//! Charm++ custom reducer yielding the largest and the total predicted load
+//! \param[in] nmsg Number of messages in msgs
+//! \param[in] msgs Charm++ reduction message containing the largest and the
+//!   total load of a subset of PEs
+//! \return Aggregated Charm++ reduction message
+static CkReductionMsg*
+maxsumLoad( int nmsg, CkReductionMsg **msgs )
+{
+  std::array< tk::real, 2 > v{{ 0.0, 0.0 }};
+  for (int m=0; m<nmsg; ++m) {
+    auto w = static_cast< const tk::real* >( msgs[m]->getData() );
+    v[0] = std::max( v[0], w[0] );
+    v[1] += w[1];
+  }
+  return CkReductionMsg::buildNew( sizeof(v), v.data() );
+}
+
 } // inciter::
 
 using inciter::DG;
@@ -71,6 +99,7 @@ DG::DG( const CProxy_Discretization& disc,
   m_lhs( m_u.nunk(),
          g_inputdeck.get< tag::discr, tag::ndof >()*
          g_inputdeck.get< tag::component >().nprop() ),
+  m_lsop(),
   m_rhs( m_u.nunk(), m_lhs.nprop() ),
   m_nfac( m_fd.Inpofa().size()/3 ),
   m_nunk( m_u.nunk() ),
@@ -90,7 +119,12 @@ DG::DG( const CProxy_Discretization& disc,
   m_pc(),
   m_ndofc(),
   m_initial( 1 ),
-  m_expChBndFace()
+  m_expChBndFace(),
+  m_lbscale( 0.0 ),
+  m_lbtime( 0.0 ),
+  m_lbweight( 0.0 ),
+  m_lbnstage( 0 ),
+  m_lbdue( false )
 // *****************************************************************************
 //  Constructor
 //! \param[in] disc Discretization proxy
@@ -100,6 +134,10 @@ DG::DG( const CProxy_Discretization& disc,
 {
   usesAtSync = true;    // enable migration at AtSync
 
+  // With p-adaptive DG report predicted instead of measured load, see
+  // UserSetLBLoad()
+  if (g_inputdeck.get< tag::pref, tag::pref >()) usesAutoMeasure = false;
+
   // Enable SDAG wait for setting up chare boundary faces
   thisProxy[ thisIndex ].wait4fac();
 
@@ -931,24 +969,27 @@ DG::faceAdj()
     for([[maybe_unused]] const auto& i : n.second)
       Assert( i < m_fd.Esuel().size()/4, "Sender contains ghost tet id. " );
 
-  // Generate and store Esup data-structure in a map
+  // Generate and store Esup data-structure as a linked list
   auto esup = tk::genEsup(Disc()->Inpoel(), 4);
-  for (std::size_t p=0; p<Disc()->Gid().size(); ++p)
+  auto npoin = Disc()->Gid().size();
+  m_esup.first.assign( 1, 0 );
+  m_esup.second.assign( npoin+1, 0 );
+  for (std::size_t p=0; p<npoin; ++p)
   {
     for (auto e : tk::Around(esup, p))
     {
       // since inpoel has been augmented with the face-ghost cell previously,
       // genEsup() also contains cells which are not on this mesh-chunk. Hence
       // the following test.
-      if (e < m_fd.Esuel().size()/4) m_esup[p].push_back(e);
+      if (e < m_fd.Esuel().size()/4) m_esup.first.push_back(e);
     }
+    m_esup.second[p+1] = m_esup.first.size()-1;
   }
 
-  // Error checking on Esup map
-  for(const auto& p : m_esup)
-    for([[maybe_unused]] const auto& e : p.second)
-      Assert( e < m_fd.Esuel().size()/4, "Esup contains tet id greater than "
-      + std::to_string(m_fd.Esuel().size()/4-1) +" : "+ std::to_string(e) );
+  // Error checking on Esup
+  for([[maybe_unused]] const auto& e : m_esup.first)
+    Assert( e < m_fd.Esuel().size()/4, "Esup contains tet id greater than "
+    + std::to_string(m_fd.Esuel().size()/4-1) +" : "+ std::to_string(e) );
 
   contribute( CkCallback(CkReductionTarget(Transporter,startEsup),
     Disc()->Tr()) );
@@ -978,8 +1019,8 @@ DG::nodeNeighSetup()
       {
         auto pl = tk::cref_find(Disc()->Lid(), p);
         // fill in the esup for the chare-boundary
-        const auto& pesup = tk::cref_find(m_esup, pl);
-        bndEsup[p] = pesup;
+        tk::Around pesup( m_esup, pl );
+        bndEsup[p].assign( pesup.begin(), pesup.end() );
 
         // fill a map with the element ids from esup as keys and geoElem as
         // values, and another map containing these elements associated with
@@ -1061,16 +1102,25 @@ DG::adj()
 //    for problem setup.
 // *****************************************************************************
 {
-  for (auto& [p, elist] : m_esupc)
+  // Extend elements surrounding points with the node-ghost elements
+  std::vector< std::size_t > esup1( 1, 0 ), esup2( m_esup.second.size(), 0 );
+  esup1.reserve( m_esup.first.size() + tk::sumvalsize(m_esupc) );
+  for (std::size_t p=0; p+1<m_esup.second.size(); ++p)
   {
-    auto& pesup = tk::ref_find(m_esup, p);
-    for ([[maybe_unused]] auto e : elist)
+    for (auto e : tk::Around(m_esup,p)) esup1.push_back(e);
+    auto g = m_esupc.find(p);
+    if (g != end(m_esupc))
     {
-      Assert( e >= m_fd.Esuel().size()/4, "Non-ghost element received from "
-        "esup buffer." );
+      for ([[maybe_unused]] auto e : g->second)
+      {
+        Assert( e >= m_fd.Esuel().size()/4, "Non-ghost element received from "
+          "esup buffer." );
+      }
+      esup1.insert( end(esup1), begin(g->second), end(g->second) );
     }
-    tk::concat< std::size_t >(std::move(elist), pesup);
+    esup2[p+1] = esup1.size()-1;
   }
+  m_esup = { std::move(esup1), std::move(esup2) };
 
   tk::destroy(m_ghostData);
   tk::destroy(m_esupc);
@@ -1148,6 +1198,22 @@ DG::registerReducers()
 // *****************************************************************************
 {
   ElemDiagnostics::registerReducers();
+  LoadMerger = CkReduction::addReducer( maxsumLoad );
+}
+
+void
+DG::initPELoad()
+// *****************************************************************************
+//  Initialize processor-private predicted load accumulator
+//! \details Since this is an [initproc] routine, the runtime system executes
+//!   the routine exactly once on every PE early on in the Charm++ init
+//!   sequence. Must be static as it is called without an object.
+// *****************************************************************************
+{
+  CkpvInitialize( tk::real, peload );
+  CkpvInitialize( std::size_t, npeload );
+  CkpvAccess( peload ) = 0.0;
+  CkpvAccess( npeload ) = 0;
 }
 
 void
@@ -1160,9 +1226,46 @@ DG::ResumeFromSync()
 {
   if (Disc()->It() == 0) Throw( "it = 0 in ResumeFromSync()" );
 
+  m_lbnstage = 0;
+
   if (!g_inputdeck.get< tag::cmd, tag::nonblocking >()) next();
 }
 
+void
+DG::UserSetLBLoad()
+// *****************************************************************************
+//  Report predicted load of this chare to the load balancer
+//! \details This is called by the runtime system before load balancing if
+//!   automatic load measurement is turned off, which is done for p-adaptive
+//!   DG. Instead of the measured wall-clock time, which reflects the
+//!   distribution of degrees of freedom before their most recent change, the
+//!   load is predicted from the current number of degrees of freedom of the
+//!   elements, see lbweight(), scaled to the number of stages computed since
+//!   the previous load balancing.
+// *****************************************************************************
+{
+  setObjTime( m_lbscale * lbweight() * static_cast< tk::real >( m_lbnstage ) );
+}
+
+tk::real
+DG::lbweight() const
+// *****************************************************************************
+//  Compute work weight of this chare for predicting its load
+//! \return Sum of the work weights of the elements owned by this chare
+//! \details The cost of the volume and surface integrals of an element grows
+//!   with the product of its number of degrees of freedom and the number of
+//!   quadrature points, the latter also growing with the degrees of freedom,
+//!   so the weight of an element is taken as ndof^2.
+// *****************************************************************************
+{
+  tk::real w = 0.0;
+  for (std::size_t e=0; e<m_fd.Esuel().size()/4; ++e) {
+    auto n = static_cast< tk::real >( m_ndof[e] );
+    w += n*n;
+  }
+  return w;
+}
+
 void
 DG::setup()
 // *****************************************************************************
@@ -1385,6 +1488,16 @@ DG::lhs()
 {
   for (const auto& eq : g_dgpde) eq.lhs( m_geoElem, m_lhs );
 
+  // Compute least-squares reconstruction operators, only geometry dependent,
+  // if P0P1
+  if (g_inputdeck.get< tag::discr, tag::rdof >() == 4 &&
+      g_inputdeck.get< tag::discr, tag::ndof >() == 1)
+  {
+    auto d = Disc();
+    tk::recoLeastSqOperator_P0P1( m_fd, m_geoElem, m_geoFace, d->Inpoel(),
+                                  d->Coord(), m_lsop );
+  }
+
   if (!m_initial) stage();
 }
 
@@ -1423,7 +1536,7 @@ DG::reco()
     if (rdof == 4 && g_inputdeck.get< tag::discr, tag::ndof >() == 1)
       for (const auto& eq : g_dgpde)
         eq.reconstruct( d->T(), m_geoFace, m_geoElem, m_fd, m_esup, d->Inpoel(),
-                        d->Coord(), m_u, m_p );
+                        d->Coord(), m_lsop, m_u, m_p );
   }
 
   // Send reconstructed solution to neighboring chares
@@ -1530,9 +1643,19 @@ DG::lim()
   if (rdof > 1) {
     auto d = Disc();
 
+    // Mark elements that need limiting
+    std::vector< std::size_t > vars;
+    for (const auto& eq : g_dgpde)
+      for (auto c : eq.shockVars()) vars.push_back( c );
+    MarkShockCells( m_fd.Esuel().size()/4,
+                    g_inputdeck.get< tag::discr, tag::ndof >(), rdof,
+                    g_inputdeck.get< tag::discr, tag::shock_detector_coeff >(),
+                    vars, m_ndof, d->Inpoel(), d->Coord(), m_fd, m_geoElem, m_u,
+                    m_shockmarker );
+
     for (const auto& eq : g_dgpde)
       eq.limit( d->T(), m_geoFace, m_geoElem, m_fd, m_esup, d->Inpoel(),
-                d->Coord(), m_ndof, m_u, m_p );
+                d->Coord(), m_ndof, m_shockmarker, m_u, m_p );
   }
 
 
@@ -1759,10 +1882,16 @@ DG::solve( tk::real newdt )
   // Update Un
   if (m_stage == 0) m_un = m_u;
 
+  tk::Timer t;
   for (const auto& eq : g_dgpde)
     eq.rhs( d->T(), m_geoFace, m_geoElem, m_fd, d->Inpoel(), d->Coord(), m_u,
             m_p, m_ndof, m_rhs );
 
+  // Accumulate cost of computing the rhs for calibrating the load prediction
+  m_lbtime += t.dsec();
+  m_lbweight += lbweight();
+  ++m_lbnstage;
+
   // Explicit time-stepping using RK3 to discretize time-derivative
   for(std::size_t e=0; e<m_nunk; ++e)
     for(std::size_t c=0; c<neq; ++c)
@@ -1791,7 +1920,8 @@ DG::solve( tk::real newdt )
 
     // Compute diagnostics, e.g., residuals
     auto diag_computed = m_diag.compute( *d, m_u.nunk()-m_fd.Esuel().size()/4,
-                                         m_geoElem, m_ndof, m_u );
+                                         m_geoElem, m_ndof, m_shockmarker,
+                                         m_u );
 
     // Increase number of iterations and physical time
     d->next();
@@ -1889,7 +2019,8 @@ DG::resizePostAMR(
   m_exptGhost.clear();
   m_sendGhost.clear();
   m_ghost.clear();
-  m_esup.clear();
+  tk::destroy( m_esup.first );
+  tk::destroy( m_esup.second );
 
   // Update solution on new mesh, P0 (cell center value) only for now
   m_un = m_u;
@@ -1962,11 +2093,84 @@ DG::evalLB( int nrestart )
   const auto lbfreq = g_inputdeck.get< tag::cmd, tag::lbfreq >();
   const auto nonblocking = g_inputdeck.get< tag::cmd, tag::nonblocking >();
 
+  // Calibrate cost per unit work weight from the rhs timings since last time
+  if (m_lbweight > 0.0) {
+    auto s = m_lbtime / m_lbweight;
+    m_lbscale = m_lbscale > 0.0 ? 0.5*(m_lbscale + s) : s;
+  }
+  m_lbtime = m_lbweight = 0.0;
+
+  // With p-adaptive DG, if user frequency is reached, decide on load balancing
+  // based on predicted imbalance
+  if ( g_inputdeck.get< tag::pref, tag::pref >() &&
+       (d->It()) % lbfreq == 0 && d->It() != 2 ) {
+
+    // Sum predicted load over the chares on this PE. The last chare on this PE
+    // to add its load contributes the sum and the others contribute zero, so
+    // the reduction yields the largest and the total load of all PEs.
+    std::vector< tk::real > load{ 0.0, 0.0 };
+    auto nlocal = thisProxy.ckLocMgr()->numLocalElements();
+    CkpvAccess( peload ) += m_lbscale * lbweight();
+    if (++CkpvAccess( npeload ) == static_cast< std::size_t >( nlocal )) {
+      load[0] = load[1] = CkpvAccess( peload );
+      CkpvAccess( peload ) = 0.0;
+      CkpvAccess( npeload ) = 0;
+    }
+    contribute( load, LoadMerger,
+                CkCallback( CkIndex_DG::lbimbalance(nullptr), thisProxy ) );
+
+    // If nonblocking, continue without waiting for the decision, and start
+    // load balancing if the previous evaluation called for it. Since the
+    // decision is broadcast, all chares call AtSync() at the same time step.
+    if (nonblocking) {
+      if (m_lbdue) {
+        m_lbdue = false;
+        AtSync();
+      }
+      next();
+    }
+
   // Load balancing if user frequency is reached or after the second time-step
-  if ( (d->It()) % lbfreq == 0 || d->It() == 2 ) {
+  } else if ( (d->It()) % lbfreq == 0 || d->It() == 2 ) {
+
+    // Migrate only once no field output is in flight
+    d->flush( CkCallback( CkIndex_DG::startLB(), thisProxy[thisIndex] ) );
+
+  } else {
+
+    next();
+
+  }
+}
 
-    AtSync();
-    if (nonblocking) next();
+void
+DG::lbimbalance( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target yielding the largest and total predicted PE load
+//! \param[in] msg Largest and total predicted load across all PEs
+//! \details Load balancing is called for if the largest predicted load on a PE
+//!   exceeds the mean across all PEs by more than the user-configured
+//!   tolerance. If nonblocking, time stepping has already continued, so the
+//!   decision is only stored and load balancing is started by the next call
+//!   to evalLB() that evaluates the imbalance.
+// *****************************************************************************
+{
+  auto load = static_cast< const tk::real* >( msg->getData() );
+  auto lmax = load[0];
+  auto lmean = load[1] / static_cast< tk::real >( CkNumPes() );
+  delete msg;
+
+  const auto lbtol = g_inputdeck.get< tag::pref, tag::lbtol >();
+  auto imbalanced = lmax > (1.0 + lbtol) * lmean;
+
+  if (g_inputdeck.get< tag::cmd, tag::nonblocking >()) {
+
+    m_lbdue = imbalanced;
+
+  } else if (imbalanced) {
+
+    // Migrate only once no field output is in flight
+    Disc()->flush( CkCallback( CkIndex_DG::startLB(), thisProxy[thisIndex] ) );
 
   } else {
 
@@ -1975,6 +2179,16 @@ DG::evalLB( int nrestart )
   }
 }
 
+void
+DG::startLB()
+// *****************************************************************************
+// Start load balancing
+// *****************************************************************************
+{
+  AtSync();
+  if (g_inputdeck.get< tag::cmd, tag::nonblocking >()) next();
+}
+
 void
 DG::evalRestart()
 // *****************************************************************************
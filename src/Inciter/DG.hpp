@@ -84,6 +84,9 @@ class DG : public CBase_DG {
     //! Return from migration
     void ResumeFromSync() override;
 
+    //! Report predicted load of this chare to the load balancer
+    void UserSetLBLoad() override;
+
     //! Start sizing communication buffers and setting up ghost data
     void resizeComm();
 
@@ -112,6 +115,9 @@ class DG : public CBase_DG {
     //! Configure Charm++ reduction types for concatenating BC nodelists
     static void registerReducers();
 
+    //! Initialize processor-private predicted load accumulator
+    static void initPELoad();
+
     //! Setup: query boundary conditions, output mesh, etc.
     void setup();
 
@@ -121,6 +127,12 @@ class DG : public CBase_DG {
     // Evaluate whether to do load balancing
     void evalLB( int nrestart );
 
+    //! Start load balancing
+    void startLB();
+
+    //! Reduction target yielding the largest and total predicted PE load
+    void lbimbalance( CkReductionMsg* msg );
+
     //! Start time stepping
     void start();
 
@@ -204,6 +216,7 @@ class DG : public CBase_DG {
       p | m_geoFace;
       p | m_geoElem;
       p | m_lhs;
+      p | m_lsop;
       p | m_rhs;
       p | m_nfac;
       p | m_nunk;
@@ -228,6 +241,12 @@ class DG : public CBase_DG {
       p | m_infaces;
       p | m_esup;
       p | m_esupc;
+      p | m_shockmarker;
+      p | m_lbscale;
+      p | m_lbtime;
+      p | m_lbweight;
+      p | m_lbnstage;
+      p | m_lbdue;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -277,6 +296,8 @@ class DG : public CBase_DG {
     tk::Fields m_geoElem;
     //! Left-hand side mass-matrix which is a diagonal matrix
     tk::Fields m_lhs;
+    //! Least-squares reconstruction operators of all elements for rDG P0P1
+    std::vector< tk::real > m_lsop;
     //! Vector of right-hand side
     tk::Fields m_rhs;
     //! Counter for number of faces on this chare (including chare boundaries)
@@ -329,10 +350,23 @@ class DG : public CBase_DG {
     tk::UnsMesh::FaceSet m_expChBndFace;
     //! Incoming communication buffer during chare-boundary face communication
     std::unordered_map< int, tk::UnsMesh::FaceSet > m_infaces;
-    //! Elements (value) surrounding point (key) data-structure
-    std::map< std::size_t, std::vector< std::size_t > > m_esup;
+    //! \brief Elements surrounding points, including node-ghost elements,
+    //!   stored as a linked list, see tk::genEsup()
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_esup;
     //! Communication buffer for esup data-structure
     std::map< std::size_t, std::vector< std::size_t > > m_esupc;
+    //! Nonzero for elements limited in the recent stage, see MarkShockCells()
+    std::vector< std::size_t > m_shockmarker;
+    //! Calibrated wall-clock time of a stage per unit work weight
+    tk::real m_lbscale;
+    //! Wall-clock time spent computing the rhs since the last calibration
+    tk::real m_lbtime;
+    //! Work weight computed since the last calibration
+    tk::real m_lbweight;
+    //! Number of stages computed since the last load balancing
+    std::size_t m_lbnstage;
+    //! True if the previous imbalance evaluation called for load balancing
+    bool m_lbdue;
 
     //! Access bound Discretization class pointer
     Discretization* Disc() const {
@@ -407,6 +441,9 @@ class DG : public CBase_DG {
     //! Evaluate whether to save checkpoint/restart
     void evalRestart();
 
+    //! Compute work weight of this chare for predicting its load
+    tk::real lbweight() const;
+
     //! p-refine all elements that are adjacent to p-refined elements
     void propagate_ndof();
 };
@@ -902,13 +902,12 @@ DiagCG::evalLB( int nrestart )
   d->restarted( nrestart );
 
   const auto lbfreq = g_inputdeck.get< tag::cmd, tag::lbfreq >();
-  const auto nonblocking = g_inputdeck.get< tag::cmd, tag::nonblocking >();
 
   // Load balancing if user frequency is reached or after the second time-step
   if ( (d->It()) % lbfreq == 0 || d->It() == 2 ) {
 
-    AtSync();
-    if (nonblocking) next();
+    // Migrate only once no field output is in flight
+    d->flush( CkCallback( CkIndex_DiagCG::startLB(), thisProxy[thisIndex] ) );
 
   } else {
 
@@ -917,6 +916,16 @@ DiagCG::evalLB( int nrestart )
   }
 }
 
+void
+DiagCG::startLB()
+// *****************************************************************************
+// Start load balancing
+// *****************************************************************************
+{
+  AtSync();
+  if (g_inputdeck.get< tag::cmd, tag::nonblocking >()) next();
+}
+
 void
 DiagCG::evalRestart()
 // *****************************************************************************
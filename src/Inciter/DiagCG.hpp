@@ -162,6 +162,9 @@ class DiagCG : public CBase_DiagCG {
     // Evaluate whether to do load balancing
     void evalLB( int nrestart );
 
+    //! Start load balancing
+    void startLB();
+
     //! Continue to next time step
     void next();
 
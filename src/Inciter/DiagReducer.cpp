@@ -84,8 +84,10 @@ mergeDiag( int nmsg, CkReductionMsg **msgs )
     // Max for the Linf norm of the numerical - analytical solution for all comp
     for (std::size_t i=0; i<v[LINFERR].size(); ++i)
       if (w[LINFERR][i] > v[LINFERR][i]) v[LINFERR][i] = w[LINFERR][i];
+    // Sum for the volume of elements limited
+    for (std::size_t i=0; i<v[LIMVOL].size(); ++i) v[LIMVOL][i] += w[LIMVOL][i];
     // Copy the rest
-    for (std::size_t j=3; j<v.size(); ++j)
+    for (std::size_t j=ITER; j<v.size(); ++j)
       for (std::size_t i=0; i<v[j].size(); ++i)
         v[j][i] = w[j][i];
   }
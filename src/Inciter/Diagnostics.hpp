@@ -17,12 +17,13 @@
 namespace inciter {
 
 //! Number of entries in diagnostics vector (of vectors)
-const std::size_t NUMDIAG = 6;
+const std::size_t NUMDIAG = 7;
 
 //! Diagnostics labels
 enum Diag { L2SOL=0,    //!< L2 norm of numerical solution
             L2ERR,      //!< L2 norm of numerical-analytic solution
             LINFERR,    //!< L_inf norm of numerical-analytic solution
+            LIMVOL,     //!< Volume of elements limited (DG only)
             ITER,       //!< Iteration count
             TIME,       //!< Physical time
             DT };       //!< Time step size
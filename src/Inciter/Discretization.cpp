@@ -46,7 +46,12 @@ Discretization::Discretization(
   m_itf( 0 ),
   m_initial( 1.0 ),
   m_t( g_inputdeck.get< tag::discr, tag::t0 >() ),
-  m_lastDumpTime( -std::numeric_limits< tk::real >::max() ),  
+  m_lastDumpTime( -std::numeric_limits< tk::real >::max() ),
+  m_lastOutputNode( -1 ),
+  m_ninflight( 0 ),
+  m_outlimit( 0 ),
+  m_outheld( false ),
+  m_outcb(),
   m_dt( g_inputdeck.get< tag::discr, tag::dt >() ),
   m_nvol( 0 ),
   m_fct( fctproxy ),
@@ -544,6 +549,15 @@ Discretization::write(
 //!   mode, channeling multiple files via a single PE on each node is required
 //!   by NetCDF and HDF5, as well as ExodusII, since none of these libraries are
 //!   thread-safe.
+//! \details If a nonzero number of in-flight outputs is configured, the data
+//!   is handed to the mesh writer (which copies it into its message) and the
+//!   continuation c is called without waiting for the write to finish, as long
+//!   as the number of outputs not yet written does not exceed the configured
+//!   limit. Outputs that write the mesh, the last output, and outputs followed
+//!   by a checkpoint wait until all outputs of this chare have been written.
+//!   Outputs are never left in flight with nonblocking migration, since then
+//!   the chare may migrate at any time after load balancing is started. With
+//!   blocking migration the schemes call flush() before load balancing.
 // *****************************************************************************
 {
   // If the previous iteration refined (or moved) the mesh or this is called
@@ -560,12 +574,89 @@ Discretization::write(
     fieldoutput = true;
   }
 
+  // In aggregated output mode, count the chares writing to each compute node
+  if (g_inputdeck.get< tag::cmd, tag::io, tag::aggregate >() &&
+      !g_inputdeck.get< tag::cmd, tag::benchmark >())
+  {
+    auto moved = m_lastOutputNode >= 0 && m_lastOutputNode != CkMyNode();
+    m_lastOutputNode = CkMyNode();
+    contribute( tk::MeshWriter::nodecount( moved ), CkReduction::sum_ulong,
+      CkCallback( tk::CkIndex_MeshWriter::redn_wrapper_nwrite(nullptr),
+                  m_meshwriter ) );
+  }
+
+  // Number of outputs allowed to be in flight (not with aggregated output or
+  // nonblocking migration)
+  auto inflight = g_inputdeck.get< tag::cmd, tag::io, tag::aggregate >() ||
+                  g_inputdeck.get< tag::cmd, tag::nonblocking >() ?
+    0 : g_inputdeck.get< tag::cmd, tag::io, tag::inflight >();
+
+  auto cb = c;
+  if (inflight > 0) {
+    const auto term = g_inputdeck.get< tag::discr, tag::term >();
+    const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+    const auto rsfreq = g_inputdeck.get< tag::cmd, tag::rsfreq >();
+    // Wait for all outputs if mesh is written, last output, or checkpoint next
+    if (meshoutput || std::abs(m_t-term) < eps || m_it >= nstep ||
+        m_it % rsfreq == 0)
+      inflight = 0;
+    // Continue now or when enough outputs have been written, see written()
+    cb = CkCallback( CkIndex_Discretization::written(), thisProxy[thisIndex] );
+    if (++m_ninflight <= inflight) {
+      c.send();
+    } else {
+      m_outlimit = inflight;
+      m_outcb = c;
+      m_outheld = true;
+    }
+  }
+
   m_meshwriter[ CkNodeFirst( CkMyNode() ) ].
     write( meshoutput, fieldoutput, m_itr, m_itf, m_t, thisIndex,
            g_inputdeck.get< tag::cmd, tag::io, tag::output >(),
-           inpoel, coord, bface, bnode, triinpoel, elemfieldnames,
+           inpoel, coord, m_gid, bface, bnode, triinpoel, elemfieldnames,
            nodefieldnames, nodesurfnames, elemfields, nodefields, nodesurfs,
-           g_inputdeck.outsets(), c );
+           g_inputdeck.outsets(), cb );
+}
+
+void
+Discretization::written()
+// *****************************************************************************
+// Receive notice that an in-flight output of this chare has been written
+//! \details If the continuation of the last output is being held back, because
+//!   too many outputs were in flight, it is called once enough outputs have
+//!   been written.
+// *****************************************************************************
+{
+  Assert( m_ninflight > 0, "No field output in flight" );
+  --m_ninflight;
+
+  if (m_outheld && m_ninflight <= m_outlimit) {
+    m_outheld = false;
+    m_outcb.send();
+  }
+}
+
+void
+Discretization::flush( CkCallback c )
+// *****************************************************************************
+// Continue once all in-flight field outputs of this chare are written
+//! \param[in] c Function to continue with once no output is in flight
+//! \details This must be called before the chare may migrate, e.g., before
+//!   load balancing, since after migration the outputs of this chare would be
+//!   written by the mesh writer on another compute node, while those still in
+//!   flight could be writing the same file on the previous node.
+// *****************************************************************************
+{
+  Assert( !m_outheld, "Continuation of a field output already held" );
+
+  if (m_ninflight == 0) {
+    c.send();
+  } else {
+    m_outlimit = 0;
+    m_outcb = c;
+    m_outheld = true;
+  }
 }
 
 void
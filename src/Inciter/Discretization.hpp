@@ -244,6 +244,12 @@ class Discretization : public CBase_Discretization {
                 const std::vector< std::vector< tk::real > >& nodesurfs,
                 CkCallback c );
 
+    //! Receive notice that an in-flight output of this chare has been written
+    void written();
+
+    //! Continue once all in-flight field outputs of this chare are written
+    void flush( CkCallback c );
+
     //! Zero grind-timer
     void grindZero();
 
@@ -265,6 +271,11 @@ class Discretization : public CBase_Discretization {
       p | m_initial;
       p | m_t;
       p | m_lastDumpTime;
+      p | m_lastOutputNode;
+      p | m_ninflight;
+      p | m_outlimit;
+      p | m_outheld;
+      p | m_outcb;
       p | m_dt;
       p | m_nvol;
       p | m_fct;
@@ -321,6 +332,16 @@ class Discretization : public CBase_Discretization {
     tk::real m_t;
     //! Physical time at last field output
     tk::real m_lastDumpTime;
+    //! Compute node at last field output (-1: no output yet)
+    int m_lastOutputNode;
+    //! Number of field outputs handed to the mesh writer but not yet written
+    std::size_t m_ninflight;
+    //! Number of in-flight outputs at which the held continuation is called
+    std::size_t m_outlimit;
+    //! True if the continuation of the last field output is being held back
+    bool m_outheld;
+    //! Continuation of the last field output if held back
+    CkCallback m_outcb;
     //! Physical time step size
     tk::real m_dt;
     //! \brief Number of chares from which we received nodal volume
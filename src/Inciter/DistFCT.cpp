@@ -45,6 +45,9 @@ DistFCT::DistFCT( int nchare,
   m_bid( bid ),
   m_lid( lid ),
   m_inpoel( inpoel ),
+  m_commlid(),
+  m_commbid(),
+  m_bidlid(),
   m_fluxcorrector( m_inpoel.size() ),
   m_p( nu, np*2 ),
   m_q( nu, np*2 ),
@@ -72,6 +75,7 @@ DistFCT::DistFCT( int nchare,
 // *****************************************************************************
 {
   resizeComm();         // Size communication buffers
+  commIndex();          // Generate communication index lists
 }
 
 void
@@ -85,12 +89,54 @@ DistFCT::resizeComm()
   auto bs = m_bid.size();
   auto np = m_a.nprop();
 
-  m_pc.resize( bs );
-  for (auto& b : m_pc) b.resize( np*2 );
-  m_qc.resize( bs );
-  for (auto& b : m_qc) b.resize( np*2 );
-  m_ac.resize( bs );
-  for (auto& b : m_ac) b.resize( np );
+  m_pc.resize( bs*np*2 );
+  m_qc.resize( bs*np*2 );
+  m_ac.resize( bs*np );
+}
+
+void
+DistFCT::commIndex()
+// *****************************************************************************
+//  Generate index lists for communication on chare-boundaries
+//! \details For each fellow chare we share nodes with, the local node IDs to
+//!   pack and the receive buffer indices to unpack are stored in increasing
+//!   global node ID order. Since both sides of a chare-boundary agree on this
+//!   order, messages only carry the field values and the lists are only
+//!   regenerated when the mesh changes.
+// *****************************************************************************
+{
+  m_commlid.clear();
+  m_commbid.clear();
+  for (const auto& [c,n] : m_nodeCommMap) {
+    std::vector< std::size_t > gid( begin(n), end(n) );
+    std::sort( begin(gid), end(gid) );
+    auto& lid = m_commlid[c];
+    auto& bid = m_commbid[c];
+    for (auto g : gid) {
+      lid.push_back( tk::cref_find( m_lid, g ) );
+      bid.push_back( tk::cref_find( m_bid, g ) );
+    }
+  }
+
+  m_bidlid.resize( m_bid.size() );
+  for (const auto& [g,b] : m_bid) m_bidlid[b] = tk::cref_find( m_lid, g );
+}
+
+std::vector< tk::real >
+DistFCT::pack( const std::vector< std::size_t >& lid,
+               const tk::Fields& F ) const
+// *****************************************************************************
+//  Pack field values on nodes shared with a fellow chare to send
+//! \param[in] lid Local node IDs to pack, see m_commlid
+//! \param[in] F Field to pack
+//! \return All components of F at all nodes given, node by node
+// *****************************************************************************
+{
+  std::vector< tk::real > v;
+  v.reserve( lid.size() * F.nprop() );
+  for (auto l : lid)
+    for (ncomp_t c=0; c<F.nprop(); ++c) v.push_back( F(l,c,0) );
+  return v;
 }
 
 void
@@ -102,6 +148,8 @@ DistFCT::remap( const Discretization& d )
 {
   m_lid = d.Lid();
   m_inpoel = d.Inpoel();
+  commIndex();
+  m_fluxcorrector.reset();
 }
 
 void
@@ -133,6 +181,7 @@ DistFCT::resize( std::size_t nu,
   m_q.resize( nu, np*2 );
   m_a.resize( nu, np );
   resizeComm();
+  commIndex();
 
   m_fluxcorrector.resize( m_inpoel.size() );
 }
@@ -164,13 +213,12 @@ DistFCT::next()
       m_q(p,c*2+1,0) = std::numeric_limits< tk::real >::max();
     }
 
-  for (auto& b : m_pc) std::fill( begin(b), end(b), 0.0 );
-  for (auto& b : m_ac) std::fill( begin(b), end(b), 0.0 );
-  for (auto& b : m_qc)
-    for (ncomp_t c=0; c<m_q.nprop()/2; ++c) {
-      b[c*2+0] = -std::numeric_limits< tk::real >::max();
-      b[c*2+1] = std::numeric_limits< tk::real >::max();
-    }
+  std::fill( begin(m_pc), end(m_pc), 0.0 );
+  std::fill( begin(m_ac), end(m_ac), 0.0 );
+  for (std::size_t i=0; i<m_qc.size()/2; ++i) {
+    m_qc[i*2+0] = -std::numeric_limits< tk::real >::max();
+    m_qc[i*2+1] = std::numeric_limits< tk::real >::max();
+  }
 
   thisProxy[ thisIndex ].wait4fct();
   thisProxy[ thisIndex ].wait4app();
@@ -211,24 +259,19 @@ DistFCT::aec(
   if (d.NodeCommMap().empty())
     comaec_complete();
   else // send contributions to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d.NodeCommMap()) {
-      std::vector< std::vector< tk::real > > p( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) p[ j++ ] = m_p[ tk::cref_find(m_lid,i) ];
-      thisProxy[ c ].comaec( std::vector<std::size_t>(begin(n),end(n)), p );
-    }
+    for (const auto& [c,lid] : m_commlid)
+      thisProxy[ c ].comaec( thisIndex, pack( lid, m_p ) );
 
   ownaec_complete( bcdir );
 }
 
 void
-DistFCT::comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P )
+DistFCT::comaec( int fromch, const std::vector< tk::real >& P )
 // *****************************************************************************
 //  Receive sums of antidiffusive element contributions on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive AEC contributions
+//! \param[in] fromch Sender chare ID
 //! \param[in] P Partial sums of positive (negative) antidiffusive element
-//!   contributions to chare-boundary nodes
+//!   contributions to chare-boundary nodes, in the order of m_commbid
 //! \details This function receives contributions to m_p, which stores the
 //!   sum of all positive (negative) antidiffusive element contributions to
 //!   nodes (Lohner: P^{+,-}_i), see also FluxCorrector::aec(). While m_p stores
@@ -237,14 +280,13 @@ DistFCT::comaec( const std::vector< std::size_t >& gid,
 //!   combined in lim().
 // *****************************************************************************
 {
-  Assert( P.size() == gid.size(), "Size mismatch" );
+  const auto& bid = tk::cref_find( m_commbid, fromch );
+  auto np = m_p.nprop();
+  Assert( P.size() == bid.size()*np, "Size mismatch" );
 
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_pc.size(), "Indexing out of bounds" );
-    m_pc[ bid ] += P[i];
+  for (std::size_t i=0; i<bid.size(); ++i) {
+    Assert( (bid[i]+1)*np <= m_pc.size(), "Indexing out of bounds" );
+    for (ncomp_t c=0; c<np; ++c) m_pc[ bid[i]*np+c ] += P[ i*np+c ];
   }
 
   if (++m_naec == m_nodeCommMap.size()) {
@@ -285,25 +327,21 @@ DistFCT::alw( const tk::Fields& Un,
   if (m_nodeCommMap.empty())
     comalw_complete();
   else // send contributions at chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : m_nodeCommMap) {
-      std::vector< std::vector< tk::real > > q( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) q[ j++ ] = m_q[ tk::cref_find(m_lid,i) ];
-      thisProxy[ c ].comalw( std::vector<std::size_t>(begin(n),end(n)), q );
-    }
+    for (const auto& [c,lid] : m_commlid)
+      thisProxy[ c ].comalw( thisIndex, pack( lid, m_q ) );
 
   ownalw_complete();
 }
 
 void
-DistFCT::comalw( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& Q )
+DistFCT::comalw( int fromch, const std::vector< tk::real >& Q )
 // *****************************************************************************
 // Receive contributions to the maxima and minima of unknowns of all elements
 // surrounding mesh nodes on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive contributions
+//! \param[in] fromch Sender chare ID
 //! \param[in] Q Partial contributions to maximum and minimum unknowns of all
-//!   elements surrounding nodes to chare-boundary nodes
+//!   elements surrounding nodes to chare-boundary nodes, in the order of
+//!   m_commbid
 //! \details This function receives contributions to m_q, which stores the
 //!   maximum and mimimum unknowns of all elements surrounding each node
 //!   (Lohner: u^{max,min}_i), see also FluxCorrector::alw(). While m_q stores
@@ -312,14 +350,15 @@ DistFCT::comalw( const std::vector< std::size_t >& gid,
 //!   combined in lim().
 // *****************************************************************************
 {
-  Assert( Q.size() == gid.size(), "Size mismatch" );
-
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_qc.size(), "Indexing out of bounds" );
-    auto& o = m_qc[ bid ];
-    const auto& q = Q[i];
-    for (ncomp_t c=0; c<m_q.nprop()/2; ++c) {
+  const auto& bid = tk::cref_find( m_commbid, fromch );
+  auto np = m_q.nprop();
+  Assert( Q.size() == bid.size()*np, "Size mismatch" );
+
+  for (std::size_t i=0; i<bid.size(); ++i) {
+    Assert( (bid[i]+1)*np <= m_qc.size(), "Indexing out of bounds" );
+    auto o = m_qc.data() + bid[i]*np;
+    auto q = Q.data() + i*np;
+    for (ncomp_t c=0; c<np/2; ++c) {
       if (q[c*2+0] > o[c*2+0]) o[c*2+0] = q[c*2+0];
       if (q[c*2+1] < o[c*2+1]) o[c*2+1] = q[c*2+1];
     }
@@ -348,11 +387,12 @@ DistFCT::lim( const std::unordered_map< std::size_t,
   m_fluxcorrector.verify( m_nchare, m_inpoel, m_du, m_dul );
 
   // Combine own and communicated contributions to P and Q
-  for (const auto& b : m_bid) {
-    auto lid = tk::cref_find( m_lid, b.first );
-    const auto& bpc = m_pc[ b.second ];
-    const auto& bqc = m_qc[ b.second ];
-    for (ncomp_t c=0; c<m_p.nprop()/2; ++c) {
+  auto np = m_p.nprop();
+  for (std::size_t b=0; b<m_bidlid.size(); ++b) {
+    auto lid = m_bidlid[b];
+    auto bpc = m_pc.data() + b*np;
+    auto bqc = m_qc.data() + b*np;
+    for (ncomp_t c=0; c<np/2; ++c) {
       m_p(lid,c*2+0,0) += bpc[c*2+0];
       m_p(lid,c*2+1,0) += bpc[c*2+1];
       if (bqc[c*2+0] > m_q(lid,c*2+0,0)) m_q(lid,c*2+0,0) = bqc[c*2+0];
@@ -365,25 +405,20 @@ DistFCT::lim( const std::unordered_map< std::size_t,
   if (m_nodeCommMap.empty())
     comlim_complete();
   else // send contributions to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : m_nodeCommMap) {
-      std::vector< std::vector< tk::real > > a( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) a[ j++ ] = m_a[ tk::cref_find(m_lid,i) ];
-      thisProxy[ c ].comlim( std::vector<std::size_t>(begin(n),end(n)), a );
-    }
+    for (const auto& [c,lid] : m_commlid)
+      thisProxy[ c ].comlim( thisIndex, pack( lid, m_a ) );
 
   ownlim_complete();
 }
 
 void
-DistFCT::comlim( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& A )
+DistFCT::comlim( int fromch, const std::vector< tk::real >& A )
 // *****************************************************************************
 //  Receive contributions of limited antidiffusive element contributions on
 //  chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive contributions
+//! \param[in] fromch Sender chare ID
 //! \param[in] A Partial contributions to antidiffusive element contributions to
-//!   chare-boundary nodes
+//!   chare-boundary nodes, in the order of m_commbid
 //! \details This function receives contributions to m_a, which stores the
 //!   limited antidiffusive element contributions assembled to nodes (Lohner:
 //!   AEC^c), see also FluxCorrector::limit(). While m_a stores own
@@ -392,14 +427,13 @@ DistFCT::comlim( const std::vector< std::size_t >& gid,
 //!   combined in apply().
 // *****************************************************************************
 {
-  Assert( A.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
+  const auto& bid = tk::cref_find( m_commbid, fromch );
+  auto np = m_a.nprop();
+  Assert( A.size() == bid.size()*np, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_ac.size(), "Indexing out of bounds" );
-    m_ac[ bid ] += A[i];
+  for (std::size_t i=0; i<bid.size(); ++i) {
+    Assert( (bid[i]+1)*np <= m_ac.size(), "Indexing out of bounds" );
+    for (ncomp_t c=0; c<np; ++c) m_ac[ bid[i]*np+c ] += A[ i*np+c ];
   }
  
   if (++m_nlim == m_nodeCommMap.size()) {
@@ -415,11 +449,9 @@ DistFCT::apply()
 // *****************************************************************************
 {
   // Combine own and communicated contributions to A
-  for (const auto& b : m_bid) {
-    auto lid = tk::cref_find( m_lid, b.first );
-    const auto& bac = m_ac[ b.second ];
-    for (ncomp_t c=0; c<m_a.nprop(); ++c) m_a(lid,c,0) += bac[c];
-  }
+  auto np = m_a.nprop();
+  for (std::size_t b=0; b<m_bidlid.size(); ++b)
+    for (ncomp_t c=0; c<np; ++c) m_a(m_bidlid[b],c,0) += m_ac[ b*np+c ];
 
   // Update solution in host
   m_host[ thisIndex ].ckLocal()->update( m_a, std::move(m_dul) );
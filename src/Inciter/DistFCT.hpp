@@ -104,18 +104,15 @@ class DistFCT : public CBase_DistFCT {
     void next();
 
     //! Receive sums of antidiffusive element contributions on chare-boundaries
-    void comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P );
+    void comaec( int fromch, const std::vector< tk::real >& P );
 
     //! \brief Receive contributions to the maxima and minima of unknowns of all
     //!   elements surrounding mesh nodes on chare-boundaries
-    void comalw( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& Q );
+    void comalw( int fromch, const std::vector< tk::real >& Q );
 
     //! \brief Receive contributions of limited antidiffusive element
     //!   contributions on chare-boundaries
-    void comlim( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& A );
+    void comlim( int fromch, const std::vector< tk::real >& A );
 
     //! Compute and sum antidiffusive element contributions (AEC) to mesh nodes
     void aec(
@@ -163,6 +160,9 @@ class DistFCT : public CBase_DistFCT {
       p | m_bid;
       p | m_lid;
       p | m_inpoel;
+      p | m_commlid;
+      p | m_commbid;
+      p | m_bidlid;
       p | m_fluxcorrector;
       p | m_p;
       p | m_q;
@@ -210,12 +210,21 @@ class DistFCT : public CBase_DistFCT {
     //! Mesh connectivity of our chunk of the mesh
     //! \note This is a copy. Original in (bound) Discretization
     std::vector< std::size_t > m_inpoel;
+    //! \brief Local mesh node IDs of nodes shared with fellow chares, in
+    //!   increasing global node ID order, associated to fellow chare IDs
+    std::unordered_map< int, std::vector< std::size_t > > m_commlid;
+    //! \brief Receive buffer indices (see m_bid) of nodes shared with fellow
+    //!   chares, in increasing global node ID order, associated to chare IDs
+    std::unordered_map< int, std::vector< std::size_t > > m_commbid;
+    //! Local mesh node IDs associated to receive buffer indices
+    std::vector< std::size_t > m_bidlid;
     //! Flux corrector performing FCT
     FluxCorrector m_fluxcorrector;
     //! Flux-corrected transport data structures
     tk::Fields m_p, m_q, m_a;
-    //! Receive buffers for FCT
-    std::vector< std::vector< tk::real > > m_pc, m_qc, m_ac;
+    //! \brief Receive buffers for FCT, all components of a chare-boundary node
+    //!   stored contiguously, nodes indexed by m_bid
+    std::vector< tk::real > m_pc, m_qc, m_ac;
     //! Pointer to low order solution vector and increment
     //! \note These are copies. Original in (bound) Discretization
     tk::Fields m_ul, m_dul, m_du;
@@ -225,6 +234,13 @@ class DistFCT : public CBase_DistFCT {
     //! Size FCT communication buffers
     void resizeComm();
 
+    //! Generate index lists for communication on chare-boundaries
+    void commIndex();
+
+    //! Pack field values on nodes shared with a fellow chare to send
+    std::vector< tk::real > pack( const std::vector< std::size_t >& lid,
+                                  const tk::Fields& F ) const;
+
     //! Compute the limited antidiffusive element contributions
     void lim( const std::unordered_map< std::size_t,
                 std::vector< std::pair< bool, tk::real > > >& bcdir );
@@ -55,6 +55,7 @@ ElemDiagnostics::compute( Discretization& d,
                           const std::size_t nchGhost,
                           const tk::Fields& geoElem,
                           const std::vector< std::size_t >& ndofel,
+                          const std::vector< std::size_t >& shockmarker,
                           const tk::Fields& u ) const
 // *****************************************************************************
 //  Compute diagnostics, e.g., residuals, norms of errors, etc.
@@ -62,6 +63,8 @@ ElemDiagnostics::compute( Discretization& d,
 //! \param[in] nchGhost Number of chare boundary ghost elements
 //! \param[in] geoElem Element geometry
 //! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] shockmarker Nonzero for elements limited in the recent stage,
+//!   empty if no limiting was done
 //! \param[in] u Current solution vector
 //! \return True if diagnostics have been computed
 //! \details Diagnostics are defined as some norm, e.g., L2 norm, of a quantity,
@@ -92,6 +95,10 @@ ElemDiagnostics::compute( Discretization& d,
     // Compute diagnostics for DG
     compute_diag(d, rdof, nchGhost, geoElem, ndofel, u, diag);
 
+    // Volume of elements limited (only the first entry is used)
+    for (std::size_t e=0; e<shockmarker.size(); ++e)
+      if (shockmarker[e]) diag[LIMVOL][0] += geoElem(e,0,0);
+
     // Append diagnostics vector with metadata on the current time step
     // ITER: Current iteration count (only the first entry is used)
     // TIME: Current physical time (only the first entry is used)
@@ -31,6 +31,7 @@ class ElemDiagnostics {
                   const std::size_t nchGhost,
                   const tk::Fields& geoElem,
                   const std::vector< std::size_t >& ndofel,
+                  const std::vector< std::size_t >& shockmarker,
                   const tk::Fields& u ) const;
 
     /** @name Charm++ pack/unpack serializer member functions */
@@ -82,9 +82,7 @@ FluxCorrector::aec(
           "AEC and mesh connectivity size mismatch" );
   Assert( Un.nunk() == P.nunk() && Un.nprop() == P.nprop()/2, "Size mismatch" );
 
-  const auto& x = coord[0];
-  const auto& y = coord[1];
-  const auto& z = coord[2];
+  const auto& jac = jacobian( coord, inpoel );
 
   m_aec.fill( 0.0 );
 
@@ -92,13 +90,8 @@ FluxCorrector::aec(
     const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
                                            inpoel[e*4+2], inpoel[e*4+3] }};
 
-    // compute element Jacobi determinant
-    const std::array< tk::real, 3 >
-      ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-      ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-      da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-    const auto J = tk::triple( ba, ca, da );
-    Assert( J > 0, "Element Jacobian non-positive" );
+    // element Jacobi determinant
+    const auto J = jac[e];
 
     // lumped - consistent mass
     std::array< std::array< tk::real, 4 >, 4 > m;       // nnode*nnode [4][4]
@@ -246,7 +239,7 @@ FluxCorrector::verify( std::size_t nchare,
 tk::Fields
 FluxCorrector::diff( const std::array< std::vector< tk::real >, 3 >& coord,
                      const std::vector< std::size_t >& inpoel,
-                     const tk::Fields& Un ) const
+                     const tk::Fields& Un )
 // *****************************************************************************
 //  Compute mass diffusion contribution to the RHS of the low order system
 //! \param[in] coord Mesh node coordinates
@@ -258,10 +251,7 @@ FluxCorrector::diff( const std::array< std::vector< tk::real >, 3 >& coord,
   auto ncomp = g_inputdeck.get< tag::component >().nprop();
   auto ctau = g_inputdeck.get< tag::discr, tag::ctau >();
 
-  // access node coordinates
-  const auto& x = coord[0];
-  const auto& y = coord[1];
-  const auto& z = coord[2];
+  const auto& jac = jacobian( coord, inpoel );
 
   tk::Fields D( Un.nunk(), Un.nprop() );
   D.fill( 0.0 );
@@ -270,13 +260,8 @@ FluxCorrector::diff( const std::array< std::vector< tk::real >, 3 >& coord,
     // access node IDs
     const std::array< std::size_t, 4 >
        N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
-     // compute element Jacobi determinant
-     const std::array< tk::real, 3 >
-       ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-       ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-       da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-     const auto J = tk::triple( ba, ca, da );   // J = 6V
-     Assert( J > 0, "Element Jacobian non-positive" );
+     // element Jacobi determinant
+     const auto J = jac[e];   // J = 6V
 
      // lumped - consistent mass
      std::array< std::array< tk::real, 4 >, 4 > m;       // nnode*nnode [4][4]
@@ -308,7 +293,7 @@ void
 FluxCorrector::alw( const std::vector< std::size_t >& inpoel,
                     const tk::Fields& Un,
                     const tk::Fields& Ul,
-                    tk::Fields& Q ) const
+                    tk::Fields& Q )
 // *****************************************************************************
 //  Compute the maximum and minimum unknowns of elements surrounding nodes
 //! \param[in] inpoel Mesh element connectivity
@@ -343,9 +328,9 @@ FluxCorrector::alw( const std::vector< std::size_t >& inpoel,
 
   // compute maximum and mimimum unknowns of all elements surrounding each node
   // (Lohner: u^{max,min}_i)
-  const auto esup = tk::genEsup( inpoel, 4 );
+  if (m_esup.first.empty()) m_esup = tk::genEsup( inpoel, 4 );
   for (std::size_t p=0; p<Un.nunk(); ++p) {
-    for (auto e : tk::Around(esup,p)) {
+    for (auto e : tk::Around(m_esup,p)) {
       for (ncomp_t c=0; c<ncomp; ++c) {
         if (S(e,c*2+0,0) > Q(p,c*2+0,0)) Q(p,c*2+0,0) = S(e,c*2+0,0);
         if (S(e,c*2+1,0) < Q(p,c*2+1,0)) Q(p,c*2+1,0) = S(e,c*2+1,0);
@@ -470,6 +455,39 @@ FluxCorrector::lim( const std::vector< std::size_t >& inpoel,
   }
 }
 
+const std::vector< tk::real >&
+FluxCorrector::jacobian( const std::array< std::vector< tk::real >, 3 >& coord,
+                         const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Compute element Jacobians if not yet cached for the current mesh
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \return Element Jacobi determinants (6 x element volume)
+//! \details The Jacobians only change with the mesh, so they are computed
+//!   once and reused until reset() is called, e.g., after mesh refinement.
+// *****************************************************************************
+{
+  if (m_jac.size() == inpoel.size()/4) return m_jac;
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  m_jac.resize( inpoel.size()/4 );
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
+                                           inpoel[e*4+2], inpoel[e*4+3] }};
+    const std::array< tk::real, 3 >
+      ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+      ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+      da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+    m_jac[e] = tk::triple( ba, ca, da );
+    Assert( m_jac[e] > 0, "Element Jacobian non-positive" );
+  }
+
+  return m_jac;
+}
+
 std::tuple< std::vector< std::string >,
             std::vector< std::vector< tk::real > > >
 FluxCorrector::fields( const std::vector< std::size_t >& /*inpoel*/ ) const
@@ -44,7 +44,9 @@ class FluxCorrector {
     explicit FluxCorrector( std::size_t is = 0 ) :
       m_aec( is, g_inputdeck.get< tag::component >().nprop() ),
       m_sys( findsys< tag::compflow >() ),
-      m_vel( findvel< tag::compflow >() ) {}
+      m_vel( findvel< tag::compflow >() ),
+      m_jac(),
+      m_esup() {}
 
     //! Collect scalar comonent indices for equation systems
     //! \tparam Eq Equation types to consider as equation systems
@@ -105,6 +107,14 @@ class FluxCorrector {
     //! Resize state (e.g., after mesh refinement)
     void resize( std::size_t is ) {
       m_aec.resize( is, g_inputdeck.get< tag::component >().nprop() );
+      reset();
+    }
+
+    //! Invalidate mesh data cached (e.g., after mesh refinement or reorder)
+    void reset() {
+      m_jac.clear();
+      m_esup.first.clear();
+      m_esup.second.clear();
     }
 
     //! Compute antidiffusive element contributions (AEC)
@@ -127,14 +137,14 @@ class FluxCorrector {
     //! Compute mass diffusion contribution to the rhs of the low order system
     tk::Fields diff( const std::array< std::vector< tk::real >, 3 >& coord,
                      const std::vector< std::size_t >& inpoel,
-                     const tk::Fields& Un ) const;
+                     const tk::Fields& Un );
 
     //! \brief Compute the maximum and minimum unknowns of all elements
     //!   surrounding nodes
     void alw( const std::vector< std::size_t >& inpoel,
               const tk::Fields& Un,
               const tk::Fields& Ul,
-              tk::Fields& Q ) const;
+              tk::Fields& Q );
 
     //! Compute limited antiffusive element contributions and apply to mesh nodes
     void lim( const std::vector< std::size_t >& inpoel,
@@ -172,6 +182,18 @@ class FluxCorrector {
    std::vector< std::vector< ncomp_t > > m_sys;
    //! Component indices to treat as a velocity vector for multiple systems
    std::vector< std::array< ncomp_t, 3 > > m_vel;
+   //! \brief Element Jacobians (6 x element volume) cached for the current
+   //!   mesh, see reset()
+   //! \note Not migrated, regenerated on first use
+   std::vector< tk::real > m_jac;
+   //! Elements surrounding points cached for the current mesh, see reset()
+   //! \note Not migrated, regenerated on first use
+   std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_esup;
+
+   //! Compute element Jacobians if not yet cached for the current mesh
+   const std::vector< tk::real >&
+   jacobian( const std::array< std::vector< tk::real >, 3 >& coord,
+             const std::vector< std::size_t >& inpoel );
 };
 
 } // inciter::
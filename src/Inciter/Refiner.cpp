@@ -26,6 +26,7 @@
 #include "Around.hpp"
 #include "Sorter.hpp"
 #include "Discretization.hpp"
+#include "MeshWriter.hpp"
 
 namespace inciter {
 
@@ -85,7 +86,15 @@ Refiner::Refiner( const CProxy_Transporter& transporter,
   m_coarseBndNodes(),
   m_rid( ginpoel.size() ),
   m_lref( ginpoel.size() ),
-  m_parent()
+  m_parent(),
+  m_nbrload(),
+  m_dest(),
+  m_nmig( 0 ),
+  m_rebal( false ),
+  m_impinpoel(),
+  m_impcoordmap(),
+  m_impbface(),
+  m_impbnode()
 // *****************************************************************************
 //  Constructor
 //! \param[in] transporter Transporter (host) proxy
@@ -323,7 +332,7 @@ Refiner::bndEdges()
   // Send edges in bins to chares that will compute shared edges
   m_nbnd = chbedges.size();
   if (m_nbnd == 0)
-    contribute( m_cbr.get< tag::queried >() );
+    queried();
   else
     for (const auto& [ targetchare, bndedges ] : chbedges)
       thisProxy[ targetchare ].query( thisIndex, bndedges );
@@ -351,7 +360,21 @@ Refiner::recvquery()
 // Receive receipt of boundary edge lists to query
 // *****************************************************************************
 {
-  if (--m_nbnd == 0) contribute( m_cbr.get< tag::queried >() );
+  if (--m_nbnd == 0) queried();
+}
+
+void
+Refiner::queried()
+// *****************************************************************************
+// Signal that we have queried our boundary edges
+//! \details During refinement the host is signaled, while after a round of
+//!   element migration we continue directly with responding to the queries.
+// *****************************************************************************
+{
+  if (m_rebal)
+    contribute( CkCallback( CkIndex_Refiner::response(), thisProxy ) );
+  else
+    contribute( m_cbr.get< tag::queried >() );
 }
 
 void
@@ -381,7 +404,7 @@ Refiner::response()
   // the responses on the sender side, i.e., this chare.
   m_nbnd = exp.size();
   if (m_nbnd == 0)
-    contribute( m_cbr.get< tag::responded >() );
+    responded();
   else
     for (const auto& [ targetchare, bndedges ] : exp)
       thisProxy[ targetchare ].bnd( thisIndex, bndedges );
@@ -408,7 +431,21 @@ Refiner::recvbnd()
 // Receive receipt of shared boundary edges
 // *****************************************************************************
 {
-  if (--m_nbnd == 0) contribute( m_cbr.get< tag::responded >() );
+  if (--m_nbnd == 0) responded();
+}
+
+void
+Refiner::responded()
+// *****************************************************************************
+// Signal that we have setup our shared boundary edges
+//! \details During refinement the host is signaled, while after a round of
+//!   element migration we continue with measuring the load imbalance.
+// *****************************************************************************
+{
+  if (m_rebal)
+    contribute( CkCallback( CkIndex_Refiner::migrated(), thisProxy ) );
+  else
+    contribute( m_cbr.get< tag::responded >() );
 }
 
 void
@@ -708,7 +745,7 @@ void
 Refiner::writeMesh( const std::string& basefilename,
                     uint64_t itr,
                     tk::real t,
-                    CkCallback c ) const
+                    CkCallback c )
 // *****************************************************************************
 //  Output mesh to file(s)
 //! \param[in] basefilename File name to append to
@@ -772,10 +809,20 @@ Refiner::writeMesh( const std::string& basefilename,
       elemfields.push_back( u.extract( i, 0 ) );
   }
 
+  // In aggregated output mode, count the chares writing to each compute node
+  if (g_inputdeck.get< tag::cmd, tag::io, tag::aggregate >() &&
+      !g_inputdeck.get< tag::cmd, tag::benchmark >())
+  {
+    contribute( tk::MeshWriter::nodecount( /* moved = */ false ),
+      CkReduction::sum_ulong,
+      CkCallback( tk::CkIndex_MeshWriter::redn_wrapper_nwrite(nullptr),
+                  m_meshwriter ) );
+  }
+
   // Output mesh
   m_meshwriter[ CkNodeFirst( CkMyNode() ) ].
     write( /*meshoutput = */ true, /*fieldoutput = */ true, itr, 1, t,
-           thisIndex, basefilename, m_inpoel, m_coord, m_bface,
+           thisIndex, basefilename, m_inpoel, m_coord, m_gid, m_bface,
            tk::remap(m_bnode,m_lid), tk::remap(m_triinpoel,m_lid),
            elemfieldnames, nodefieldnames, {}, elemfields, nodefields, {},
            {}, c );
@@ -865,7 +912,354 @@ Refiner::endt0ref()
 //! \details This function is called as after initial mesh refinement has
 //!   finished. If initial mesh reifnement was not configured by the user, this
 //!   is the point where we continue after the constructor, by computing the
-//!   total number of elements across the whole problem.
+//!   total number of elements across the whole problem. If rebalancing is
+//!   configured, we first measure the load imbalance across refiner chares
+//!   that may have been caused by the initial mesh refinement.
+// *****************************************************************************
+{
+  if (g_inputdeck.get< tag::amr, tag::t0ref >() && m_ninitref > 0 &&
+      g_inputdeck.get< tag::amr, tag::rebalance >())
+    loadstat();
+  else
+    sort();
+}
+
+void
+Refiner::loadstat()
+// *****************************************************************************
+// Contribute number of elements to measure load imbalance
+//! \details We contribute the number of elements and its negative to a
+//!   max-reduction, yielding the largest and smallest number of elements held
+//!   by a single chare across the whole problem.
+// *****************************************************************************
+{
+  auto n = static_cast< tk::real >( m_ginpoel.size()/4 );
+  std::vector< tk::real > load{{ n, -n }};
+  contribute( load, CkReduction::max_double, m_cbr.get< tag::imbalance >() );
+}
+
+void
+Refiner::rebalance()
+// *****************************************************************************
+// Start a round of diffusive element migration among neighbor chares
+//! \details We send our number of elements and the nodes of our chare-boundary
+//!   faces to all chares we share at least an edge with. Once all neighbor
+//!   loads have arrived, we decide how many elements to hand to each less
+//!   loaded neighbor, see exportElems().
+// *****************************************************************************
+{
+  // Collect nodes of faces on the boundary of our mesh chunk
+  auto esuel = tk::genEsuelTet( m_inpoel, tk::genEsup(m_inpoel,4) );
+  std::vector< std::size_t > bndnodes;
+  for (std::size_t e=0; e<esuel.size()/4; ++e) {
+    auto mark = e*4;
+    for (std::size_t f=0; f<4; ++f)
+      if (esuel[mark+f] == -1)
+        for (std::size_t n=0; n<3; ++n)
+          bndnodes.push_back( m_ginpoel[ mark+tk::lpofa[f][n] ] );
+  }
+  tk::unique( bndnodes );
+
+  if (m_ch.empty()) {
+    m_dest.assign( m_ginpoel.size()/4, -1 );
+    migrate();
+  } else
+    for (auto c : m_ch)
+      thisProxy[ c ].nbrload( thisIndex, m_ginpoel.size()/4, bndnodes );
+}
+
+void
+Refiner::nbrload( int fromch,
+                  std::size_t nelem,
+                  const std::vector< std::size_t >& bndnodes )
+// *****************************************************************************
+// Receive element count and chare-boundary nodes of a neighbor chare
+//! \param[in] fromch Sender chare ID
+//! \param[in] nelem Number of elements held by sender chare
+//! \param[in] bndnodes Global ids of nodes on the boundary of sender's chunk
+// *****************************************************************************
+{
+  m_nbrload[ fromch ] = { nelem, bndnodes };
+  if (m_nbrload.size() == m_ch.size()) exportElems();
+}
+
+void
+Refiner::exportElems()
+// *****************************************************************************
+// Select and send elements to less loaded neighbor chares
+//! \details Following a first-order diffusion scheme, we hand a fraction of
+//!   the difference in the number of elements to each neighbor holding fewer
+//!   elements than we do. The elements to move are selected by a
+//!   breadth-first walk across element faces, starting from the elements
+//!   whose faces are on the chare boundary shared with the receiving neighbor,
+//!   so that the migrated elements remain adjacent to the receiver's chunk.
+//!   Side set faces and nodes are sent together with their elements so that
+//!   the boundary conditions are preserved. A message is sent to all neighbor
+//!   chares, even if empty, so that receivers can detect completion.
+// *****************************************************************************
+{
+  auto nelem = m_ginpoel.size()/4;
+  auto esuel = tk::genEsuelTet( m_inpoel, tk::genEsup(m_inpoel,4) );
+
+  // Diffusion coefficient and cap on the number of elements to give away
+  auto alpha = 1.0 / static_cast< tk::real >( m_ch.size() + 1 );
+  auto maxexp = nelem / 2;
+
+  m_dest.assign( nelem, -1 );
+  std::size_t nexp = 0;
+  for (const auto& [ c, load ] : m_nbrload) {
+    const auto& [ n, bndnodes ] = load;
+    if (n >= nelem || nexp >= maxexp) continue;
+    auto quota = std::min( maxexp - nexp, static_cast< std::size_t >(
+                   alpha * static_cast< tk::real >( nelem - n ) ) );
+    if (quota == 0) continue;
+    std::unordered_set< std::size_t > shared( begin(bndnodes), end(bndnodes) );
+    // Seed walk with elements whose boundary faces are shared with neighbor
+    std::vector< std::size_t > front;
+    for (std::size_t e=0; e<nelem; ++e) {
+      if (m_dest[e] != -1) continue;
+      auto mark = e*4;
+      for (std::size_t f=0; f<4; ++f)
+        if (esuel[mark+f] == -1 &&
+            shared.count( m_ginpoel[ mark+tk::lpofa[f][0] ] ) &&
+            shared.count( m_ginpoel[ mark+tk::lpofa[f][1] ] ) &&
+            shared.count( m_ginpoel[ mark+tk::lpofa[f][2] ] ))
+        {
+          front.push_back( e );
+          break;
+        }
+    }
+    // Grow selection across element faces until quota is reached
+    std::size_t q = 0;
+    for (std::size_t i=0; i<front.size() && q<quota; ++i) {
+      auto e = front[i];
+      if (m_dest[e] != -1) continue;
+      m_dest[e] = c;
+      ++q;
+      for (std::size_t f=0; f<4; ++f) {
+        auto nb = esuel[e*4+f];
+        if (nb != -1 && m_dest[ static_cast<std::size_t>(nb) ] == -1)
+          front.push_back( static_cast< std::size_t >( nb ) );
+      }
+    }
+    nexp += q;
+  }
+
+  // Side sets of boundary faces and nodes
+  std::unordered_map< Face, std::vector< int >, Hash<3>, Eq<3> > bndfaces;
+  for (const auto& [ setid, faceids ] : m_bface)
+    for (auto f : faceids)
+      bndfaces[ {{ m_triinpoel[f*3+0], m_triinpoel[f*3+1],
+                   m_triinpoel[f*3+2] }} ].push_back( setid );
+  std::unordered_map< std::size_t, std::vector< int > > bndnodes;
+  for (const auto& [ setid, nodes ] : m_bnode)
+    for (auto n : nodes) bndnodes[ n ].push_back( setid );
+
+  // Assemble elements, coordinates, and side sets to send to neighbors
+  std::unordered_map< int, std::vector< std::size_t > > expinpoel;
+  std::unordered_map< int, tk::UnsMesh::CoordMap > expcoordmap;
+  std::unordered_map< int, std::map< int, std::vector< std::size_t > > >
+    expbface, expbnode;
+  for (std::size_t e=0; e<nelem; ++e) {
+    auto c = m_dest[e];
+    if (c == -1) continue;
+    auto mark = e*4;
+    auto& g = expinpoel[ c ];
+    auto& cm = expcoordmap[ c ];
+    auto& bn = expbnode[ c ];
+    for (std::size_t n=0; n<4; ++n) {
+      auto p = m_ginpoel[ mark+n ];
+      g.push_back( p );
+      cm[ p ] = tk::cref_find( m_coordmap, p );
+      auto it = bndnodes.find( p );
+      if (it != end(bndnodes))
+        for (auto s : it->second) bn[ s ].push_back( p );
+    }
+    auto& bf = expbface[ c ];
+    for (std::size_t f=0; f<4; ++f) {
+      Face t{{ m_ginpoel[ mark+tk::lpofa[f][0] ],
+               m_ginpoel[ mark+tk::lpofa[f][1] ],
+               m_ginpoel[ mark+tk::lpofa[f][2] ] }};
+      auto it = bndfaces.find( t );
+      if (it != end(bndfaces))
+        for (auto s : it->second)
+          bf[ s ].insert( end(bf[s]), begin(it->first), end(it->first) );
+    }
+  }
+
+  for (auto c : m_ch)
+    thisProxy[ c ].addElems( thisIndex, expinpoel[c], expcoordmap[c],
+                             expbface[c], expbnode[c] );
+
+  if (++m_nmig == m_ch.size()+1) migrate();
+}
+
+void
+Refiner::addElems( [[maybe_unused]] int fromch,
+                   const std::vector< std::size_t >& ginpoel,
+                   const tk::UnsMesh::CoordMap& coordmap,
+                   const std::map< int, std::vector< std::size_t > >& bface,
+                   const std::map< int, std::vector< std::size_t > >& bnode )
+// *****************************************************************************
+// Receive elements migrated from a neighbor chare
+//! \param[in] fromch Sender chare ID
+//! \param[in] ginpoel Connectivity of migrated elements using global node IDs
+//! \param[in] coordmap Coordinates of nodes of migrated elements
+//! \param[in] bface Boundary face-node connectivity (global ids) of migrated
+//!   elements associated to side set ids
+//! \param[in] bnode Boundary nodes of migrated elements associated to side
+//!   set ids
+//! \details Received data is only buffered here, so that the mesh does not
+//!   change while selecting our own elements to export, see migrate().
+// *****************************************************************************
+{
+  m_impinpoel.insert( end(m_impinpoel), begin(ginpoel), end(ginpoel) );
+  m_impcoordmap.insert( begin(coordmap), end(coordmap) );
+  for (const auto& [ setid, faces ] : bface) {
+    auto& f = m_impbface[ setid ];
+    f.insert( end(f), begin(faces), end(faces) );
+  }
+  for (const auto& [ setid, nodes ] : bnode) {
+    auto& n = m_impbnode[ setid ];
+    n.insert( end(n), begin(nodes), end(nodes) );
+  }
+
+  if (++m_nmig == m_ch.size()+1) migrate();
+}
+
+void
+Refiner::migrate()
+// *****************************************************************************
+// Finish a round of element migration: update mesh with moved elements
+//! \details Elements sent to neighbors are removed and elements received are
+//!   appended to our mesh chunk together with their side set faces and nodes.
+//!   Local mesh data is then regenerated the same way as after reordering, see
+//!   reorder(). Since elements may have moved to chares we did not share
+//!   edges with before, the chares we share edges with are regenerated before
+//!   measuring the load imbalance after this round of migration, see
+//!   migrated().
+// *****************************************************************************
+{
+  // Faces of exported elements
+  FaceSet expfaces;
+  for (std::size_t e=0; e<m_dest.size(); ++e)
+    if (m_dest[e] != -1)
+      for (std::size_t f=0; f<4; ++f)
+        expfaces.insert( {{ m_ginpoel[ e*4+tk::lpofa[f][0] ],
+                            m_ginpoel[ e*4+tk::lpofa[f][1] ],
+                            m_ginpoel[ e*4+tk::lpofa[f][2] ] }} );
+
+  // Keep elements not exported and append elements received
+  std::vector< std::size_t > ginpoel;
+  for (std::size_t e=0; e<m_dest.size(); ++e)
+    if (m_dest[e] == -1)
+      ginpoel.insert( end(ginpoel), begin(m_ginpoel)+e*4,
+                      begin(m_ginpoel)+e*4+4 );
+  ginpoel.insert( end(ginpoel), begin(m_impinpoel), end(m_impinpoel) );
+  m_ginpoel = std::move( ginpoel );
+  std::unordered_set< std::size_t > nodes( begin(m_ginpoel), end(m_ginpoel) );
+
+  // Remove coordinates of nodes no longer in our chunk, add received ones
+  for (auto it = begin(m_coordmap); it != end(m_coordmap); )
+    if (nodes.find(it->first) == end(nodes))
+      it = m_coordmap.erase( it );
+    else
+      ++it;
+  m_coordmap.insert( begin(m_impcoordmap), end(m_impcoordmap) );
+
+  // Regenerate boundary faces: keep those of our remaining elements
+  std::map< int, std::vector< std::size_t > > bface;
+  std::vector< std::size_t > triinpoel;
+  std::size_t facecnt = 0;
+  for (const auto& [ setid, faceids ] : m_bface)
+    for (auto f : faceids) {
+      Face t{{ m_triinpoel[f*3+0], m_triinpoel[f*3+1], m_triinpoel[f*3+2] }};
+      if (expfaces.find(t) == end(expfaces)) {
+        bface[ setid ].push_back( facecnt++ );
+        triinpoel.insert( end(triinpoel), begin(t), end(t) );
+      }
+    }
+  for (const auto& [ setid, faces ] : m_impbface) {
+    auto& b = bface[ setid ];
+    for (std::size_t f=0; f<faces.size()/3; ++f) b.push_back( facecnt++ );
+    triinpoel.insert( end(triinpoel), begin(faces), end(faces) );
+  }
+  m_bface = std::move( bface );
+  m_triinpoel = std::move( triinpoel );
+
+  // Regenerate boundary nodes: keep those still in our chunk
+  for (const auto& [ setid, n ] : m_impbnode) {
+    auto& b = m_bnode[ setid ];
+    b.insert( end(b), begin(n), end(n) );
+  }
+  for (auto& [ setid, n ] : m_bnode) {
+    n.erase( std::remove_if( begin(n), end(n), [&]( std::size_t p ){
+               return nodes.find(p) == end(nodes); } ), end(n) );
+    tk::unique( n );
+  }
+
+  // Update local mesh data with the rebalanced one
+  m_el = tk::global2local( m_ginpoel );     // fills m_inpoel, m_gid, m_lid
+  m_coord = flatcoord( m_coordmap );
+  m_rid.resize( m_gid.size() );
+  std::iota( begin(m_rid), end(m_rid), 0 );
+  tk::destroy( m_lref );
+  std::size_t i = 0;
+  for (auto r : m_rid) m_lref[r] = i++;
+  m_refiner = AMR::mesh_adapter_t( m_inpoel );
+
+  Assert( tk::positiveJacobians( m_inpoel, m_coord ),
+          "Rebalanced mesh cell Jacobian non-positive" );
+  Assert( !tk::leakyPartition(
+            tk::genEsuelTet( m_inpoel, tk::genEsup(m_inpoel,4) ),
+            m_inpoel, m_coord ),
+          "Rebalanced mesh partition leaky" );
+
+  // Prepare for next round of migration
+  tk::destroy( m_nbrload );
+  tk::destroy( m_dest );
+  tk::destroy( m_impinpoel );
+  tk::destroy( m_impcoordmap );
+  tk::destroy( m_impbface );
+  tk::destroy( m_impbnode );
+  m_nmig = 0;
+
+  // Regenerate boundary data of the coarse mesh and discard data of the mesh
+  // before migration, used only during refinement/derefinement
+  coarseBnd();
+  tk::destroy( m_parent );
+  tk::destroy( m_oldTets );
+  tk::destroy( m_addedNodes );
+  tk::destroy( m_addedTets );
+  tk::destroy( m_oldrid );
+  tk::destroy( m_nodeCommMap );
+
+  // Regenerate chares we share at least an edge with
+  m_ch.clear();
+  m_rebal = true;
+  bndEdges();
+}
+
+void
+Refiner::migrated()
+// *****************************************************************************
+// Continue after regenerating shared boundary edges after element migration
+// *****************************************************************************
+{
+  tk::destroy( m_edgech );
+  tk::destroy( m_chedge );
+  m_rebal = false;
+
+  loadstat();
+}
+
+void
+Refiner::sort()
+// *****************************************************************************
+// Create mesh sorter and continue with reordering the mesh
+//! \details This is called after initial mesh refinement and optional
+//!   rebalancing, and computes the total number of elements across the whole
+//!   problem.
 // *****************************************************************************
 {
   // create sorter Charm++ chare array elements using dynamic insertion
@@ -18,6 +18,7 @@
 #ifndef Refiner_h
 #define Refiner_h
 
+#include <map>
 #include <vector>
 #include <unordered_map>
 
@@ -136,6 +137,28 @@ class Refiner : public CBase_Refiner {
     //! Send Refiner proxy to Discretization objects
     void sendProxy();
 
+    //! Start a round of diffusive element migration among neighbor chares
+    void rebalance();
+
+    //! Receive element count and chare-boundary nodes of a neighbor chare
+    void nbrload( int fromch,
+                  std::size_t nelem,
+                  const std::vector< std::size_t >& bndnodes );
+
+    //! Receive elements migrated from a neighbor chare
+    void addElems( int fromch,
+                   const std::vector< std::size_t >& ginpoel,
+                   const tk::UnsMesh::CoordMap& coordmap,
+                   const std::map< int, std::vector< std::size_t > >& bface,
+                   const std::map< int, std::vector< std::size_t > >& bnode );
+
+    //! \brief Continue after regenerating shared boundary edges after element
+    //!   migration
+    void migrated();
+
+    //! Create mesh sorter and continue with reordering the mesh
+    void sort();
+
     //! Get refinement field data in mesh cells
     std::tuple< std::vector< std::string >,
                 std::vector< std::vector< tk::real > >,
@@ -192,6 +215,14 @@ class Refiner : public CBase_Refiner {
       p | m_lref;
       //p | m_oldlref;
       p | m_parent;
+      p | m_nbrload;
+      p | m_dest;
+      p | m_nmig;
+      p | m_rebal;
+      p | m_impinpoel;
+      p | m_impcoordmap;
+      p | m_impbface;
+      p | m_impbnode;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -292,6 +323,25 @@ class Refiner : public CBase_Refiner {
     //std::unordered_map< std::size_t, std::size_t > m_oldlref;
     //! Child -> parent tet map
     std::unordered_map< Tet, Tet, Hash<4>, Eq<4> > m_parent;
+    //! \brief Number of elements and chare-boundary nodes (global ids) of
+    //!   neighbor chares associated to their chare ids, used for rebalancing
+    std::map< int, std::pair< std::size_t, std::vector< std::size_t > > >
+      m_nbrload;
+    //! Destination chare id of our elements during rebalancing (-1: keep)
+    std::vector< int > m_dest;
+    //! Counter for completing a round of element migration
+    std::size_t m_nmig;
+    //! True while regenerating shared boundary edges after element migration
+    bool m_rebal;
+    //! Connectivity (global ids) of elements received during rebalancing
+    std::vector< std::size_t > m_impinpoel;
+    //! Coordinates of nodes of elements received during rebalancing
+    tk::UnsMesh::CoordMap m_impcoordmap;
+    //! \brief Boundary face-node connectivity (global ids) associated to side
+    //!   set ids of faces received during rebalancing
+    std::map< int, std::vector< std::size_t > > m_impbface;
+    //! Boundary nodes associated to side set ids received during rebalancing
+    std::map< int, std::vector< std::size_t > > m_impbnode;
 
     //! (Re-)generate boundary data structures for coarse mesh
     void coarseBnd();
@@ -305,9 +355,24 @@ class Refiner : public CBase_Refiner {
     //! Generate boundary edges and send them to all chares
     void bndEdges();
 
+    //! Signal that we have queried our boundary edges
+    void queried();
+
+    //! Signal that we have setup our shared boundary edges
+    void responded();
+
     //! Finish initiel mesh refinement
     void endt0ref();
 
+    //! Contribute number of elements to measure load imbalance
+    void loadstat();
+
+    //! Select and send elements to less loaded neighbor chares
+    void exportElems();
+
+    //! Finish a round of element migration: update mesh with moved elements
+    void migrate();
+
     //! Do uniform mesh refinement
     void uniformRefine();
 
@@ -374,7 +439,7 @@ class Refiner : public CBase_Refiner {
     void writeMesh( const std::string& basefilename,
                     uint64_t it,
                     tk::real t,
-                    CkCallback c ) const;
+                    CkCallback c );
 
     //! Compute partial boundary surface integral and sum across all chares
     bool bndIntegral();
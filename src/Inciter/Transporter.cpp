@@ -62,6 +62,8 @@ Transporter::Transporter() :
   m_ncit( 0 ),
   m_nt0refit( 0 ),
   m_ndtrefit( 0 ),
+  m_nrebal( 0 ),
+  m_nckpt( 0 ),
   m_scheme( g_inputdeck.get< tag::discr, tag::scheme >() ),
   m_partitioner(),
   m_refiner(),
@@ -214,6 +216,8 @@ Transporter::info( const InciterPrint& print )
                 g_inputdeck.get< tag::pref, tag::ndofmax >() );
     print.item( "Tolerance",
                 g_inputdeck.get< tag::pref, tag::tolref >() );
+    print.item( "Load imbalance tolerance",
+                g_inputdeck.get< tag::pref, tag::lbtol >() );
   }
 
   // Print out adaptive mesh refinement configuration
@@ -273,15 +277,35 @@ Transporter::info( const InciterPrint& print )
                 g_inputdeck.get< tag::amr, tag::tolref >() );
     print.item( "De-refinement tolerance",
                 g_inputdeck.get< tag::amr, tag::tolderef >() );
+    if (t0ref) {
+      auto rebalance = g_inputdeck.get< tag::amr, tag::rebalance >();
+      print.item( "Rebalance after refinement at t<0", rebalance );
+      if (rebalance) {
+        print.item( "Load imbalance threshold",
+                    g_inputdeck.get< tag::amr, tag::imbalance >() );
+        print.item( "Maximum number of rebalancing rounds",
+                    g_inputdeck.get< tag::amr, tag::maxrebal >() );
+      }
+    }
   }
 
   // Print I/O filenames
   print.section( "Output filenames and directories" );
   const auto& of = g_inputdeck.get< tag::cmd, tag::io, tag::output >();
-  print.item( "Volume field output file(s)",
-              of + ".e-s.<meshid>.<numchares>.<chareid>" );
-  print.item( "Surface field output file(s)",
-              of + "-surf.<surfid>.e-s.<meshid>.<numchares>.<chareid>" );
+  if (g_inputdeck.get< tag::cmd, tag::io, tag::aggregate >() &&
+      g_inputdeck.get< tag::selected, tag::filetype >() ==
+        tk::ctr::FieldFileType::EXODUSII)
+  {
+    print.item( "Volume field output file(s)",
+                of + ".e-s.<meshid>.<numnodes>.<nodeid>" );
+    print.item( "Surface field output file(s)",
+                of + "-surf.<surfid>.e-s.<meshid>.<numnodes>.<nodeid>" );
+  } else {
+    print.item( "Volume field output file(s)",
+                of + ".e-s.<meshid>.<numchares>.<chareid>" );
+    print.item( "Surface field output file(s)",
+                of + "-surf.<surfid>.e-s.<meshid>.<numchares>.<chareid>" );
+  }
   print.item( "History output file(s)", of + ".hist.{<px>_<py>_<pz>}" );
   print.item( "Diagnostics file",
               g_inputdeck.get< tag::cmd, tag::io, tag::diag >() );
@@ -292,10 +316,28 @@ Transporter::info( const InciterPrint& print )
   print.section( "Output intervals" );
   print.item( "TTY", g_inputdeck.get< tag::interval, tag::tty>() );
   print.item( "Field", g_inputdeck.get< tag::interval, tag::field >() );
+  const auto inflight = g_inputdeck.get< tag::cmd, tag::io, tag::inflight >();
+  if (inflight > 0) print.item( "Field outputs in flight", inflight );
+  const auto compress = g_inputdeck.get< tag::cmd, tag::io, tag::compress >();
+  if (compress > 0) print.item( "Field output compression level", compress );
+  const auto& errbound = g_inputdeck.get< tag::cmd, tag::io, tag::errbound >();
+  if (!errbound.empty())
+    print.item( "Field output error bounds", tk::parameters( errbound ) );
   print.item( "Diagnostics",
               g_inputdeck.get< tag::interval, tag::diag >() );
   print.item( "Checkpoint/restart",
               g_inputdeck.get< tag::cmd, tag::rsfreq >() );
+  #if CMK_MEM_CHECKPOINT
+  const auto memckpt = g_inputdeck.get< tag::cmd, tag::memckpt >();
+  print.item( "In-memory checkpoint", memckpt );
+  if (memckpt)
+    print.item( "In-memory checkpoint disk frequency",
+                g_inputdeck.get< tag::cmd, tag::diskfreq >() );
+  #else
+  if (g_inputdeck.get< tag::cmd, tag::memckpt >())
+    print << "\n>>> WARNING: In-memory checkpointing not supported by "
+             "Charm++, checkpointing to disk\n\n";
+  #endif
 
   const auto outsets = g_inputdeck.outsets();
   if (!outsets.empty()) {
@@ -428,6 +470,7 @@ Transporter::createPartitioner()
     , CkCallback( CkReductionTarget(Transporter,compatibility), thisProxy )
     , CkCallback( CkReductionTarget(Transporter,bndint), thisProxy )
     , CkCallback( CkReductionTarget(Transporter,matched), thisProxy )
+    , CkCallback( CkReductionTarget(Transporter,imbalance), thisProxy )
     , CkCallback( CkReductionTarget(Transporter,refined), thisProxy )
   }};
 
@@ -455,7 +498,10 @@ Transporter::createPartitioner()
   m_meshwriter = tk::CProxy_MeshWriter::ckNew(
                     g_inputdeck.get< tag::selected, tag::filetype >(),
                     centering,
-                    g_inputdeck.get< tag::cmd, tag::benchmark >() );
+                    g_inputdeck.get< tag::cmd, tag::benchmark >(),
+                    g_inputdeck.get< tag::cmd, tag::io, tag::aggregate >(),
+                    g_inputdeck.get< tag::cmd, tag::io, tag::compress >(),
+                    g_inputdeck.get< tag::cmd, tag::io, tag::errbound >() );
 
   // Create mesh partitioner Charm++ chare nodegroup
   m_partitioner =
@@ -639,6 +685,46 @@ Transporter::matched( std::size_t nextra,
   }
 }
 
+void
+Transporter::imbalance( tk::real nmax, tk::real nmin )
+// *****************************************************************************
+// Reduction target: all mesh refiner chares have contributed their element
+// counts after initial mesh refinement or a round of rebalancing
+//! \param[in] nmax Largest number of elements on a single chare
+//! \param[in] nmin Negative of the smallest number of elements on a chare
+//! \details The load imbalance is measured as the ratio of the largest and
+//!   smallest number of mesh elements on a refiner chare. If this exceeds the
+//!   threshold configured, and we have not yet exhausted the maximum number of
+//!   rebalancing rounds configured, another round of diffusive element
+//!   migration is started. Otherwise the refiner chares continue with
+//!   reordering the mesh. The imbalance is reported as the percentage by which
+//!   the largest chunk exceeds the smallest, i.e., zero if perfectly balanced.
+// *****************************************************************************
+{
+  nmin = -nmin;
+  auto imb = nmax / std::max( nmin, 1.0 );
+
+  auto print = printer();
+
+  if (!g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    // report imbalance as percentage of the largest chunk above the smallest
+    auto pct = std::round( 100.0 * (imb - 1.0) );
+    print.diag( { "rebal", "max", "min", "imbalance%" },
+                { m_nrebal, static_cast< std::size_t >( nmax ),
+                  static_cast< std::size_t >( nmin ),
+                  static_cast< std::size_t >( pct ) } );
+  }
+
+  if (imb > g_inputdeck.get< tag::amr, tag::imbalance >() &&
+      m_nrebal < g_inputdeck.get< tag::amr, tag::maxrebal >())
+  {
+    ++m_nrebal;
+    m_refiner.rebalance();
+  } else {
+    m_refiner.sort();
+  }
+}
+
 void
 Transporter::bndint( tk::real sx, tk::real sy, tk::real sz, tk::real cb )
 // *****************************************************************************
@@ -823,6 +909,11 @@ Transporter::diagHeader()
       d.push_back( errname + '(' + var[i] + "-IC)" );
   }
 
+  // Add volume fraction of elements limited if the troubled-cell indicator
+  // gates the DG limiter
+  if (g_inputdeck.get< tag::discr, tag::shock_detector_coeff >() > 0.0)
+    d.push_back( "limited" );
+
   // Write diagnostics header
   dw.header( d );
 }
@@ -1069,6 +1160,10 @@ Transporter::diagnostics( CkReductionMsg* msg )
     }
   }
 
+  // Finish computing the volume fraction of elements limited
+  if (g_inputdeck.get< tag::discr, tag::shock_detector_coeff >() > 0.0)
+    diag.push_back( d[LIMVOL][0] / m_meshvol );
+
   // Append diagnostics file at selected times
   tk::DiagWriter dw( g_inputdeck.get< tag::cmd, tag::io, tag::diag >(),
                      g_inputdeck.get< tag::flformat, tag::diag >(),
@@ -1098,26 +1193,93 @@ Transporter::resume()
     // increased nrestart in g_inputdeck, but only on PE 0, so broadcast.
     auto nrestart = g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >();
     m_scheme.bcast< Scheme::evalLB >( nrestart );
+  } else if (!g_inputdeck.get< tag::cmd, tag::benchmark >() &&
+             (g_inputdeck.get< tag::cmd, tag::io, tag::compress >() > 0 ||
+              !g_inputdeck.get< tag::cmd, tag::io, tag::errbound >().empty()))
+  {
+    // Report field output size before finishing
+    m_meshwriter.stats(
+      CkCallback( CkReductionTarget(Transporter,outstat), thisProxy ) );
   } else
     mainProxy.finalize();
 }
 
+void
+Transporter::outstat( std::size_t raw, std::size_t disk )
+// *****************************************************************************
+// Reduction target: report field output size
+//! \param[in] raw Sum (across all PEs) of the estimated uncompressed size of
+//!   mesh and field output in bytes
+//! \param[in] disk Sum (across all PEs) of the size of mesh and field output
+//!   files on disk in bytes
+// *****************************************************************************
+{
+  auto print = printer();
+
+  print.section( "Field output size" );
+  print.item( "Uncompressed estimate (MB)", static_cast<tk::real>(raw)/1.0e6 );
+  print.item( "Size on disk (MB)", static_cast<tk::real>(disk)/1.0e6 );
+  if (disk > 0)
+    print.item( "Compression ratio",
+                static_cast<tk::real>(raw) / static_cast<tk::real>(disk) );
+  print.endsubsection();
+
+  mainProxy.finalize();
+}
+
 void
 Transporter::checkpoint( tk::real it, tk::real t )
 // *****************************************************************************
 // Save checkpoint/restart files
 //! \param[in] it Iteration count
 //! \param[in] t Physical time
+//! \details If in-memory checkpointing is selected, checkpoints during time
+//!   stepping are stored in memory of buddy PEs instead of the file system,
+//!   and every diskfreq-th in-memory checkpoint is also written to disk.
 // *****************************************************************************
 {
   m_it = static_cast< uint64_t >( it );
   m_t = t;
+  ++m_nckpt;
 
+  const auto diskfreq = g_inputdeck.get< tag::cmd, tag::diskfreq >();
+  writeCheckpoint( !g_inputdeck.get< tag::cmd, tag::memckpt >(),
+                   diskfreq > 0 && m_nckpt % diskfreq == 0 );
+}
+
+void
+Transporter::flushCheckpoint()
+// *****************************************************************************
+// Write checkpoint/restart files to disk after an in-memory checkpoint
+// *****************************************************************************
+{
+  writeCheckpoint( /* disk = */ true );
+}
+
+void
+Transporter::writeCheckpoint( [[maybe_unused]] bool disk,
+                              [[maybe_unused]] bool flush )
+// *****************************************************************************
+// Save checkpoint to disk or memory and resume
+//! \param[in] disk True to save checkpoint/restart files to disk, false to
+//!   store an in-memory (double) checkpoint, if supported by Charm++
+//! \param[in] flush True to also write checkpoint/restart files to disk after
+//!   the in-memory checkpoint has been stored
+// *****************************************************************************
+{
   const auto benchmark = g_inputdeck.get< tag::cmd, tag::benchmark >();
 
   if (!benchmark) {
-    const auto& restart = g_inputdeck.get< tag::cmd, tag::io, tag::restart >();
     CkCallback res( CkIndex_Transporter::resume(), thisProxy );
+    #if CMK_MEM_CHECKPOINT
+    if (!disk) {
+      if (flush)
+        res = CkCallback( CkIndex_Transporter::flushCheckpoint(), thisProxy );
+      CkStartMemCheckpoint( res );
+      return;
+    }
+    #endif
+    const auto& restart = g_inputdeck.get< tag::cmd, tag::io, tag::restart >();
     CkStartCheckpoint( restart.c_str(), res );
   } else {
     resume();
@@ -1130,9 +1292,14 @@ Transporter::finish( tk::real it, tk::real t )
 // Normal finish of time stepping
 //! \param[in] it Iteration count
 //! \param[in] t Physical time
+//! \details The final checkpoint is always written to disk so that a new run
+//!   can be restarted from it.
 // *****************************************************************************
 {
-  checkpoint( it, t );
+  m_it = static_cast< uint64_t >( it );
+  m_t = t;
+
+  writeCheckpoint( /* disk = */ true );
 }
 
 #include "NoWarning/transporter.def.h"
@@ -114,6 +114,10 @@ class Transporter : public CBase_Transporter {
     void matched( std::size_t nextra, std::size_t nref, std::size_t nderef,
                   std::size_t initial );
 
+    //! \brief Reduction target: all mesh refiner chares have contributed their
+    //!   element counts after initial mesh refinement or rebalancing
+    void imbalance( tk::real nmax, tk::real nmin );
+
     //! Compute surface integral across the whole problem and perform leak-test
     void bndint( tk::real sx, tk::real sy, tk::real sz, tk::real cb );
 
@@ -191,9 +195,15 @@ class Transporter : public CBase_Transporter {
     //! Resume execution from checkpoint/restart files
     void resume();
 
+    //! Reduction target: report field output size
+    void outstat( std::size_t raw, std::size_t disk );
+
     //! Save checkpoint/restart files
     void checkpoint( tk::real it, tk::real t );
 
+    //! Write checkpoint/restart files to disk after an in-memory checkpoint
+    void flushCheckpoint();
+
     //! Normal finish of time stepping
     void finish( tk::real it, tk::real t );
 
@@ -208,6 +218,8 @@ class Transporter : public CBase_Transporter {
       p | m_ncit;
       p | m_nt0refit;
       p | m_ndtrefit;
+      p | m_nrebal;
+      p | m_nckpt;
       p | m_scheme;
       p | m_partitioner;
       p | m_refiner;
@@ -234,6 +246,8 @@ class Transporter : public CBase_Transporter {
     std::size_t m_ncit;                  //!< Number of mesh ref corr iter
     std::size_t m_nt0refit;              //!< Number of (t<0) mesh ref iters
     std::size_t m_ndtrefit;              //!< Number of (t>0) mesh ref iters
+    std::size_t m_nrebal;                //!< Number of rebalancing rounds
+    std::size_t m_nckpt;                 //!< Number of checkpoints taken
     Scheme m_scheme;                     //!< Discretization scheme
     CProxy_Partitioner m_partitioner;    //!< Partitioner nodegroup proxy
     CProxy_Refiner m_refiner;            //!< Mesh refiner array proxy
@@ -260,6 +274,9 @@ class Transporter : public CBase_Transporter {
     //! Progress object for preparing workers
     tk::Progress< 5 > m_progWork;
 
+    //! Save checkpoint to disk or memory and resume
+    void writeCheckpoint( bool disk, bool flush = false );
+
     //! Create mesh partitioner and boundary condition object group
     void createPartitioner();
 
@@ -17,6 +17,7 @@
 #include "TestU01Suite.hpp"
 #include "RNGTestPrint.hpp"
 #include "RNGTestDriver.hpp"
+#include "Random123Benchmark.hpp"
 #include "RNGTest/InputDeck/InputDeck.hpp"
 #include "RNGTest/InputDeck/Parser.hpp"
 #include "TaggedTupleDeepPrint.hpp"
@@ -36,7 +37,8 @@ RNGTestDriver::RNGTestDriver( const ctr::CmdLine& cmdline, int nrestart ) :
              g_inputdeck_defaults.get< tag::cmd, tag::io, tag::screen >(),
              nrestart ),
            cmdline.get< tag::verbose >() ? std::cout : std::clog,
-           std::ios_base::app )
+           std::ios_base::app ),
+  m_benchmark( cmdline.get< tag::benchmark >() )
 // *****************************************************************************
 //  Constructor
 //! \param[in] cmdline Command line object storing data parsed from the command
@@ -48,6 +50,8 @@ RNGTestDriver::RNGTestDriver( const ctr::CmdLine& cmdline, int nrestart ) :
 
   // Parse input deck into g_inputdeck
   m_print.item( "Control file", cmdline.get< tag::io, tag::control >() );  
+  const auto& cost = cmdline.get< tag::io, tag::costmodel >();
+  if (!cost.empty()) m_print.item( "Test cost file", cost );
   InputDeckParser inputdeckParser( m_print, cmdline, g_inputdeck );
   m_print.item( "Parsed control file", "success" );  
 
@@ -63,8 +67,16 @@ void
 RNGTestDriver::execute() const
 // *****************************************************************************
 //  Run battery
+//! \details In benchmark mode the throughput of the Random123 RNG wrapper is
+//!   measured before running the battery.
 // *****************************************************************************
 {
+  if (m_benchmark) {
+    m_print.part( "Benchmark" );
+    benchmarkRandom123( m_print );
+    m_print.endpart();
+  }
+
   m_print.part( "Factory" );
 
   // Register batteries
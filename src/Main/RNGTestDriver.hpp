@@ -40,6 +40,7 @@ class RNGTestDriver {
 
   private:
     const RNGTestPrint m_print;
+    const bool m_benchmark;     //!< True if running in benchmark mode
 };
 
 } // rngtest::
@@ -27,6 +27,7 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Base/TestPUPUtil.cpp
                ../../tests/unit/Base/TestReader.cpp
                ../../tests/unit/Base/TestPrintUtil.cpp
+               ../../tests/unit/Base/TestTable.cpp
                ../../tests/unit/Base/TestTaggedTuple.cpp
                ../../tests/unit/Base/TestTaggedTuplePrint.cpp
                ../../tests/unit/Base/TestTaggedTupleDeepPrint.cpp
@@ -44,6 +45,8 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Control/TestToggle.cpp
                ../../tests/unit/${TestScheme}
                ../../tests/unit/${TestError}
+               ../../tests/unit/${TestShockIndicator}
+               ${SHOCKINDICATOR}
                ../../tests/unit/IO/TestExodusIIMeshReader.cpp
                ../../tests/unit/IO/TestMesh.cpp
                ../../tests/unit/IO/TestMeshReader.cpp
@@ -55,6 +58,9 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Mesh/TestDerivedData_MPISingle.cpp
                ../../tests/unit/Mesh/TestGradients.cpp
                ../../tests/unit/Mesh/TestReorder.cpp
+               ../../tests/unit/Particles/TestParticleStore.cpp
+               ../../tests/unit/Particles/TestCellLocator.cpp
+               ../Particles/CellLocator.cpp
                ../../tests/unit/${TestMKLRNG}
                ../../tests/unit/${TestRNGSSE}
                ../../tests/unit/RNG/TestRNG.cpp
@@ -66,6 +72,8 @@ target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${QUINOA_SOURCE_DIR}/LoadBalance
                            ${QUINOA_SOURCE_DIR}/IO
                            ${QUINOA_SOURCE_DIR}/RNG
+                           ${QUINOA_SOURCE_DIR}/Particles
+                           ${QUINOA_SOURCE_DIR}/PDE
                            ${TUT_INCLUDE_DIRS}
                            ${LAPACKE_INCLUDE_DIRS}
                            ${RANDOM123_INCLUDE_DIRS}
@@ -139,17 +139,18 @@ class CompFlow {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
-    //! \param[in] inpoel Element-node connectivity
-    //! \param[in] coord Array of nodal coordinates
+    //! \param[in] lsop Least-squares reconstruction operators of all elements
     //! \param[in,out] U Solution vector at recent time step
     //! \param[in,out] P Primitive vector at recent time step
     void reconstruct( tk::real t,
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
-                      const std::map< std::size_t, std::vector< std::size_t > >&,
-                      const std::vector< std::size_t >& inpoel,
-                      const tk::UnsMesh::Coords& coord,
+                      const std::pair< std::vector< std::size_t >,
+                                       std::vector< std::size_t > >&,
+                      const std::vector< std::size_t >&,
+                      const tk::UnsMesh::Coords&,
+                      const std::vector< tk::real >& lsop,
                       tk::Fields& U,
                       tk::Fields& P ) const
     {
@@ -161,20 +162,11 @@ class CompFlow {
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
-      // allocate and initialize matrix and vector for reconstruction
-      std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-        lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}} }} );
-      std::vector< std::vector< std::array< tk::real, 3 > > >
-        rhs_ls( nelem, std::vector< std::array< tk::real, 3 > >
-          ( m_ncomp,
-            {{ 0.0, 0.0, 0.0 }} ) );
-
-      // reconstruct x,y,z-derivatives of unknowns
-      // 0. get lhs matrix, which is only geometry dependent
-      tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
+      // allocate and initialize vector for reconstruction
+      std::vector< tk::real > rhs_ls( nelem*m_ncomp*3, 0.0 );
 
+      // reconstruct x,y,z-derivatives of unknowns (the lhs matrix, which is
+      // only geometry dependent, is part of the precomputed operators, lsop)
       // 1. internal face contributions
       tk::intLeastSq_P0P1( m_ncomp, m_offset, rdof, fd, geoElem, U, rhs_ls );
 
@@ -183,11 +175,9 @@ class CompFlow {
         tk::bndLeastSqConservedVar_P0P1( m_system, m_ncomp, m_offset, rdof,
           b.first, fd, geoFace, geoElem, t, b.second, P, U, rhs_ls );
 
-      // 3. solve 3x3 least-squares system
-      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhs_ls, rhs_ls, U );
-
-      // 4. transform reconstructed derivatives to Dubiner dofs
-      tk::transform_P0P1( m_ncomp, m_offset, rdof, nelem, inpoel, coord, U );
+      // 3. solve 3x3 least-squares system and transform reconstructed
+      // derivatives to Dubiner dofs
+      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lsop, rhs_ls, U );
     }
 
     //! Limit second-order solution
@@ -198,24 +188,28 @@ class CompFlow {
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] ndofel Vector of local number of degrees of freedome
+    //! \param[in] shockmarker Nonzero for elements to limit
     //! \param[in,out] U Solution vector at recent time step
     void limit( [[maybe_unused]] tk::real t,
                 [[maybe_unused]] const tk::Fields& geoFace,
                 [[maybe_unused]] const tk::Fields& geoElem,
                 const inciter::FaceData& fd,
-                const std::map< std::size_t, std::vector< std::size_t > >&,
+                const std::pair< std::vector< std::size_t >,
+                                 std::vector< std::size_t > >&,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& shockmarker,
                 tk::Fields& U,
                 tk::Fields& ) const
     {
       const auto limiter = g_inputdeck.get< tag::discr, tag::limiter >();
 
       if (limiter == ctr::LimiterType::WENOP1)
-        WENO_P1( fd.Esuel(), m_offset, U );
+        WENO_P1( fd.Esuel(), m_offset, shockmarker, U );
       else if (limiter == ctr::LimiterType::SUPERBEEP1)
-        Superbee_P1( fd.Esuel(), inpoel, ndofel, m_offset, coord, U );
+        Superbee_P1( fd.Esuel(), inpoel, ndofel, shockmarker, m_offset, coord,
+                     U );
     }
 
     //! Compute right hand side
@@ -675,6 +669,14 @@ class CompFlow {
     std::vector< std::string > names() const
     { return m_problem.names( m_ncomp ); }
 
+    //! Return components used to detect shocks, see MarkShockCells()
+    //! \return Indices of density and total energy among all components
+    //! \details Similar to Krivodonova et al., Applied Numerical Mathematics,
+    //!   48(3-4), 323-338, 2004, only density and energy are used, as momentum
+    //!   may vanish in smooth regions where its normalized jump is not defined.
+    std::vector< ncomp_t > shockVars() const
+    { return { m_offset, m_offset+4 }; }
+
     //! Return analytic solution (if defined by Problem) at xi, yi, zi, t
     //! \param[in] xi X-coordinate at which to evaluate the analytic solution
     //! \param[in] yi Y-coordinate at which to evaluate the analytic solution
@@ -155,14 +155,17 @@ class DGPDE {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
-                      const std::map< std::size_t, std::vector< std::size_t > >&
+                      const std::pair< std::vector< std::size_t >,
+                                       std::vector< std::size_t > >&
                         esup,
                       const std::vector< std::size_t >& inpoel,
                       const tk::UnsMesh::Coords& coord,
+                      const std::vector< tk::real >& lsop,
                       tk::Fields& U,
                       tk::Fields& P ) const
     {
-      self->reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, U, P );
+      self->reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, lsop,
+                         U, P );
     }
 
     //! Public interface to limiting the second-order solution
@@ -170,14 +173,17 @@ class DGPDE {
                 const tk::Fields& geoFace,
                 const tk::Fields& geoElem,
                 const inciter::FaceData& fd,
-                const std::map< std::size_t, std::vector< std::size_t > >& esup,
+                const std::pair< std::vector< std::size_t >,
+                                 std::vector< std::size_t > >& esup,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& shockmarker,
                 tk::Fields& U,
                 tk::Fields& P ) const
     {
-      self->limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel, U, P );
+      self->limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel,
+                   shockmarker, U, P );
     }
 
     //! Public interface to computing the P1 right-hand side vector
@@ -213,6 +219,9 @@ class DGPDE {
     //! Public interface to returning variable names
     std::vector< std::string > names() const { return self->names(); }
 
+    //! Public interface to returning the components used to detect shocks
+    std::vector< ncomp_t > shockVars() const { return self->shockVars(); }
+
     //! Public interface to returning field output
     std::vector< std::vector< tk::real > > fieldOutput(
       tk::real t,
@@ -279,21 +288,23 @@ class DGPDE {
                                 const tk::Fields&,
                                 const tk::Fields&,
                                 const inciter::FaceData&,
-                                const std::map< std::size_t,
-                                  std::vector< std::size_t > >&,
+                                const std::pair< std::vector< std::size_t >,
+                                                 std::vector< std::size_t > >&,
                                 const std::vector< std::size_t >&,
                                 const tk::UnsMesh::Coords&,
+                                const std::vector< tk::real >&,
                                 tk::Fields&,
                                 tk::Fields& ) const = 0;
       virtual void limit( tk::real,
                           const tk::Fields&,
                           const tk::Fields&,
                           const inciter::FaceData&,
-                          const std::map< std::size_t,
-                            std::vector< std::size_t > >&,
+                          const std::pair< std::vector< std::size_t >,
+                                           std::vector< std::size_t > >&,
                           const std::vector< std::size_t >&,
                           const tk::UnsMesh::Coords&,
                           const std::vector< std::size_t >&,
+                          const std::vector< std::size_t >&,
                           tk::Fields&,
                           tk::Fields& ) const = 0;
       virtual void rhs( tk::real,
@@ -317,6 +328,7 @@ class DGPDE {
                            const std::size_t ) const = 0;
       virtual std::vector< std::string > fieldNames() const = 0;
       virtual std::vector< std::string > names() const = 0;
+      virtual std::vector< ncomp_t > shockVars() const = 0;
       virtual std::vector< std::vector< tk::real > > fieldOutput(
         tk::real,
         tk::real,
@@ -366,28 +378,33 @@ class DGPDE {
                         const tk::Fields& geoFace,
                         const tk::Fields& geoElem,
                         const inciter::FaceData& fd,
-                        const std::map< std::size_t,
-                          std::vector< std::size_t > >& esup,
+                        const std::pair< std::vector< std::size_t >,
+                                         std::vector< std::size_t > >& esup,
                         const std::vector< std::size_t >& inpoel,
                         const tk::UnsMesh::Coords& coord,
+                        const std::vector< tk::real >& lsop,
                         tk::Fields& U,
                         tk::Fields& P ) const override
       {
-        data.reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, U, P );
+        data.reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, lsop,
+                          U, P );
       }
       void limit( tk::real t,
                   const tk::Fields& geoFace,
                   const tk::Fields& geoElem,
                   const inciter::FaceData& fd,
-                  const std::map< std::size_t, std::vector< std::size_t > >&
+                  const std::pair< std::vector< std::size_t >,
+                                   std::vector< std::size_t > >&
                     esup,
                   const std::vector< std::size_t >& inpoel,
                   const tk::UnsMesh::Coords& coord,
                   const std::vector< std::size_t >& ndofel,
+                  const std::vector< std::size_t >& shockmarker,
                   tk::Fields& U,
                   tk::Fields& P ) const override
       {
-        data.limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel, U, P );
+        data.limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel,
+                    shockmarker, U, P );
       }
       void rhs( tk::real t,
                 const tk::Fields& geoFace,
@@ -416,6 +433,8 @@ class DGPDE {
       { return data.fieldNames(); }
       std::vector< std::string > names() const override
       { return data.names(); }
+      std::vector< ncomp_t > shockVars() const override
+      { return data.shockVars(); }
       std::vector< std::vector< tk::real > > fieldOutput(
         tk::real t,
         tk::real V,
@@ -14,8 +14,12 @@
 
 #include <array>
 #include <vector>
+#include <limits>
+#include <cmath>
+#include <algorithm>
 
 #include "Vector.hpp"
+#include "Around.hpp"
 #include "Limiter.hpp"
 #include "DerivedData.hpp"
 #include "Integrate/Quadrature.hpp"
@@ -29,11 +33,13 @@ extern ctr::InputDeck g_inputdeck;
 void
 WENO_P1( const std::vector< int >& esuel,
          inciter::ncomp_t offset,
+         const std::vector< std::size_t >& shockmarker,
          tk::Fields& U )
 // *****************************************************************************
 //  Weighted Essentially Non-Oscillatory (WENO) limiter for DGP1
 //! \param[in] esuel Elements surrounding elements
 //! \param[in] offset Index for equation systems
+//! \param[in] shockmarker Nonzero for elements to limit, see MarkShockCells()
 //! \param[in,out] U High-order solution vector which gets limited
 //! \details This WENO function should be called for transport and compflow
 //! \note This limiter function is experimental and untested. Use with caution.
@@ -53,13 +59,15 @@ WENO_P1( const std::vector< int >& esuel,
   {
     for (std::size_t e=0; e<nelem; ++e)
     {
-      WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
+      if (shockmarker[e])
+        WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
     }
 
     auto mark = c*rdof;
 
     for (std::size_t e=0; e<nelem; ++e)
     {
+      if (!shockmarker[e]) continue;
       U(e, mark+1, offset) = limU[0][e];
       U(e, mark+2, offset) = limU[1][e];
       U(e, mark+3, offset) = limU[2][e];
@@ -70,6 +78,7 @@ WENO_P1( const std::vector< int >& esuel,
 void
 WENOMultiMat_P1( const std::vector< int >& esuel,
                  inciter::ncomp_t offset,
+                 const std::vector< std::size_t >& shockmarker,
                  tk::Fields& U,
                  tk::Fields& P,
                  std::size_t nmat )
@@ -77,6 +86,7 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
 //  Weighted Essentially Non-Oscillatory (WENO) limiter for multi-material DGP1
 //! \param[in] esuel Elements surrounding elements
 //! \param[in] offset Index for equation systems
+//! \param[in] shockmarker Nonzero for elements to limit, see MarkShockCells()
 //! \param[in,out] U High-order solution vector which gets limited
 //! \param[in,out] P High-order vector of primitives which gets limited
 //! \param[in] nmat Number of materials in this PDE system
@@ -100,13 +110,15 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
   {
     for (std::size_t e=0; e<nelem; ++e)
     {
-      WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
+      if (shockmarker[e])
+        WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
     }
 
     auto mark = c*rdof;
 
     for (std::size_t e=0; e<nelem; ++e)
     {
+      if (!shockmarker[e]) continue;
       U(e, mark+1, offset) = limU[0][e];
       U(e, mark+2, offset) = limU[1][e];
       U(e, mark+3, offset) = limU[2][e];
@@ -118,13 +130,15 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
   {
     for (std::size_t e=0; e<nelem; ++e)
     {
-      WENOFunction(P, esuel, e, c, rdof, offset, cweight, limU);
+      if (shockmarker[e])
+        WENOFunction(P, esuel, e, c, rdof, offset, cweight, limU);
     }
 
     auto mark = c*rdof;
 
     for (std::size_t e=0; e<nelem; ++e)
     {
+      if (!shockmarker[e]) continue;
       P(e, mark+1, offset) = limU[0][e];
       P(e, mark+2, offset) = limU[1][e];
       P(e, mark+3, offset) = limU[2][e];
@@ -134,7 +148,8 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
   std::vector< tk::real > phic(ncomp, 1.0), phip(nprim, 1.0);
   for (std::size_t e=0; e<nelem; ++e)
   {
-    consistentMultiMatLimiting_P1(nmat, offset, rdof, e, U, P, phic, phip);
+    if (shockmarker[e])
+      consistentMultiMatLimiting_P1(nmat, offset, rdof, e, U, P, phic, phip);
   }
 }
 
@@ -142,6 +157,7 @@ void
 Superbee_P1( const std::vector< int >& esuel,
              const std::vector< std::size_t >& inpoel,
              const std::vector< std::size_t >& ndofel,
+             const std::vector< std::size_t >& shockmarker,
              inciter::ncomp_t offset,
              const tk::UnsMesh::Coords& coord,
              tk::Fields& U )
@@ -150,6 +166,7 @@ Superbee_P1( const std::vector< int >& esuel,
 //! \param[in] esuel Elements surrounding elements
 //! \param[in] inpoel Element connectivity
 //! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] shockmarker Nonzero for elements to limit, see MarkShockCells()
 //! \param[in] offset Index for equation systems
 //! \param[in] coord Array of nodal coordinates
 //! \param[in,out] U High-order solution vector which gets limited
@@ -179,7 +196,7 @@ Superbee_P1( const std::vector< int >& esuel,
       dof_el = ndofel[e];
     }
 
-    if (dof_el > 1)
+    if (dof_el > 1 && shockmarker[e])
     {
       auto phi = SuperbeeFunction(U, esuel, inpoel, coord, e, ndof, rdof,
                    dof_el, offset, ncomp, beta_lim);
@@ -201,6 +218,7 @@ SuperbeeMultiMat_P1(
   const std::vector< int >& esuel,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
+  const std::vector< std::size_t >& shockmarker,
   inciter::ncomp_t offset,
   const tk::UnsMesh::Coords& coord,
   tk::Fields& U,
@@ -211,6 +229,7 @@ SuperbeeMultiMat_P1(
 //! \param[in] esuel Elements surrounding elements
 //! \param[in] inpoel Element connectivity
 //! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] shockmarker Nonzero for elements to limit, see MarkShockCells()
 //! \param[in] offset Index for equation systems
 //! \param[in] coord Array of nodal coordinates
 //! \param[in,out] U High-order solution vector which gets limited
@@ -243,7 +262,7 @@ SuperbeeMultiMat_P1(
       dof_el = ndofel[e];
     }
 
-    if (dof_el > 1)
+    if (dof_el > 1 && shockmarker[e])
     {
       // limit conserved quantities
       auto phic = SuperbeeFunction(U, esuel, inpoel, coord, e, ndof, rdof,
@@ -275,9 +294,11 @@ SuperbeeMultiMat_P1(
 
 void
 VertexBasedMultiMat_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+                   std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
+  const std::vector< std::size_t >& shockmarker,
   std::size_t nelem,
   std::size_t offset,
   const tk::UnsMesh::Coords& coord,
@@ -286,9 +307,10 @@ VertexBasedMultiMat_P1(
   std::size_t nmat )
 // *****************************************************************************
 //  Kuzmin's vertex-based limiter for multi-material DGP1
-//! \param[in] esup Elements surrounding points
+//! \param[in] esup Elements surrounding points, including ghost elements
 //! \param[in] inpoel Element connectivity
 //! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] shockmarker Nonzero for elements to limit, see MarkShockCells()
 //! \param[in] nelem Number of elements
 //! \param[in] offset Index for equation systems
 //! \param[in] coord Array of nodal coordinates
@@ -306,6 +328,13 @@ VertexBasedMultiMat_P1(
   std::size_t ncomp = U.nprop()/rdof;
   std::size_t nprim = P.nprop()/rdof;
 
+  // Find min/max bounds at all points. Limiting only modifies the high-order
+  // dofs, so the bounds, computed from the cell averages, remain valid while
+  // the elements are limited.
+  std::vector< tk::real > uMin, uMax, pMin, pMax;
+  VertexBasedMinMax( U, esup, rdof, offset, ncomp, uMin, uMax );
+  VertexBasedMinMax( P, esup, rdof, offset, nprim, pMin, pMax );
+
   for (std::size_t e=0; e<nelem; ++e)
   {
     // If an rDG method is set up (P0P1), then, currently we compute the P1
@@ -323,14 +352,14 @@ VertexBasedMultiMat_P1(
       dof_el = ndofel[e];
     }
 
-    if (dof_el > 1)
+    if (dof_el > 1 && shockmarker[e])
     {
       // limit conserved quantities
-      auto phic = VertexBasedFunction(U, esup, inpoel, coord, e, rdof, dof_el,
-        offset, ncomp);
+      auto phic = VertexBasedFunction(U, uMin, uMax, inpoel, coord, e, rdof,
+        dof_el, offset, ncomp);
       // limit primitive quantities
-      auto phip = VertexBasedFunction(P, esup, inpoel, coord, e, rdof, dof_el,
-        offset, nprim);
+      auto phip = VertexBasedFunction(P, pMin, pMax, inpoel, coord, e, rdof,
+        dof_el, offset, nprim);
 
       consistentMultiMatLimiting_P1(nmat, offset, rdof, e, U, P, phic, phip);
 
@@ -623,9 +652,59 @@ SuperbeeFunction( const tk::Fields& U,
   return phi;
 }
 
+void
+VertexBasedMinMax( const tk::Fields& U,
+  const std::pair< std::vector< std::size_t >,
+                   std::vector< std::size_t > >& esup,
+  std::size_t rdof,
+  std::size_t offset,
+  std::size_t ncomp,
+  std::vector< tk::real >& uMin,
+  std::vector< tk::real >& uMax )
+// *****************************************************************************
+//  \brief Find the min/max bounds of the cell averages in the elements
+//    surrounding each point for the vertex-based limiter
+//! \param[in] U High-order solution vector which is to be limited
+//! \param[in] esup Elements surrounding points, including ghost elements
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] offset Index for equation systems
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[in,out] uMin Minimum of the cell averages surrounding each point,
+//!   indexed by point*ncomp + component
+//! \param[in,out] uMax Maximum of the cell averages surrounding each point,
+//!   indexed by point*ncomp + component
+//! \details The bounds of a point are shared by all elements sharing the
+//!   point, so they are computed once per point instead of once per element
+//!   vertex, in a single pass over the elements surrounding points.
+// *****************************************************************************
+{
+  const auto npoin = esup.second.size() - 1;
+
+  uMin.resize( npoin*ncomp );
+  uMax.resize( npoin*ncomp );
+
+  for (std::size_t p=0; p<npoin; ++p)
+  {
+    auto mn = uMin.data() + p*ncomp;
+    auto mx = uMax.data() + p*ncomp;
+    std::fill( mn, mn+ncomp, std::numeric_limits< tk::real >::max() );
+    std::fill( mx, mx+ncomp, std::numeric_limits< tk::real >::lowest() );
+    for (auto er : tk::Around(esup,p))
+    {
+      for (std::size_t c=0; c<ncomp; ++c)
+      {
+        auto mark = c*rdof;
+        mn[c] = std::min(mn[c], U(er, mark, offset));
+        mx[c] = std::max(mx[c], U(er, mark, offset));
+      }
+    }
+  }
+}
+
 std::vector< tk::real >
 VertexBasedFunction( const tk::Fields& U,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< tk::real >& uMin,
+  const std::vector< tk::real >& uMax,
   const std::vector< std::size_t >& inpoel,
   const tk::UnsMesh::Coords& coord,
   std::size_t e,
@@ -636,7 +715,10 @@ VertexBasedFunction( const tk::Fields& U,
 // *****************************************************************************
 //  Kuzmin's vertex-based limiter function calculation for P1 dofs
 //! \param[in] U High-order solution vector which is to be limited
-//! \param[in] esup Elements surrounding points
+//! \param[in] uMin Minimum of the cell averages surrounding each point, see
+//!   VertexBasedMinMax()
+//! \param[in] uMax Maximum of the cell averages surrounding each point, see
+//!   VertexBasedMinMax()
 //! \param[in] inpoel Element connectivity
 //! \param[in] coord Array of nodal coordinates
 //! \param[in] e Id of element whose solution is to be limited
@@ -670,33 +752,17 @@ VertexBasedFunction( const tk::Fields& U,
   auto detT =
     tk::Jacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
 
-  std::vector< tk::real > uMin(ncomp, 0.0), uMax(ncomp, 0.0), phi(ncomp, 1.0);
+  std::vector< tk::real > phi(ncomp, 1.0);
 
   // loop over all nodes of the element e
   for (std::size_t lp=0; lp<4; ++lp)
   {
-    // reset min/max
-    for (std::size_t c=0; c<ncomp; ++c)
-    {
-      auto mark = c*rdof;
-      uMin[c] = U(e, mark, offset);
-      uMax[c] = U(e, mark, offset);
-    }
-
     auto p = inpoel[4*e+lp];
-    const auto& pesup = tk::cref_find(esup, p);
 
-    // ----- Step-1: find min/max in the neighborhood of node p
-    // loop over all the elements surrounding this node p
-    for (auto er : pesup)
-    {
-      for (std::size_t c=0; c<ncomp; ++c)
-      {
-        auto mark = c*rdof;
-        uMin[c] = std::min(uMin[c], U(er, mark, offset));
-        uMax[c] = std::max(uMax[c], U(er, mark, offset));
-      }
-    }
+    // ----- Step-1: min/max in the neighborhood of node p, which includes e,
+    // found before by VertexBasedMinMax()
+    const auto pMin = uMin.data() + p*ncomp;
+    const auto pMax = uMax.data() + p*ncomp;
 
     // ----- Step-2: compute the limiter function at this node
 
@@ -721,12 +787,12 @@ VertexBasedFunction( const tk::Fields& U,
       if (uNeg > 1.0e-14)
       {
         uNeg = std::max(uNeg, 1.0e-08);
-        phi_gp = std::min( 1.0, (uMax[c]-U(e, mark, offset))/uNeg );
+        phi_gp = std::min( 1.0, (pMax[c]-U(e, mark, offset))/uNeg );
       }
       else if (uNeg < -1.0e-14)
       {
         uNeg = std::min(uNeg, -1.0e-08);
-        phi_gp = std::min( 1.0, (uMin[c]-U(e, mark, offset))/uNeg );
+        phi_gp = std::min( 1.0, (pMin[c]-U(e, mark, offset))/uNeg );
       }
       else
       {
@@ -17,6 +17,7 @@
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "UnsMesh.hpp"
+#include "FaceData.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
 
 namespace inciter {
@@ -27,12 +28,14 @@ using ncomp_t = kw::ncomp::info::expect::type;
 void
 WENO_P1( const std::vector< int >& esuel,
          inciter::ncomp_t offset,
+         const std::vector< std::size_t >& shockmarker,
          tk::Fields& U );
 
 //! Weighted Essentially Non-Oscillatory (WENO) limiter for multi-material DGP1
 void
 WENOMultiMat_P1( const std::vector< int >& esuel,
                  inciter::ncomp_t offset,
+                 const std::vector< std::size_t >& shockmarker,
                  tk::Fields& U,
                  tk::Fields& P,
                  std::size_t nmat );
@@ -42,6 +45,7 @@ void
 Superbee_P1( const std::vector< int >& esuel,
              const std::vector< std::size_t >& inpoel,
              const std::vector< std::size_t >& ndofel,
+             const std::vector< std::size_t >& shockmarker,
              inciter::ncomp_t offset,
              const tk::UnsMesh::Coords& coord,
              tk::Fields& U );
@@ -52,6 +56,7 @@ SuperbeeMultiMat_P1(
   const std::vector< int >& esuel,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
+  const std::vector< std::size_t >& shockmarker,
   inciter::ncomp_t offset,
   const tk::UnsMesh::Coords& coord,
   tk::Fields& U,
@@ -61,9 +66,11 @@ SuperbeeMultiMat_P1(
 //! Kuzmin's vertex-based limiter for multi-material DGP1
 void
 VertexBasedMultiMat_P1(
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+                   std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
+  const std::vector< std::size_t >& shockmarker,
   std::size_t nelem,
   std::size_t offset,
   const tk::UnsMesh::Coords& coord,
@@ -96,10 +103,23 @@ SuperbeeFunction( const tk::Fields& U,
                   inciter:: ncomp_t ncomp,
                   tk::real beta_lim );
 
+//! \brief Find the min/max bounds of the cell averages in the elements
+//!   surrounding each point for the vertex-based limiter
+void
+VertexBasedMinMax( const tk::Fields& U,
+  const std::pair< std::vector< std::size_t >,
+                   std::vector< std::size_t > >& esup,
+  std::size_t rdof,
+  std::size_t offset,
+  std::size_t ncomp,
+  std::vector< tk::real >& uMin,
+  std::vector< tk::real >& uMax );
+
 //! Kuzmin's vertex-based limiter function calculation for P1 dofs
 std::vector< tk::real >
 VertexBasedFunction( const tk::Fields& U,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< tk::real >& uMin,
+  const std::vector< tk::real >& uMax,
   const std::vector< std::size_t >& inpoel,
   const tk::UnsMesh::Coords& coord,
   std::size_t e,
@@ -342,19 +342,18 @@ class MultiMat {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
-//    //! \param[in] esup Elements-surrounding-nodes connectivity
-    //! \param[in] inpoel Element-node connectivity
-    //! \param[in] coord Array of nodal coordinates
+    //! \param[in] lsop Least-squares reconstruction operators of all elements
     //! \param[in,out] U Solution vector at recent time step
     //! \param[in,out] P Vector of primitives at recent time step
     void reconstruct( tk::real t,
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
-                      const std::map< std::size_t, std::vector< std::size_t > >&
-                        /*esup*/,
-                      const std::vector< std::size_t >& inpoel,
-                      const tk::UnsMesh::Coords& coord,
+                      const std::pair< std::vector< std::size_t >,
+                                       std::vector< std::size_t > >&,
+                      const std::vector< std::size_t >&,
+                      const tk::UnsMesh::Coords&,
+                      const std::vector< tk::real >& lsop,
                       tk::Fields& U,
                       tk::Fields& P ) const
     {
@@ -366,39 +365,20 @@ class MultiMat {
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
-      // allocate and initialize matrix and vector for reconstruction:
-      // lhs_ls is the left-hand side matrix for solving the least-squares
-      // system using the normal equation approach, for each mesh element.
-      // It is indexed as follows:
-      // The first index is the element id;
-      // the second index is the row id of the 3-by-3 matrix;
-      // the third index is the column id of the 3-by-3 matrix.
-      std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-        lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}} }} );
+      // allocate and initialize vectors for reconstruction:
       // rhs_ls is the right-hand side vector for solving the least-squares
-      // system using the normal equation approach, for each element.
-      // It is indexed as follows:
-      // The first index is the element id;
-      // the second index is the scalar equation which is being reconstructed;
-      // the third index is the row id of the rhs vector.
+      // system using the normal equation approach, for each element. The
+      // left-hand side matrix, which is only geometry dependent, is part of
+      // the precomputed operators, lsop. rhs_ls is indexed as follows:
+      // (element id * number of scalar equations reconstructed + scalar
+      // equation id) * 3 + row id of the rhs vector.
       // two rhs_ls vectors are needed for reconstructing conserved and
       // primitive quantites separately
-      std::vector< std::vector< std::array< tk::real, 3 > > >
-        rhsu_ls( nelem, std::vector< std::array< tk::real, 3 > >
-          ( m_ncomp,
-            {{ 0.0, 0.0, 0.0 }} ) );
-      std::vector< std::vector< std::array< tk::real, 3 > > >
-        rhsp_ls( nelem, std::vector< std::array< tk::real, 3 > >
-          ( nprim(),
-            {{ 0.0, 0.0, 0.0 }} ) );
+      std::vector< tk::real > rhsu_ls( nelem*m_ncomp*3, 0.0 );
+      std::vector< tk::real > rhsp_ls( nelem*nprim()*3, 0.0 );
 
       // reconstruct x,y,z-derivatives of unknowns. For multimat, conserved and
       // primitive quantities are reconstructed separately.
-      // 0. get lhs matrix, which is only geometry dependent
-      tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
-
       // 1. internal face contributions
       tk::intLeastSq_P0P1( m_ncomp, m_offset, rdof, fd, geoElem, U, rhsu_ls );
       tk::intLeastSq_P0P1( nprim(), m_offset, rdof, fd, geoElem, P, rhsp_ls );
@@ -412,19 +392,16 @@ class MultiMat {
           b.first, fd, geoFace, geoElem, t, b.second, P, U, rhsp_ls, m_ncomp );
       }
 
-      // 3. solve 3x3 least-squares system
-      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhs_ls, rhsu_ls, U );
-      tk::solveLeastSq_P0P1( nprim(), m_offset, rdof, lhs_ls, rhsp_ls, P );
+      // 3. solve 3x3 least-squares system and transform reconstructed
+      // derivatives to Dubiner dofs
+      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lsop, rhsu_ls, U );
+      tk::solveLeastSq_P0P1( nprim(), m_offset, rdof, lsop, rhsp_ls, P );
 
       //// 1. Reconstruct second-order dofs in Taylor space using nodal-stencils
       //tk::recoLeastSqExtStencil( rdof, m_offset, nelem, esup, inpoel, geoElem,
       //  U );
       //tk::recoLeastSqExtStencil( rdof, m_offset, nelem, esup, inpoel, geoElem,
       //  P );
-
-      // 4. transform reconstructed derivatives to Dubiner dofs
-      tk::transform_P0P1( m_ncomp, m_offset, rdof, nelem, inpoel, coord, U );
-      tk::transform_P0P1( nprim(), m_offset, rdof, nelem, inpoel, coord, P );
     }
 
     //! Limit second-order solution, and primitive quantities separately
@@ -436,16 +413,19 @@ class MultiMat {
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] ndofel Vector of local number of degrees of freedome
+    //! \param[in] shockmarker Nonzero for elements to limit
     //! \param[in,out] U Solution vector at recent time step
     //! \param[in,out] P Vector of primitives at recent time step
     void limit( [[maybe_unused]] tk::real t,
                 [[maybe_unused]] const tk::Fields& geoFace,
                 [[maybe_unused]] const tk::Fields& geoElem,
                 const inciter::FaceData& fd,
-                const std::map< std::size_t, std::vector< std::size_t > >& esup,
+                const std::pair< std::vector< std::size_t >,
+                                 std::vector< std::size_t > >& esup,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& shockmarker,
                 tk::Fields& U,
                 tk::Fields& P ) const
     {
@@ -459,17 +439,17 @@ class MultiMat {
       // limit vectors of conserved and primitive quantities
       if (limiter == ctr::LimiterType::SUPERBEEP1)
       {
-        SuperbeeMultiMat_P1( fd.Esuel(), inpoel, ndofel, m_offset, coord, U, P,
-          nmat );
+        SuperbeeMultiMat_P1( fd.Esuel(), inpoel, ndofel, shockmarker, m_offset,
+          coord, U, P, nmat );
       }
       else if (limiter == ctr::LimiterType::VERTEXBASEDP1)
       {
-        VertexBasedMultiMat_P1( esup, inpoel, ndofel, fd.Esuel().size()/4,
-          m_offset, coord, U, P, nmat );
+        VertexBasedMultiMat_P1( esup, inpoel, ndofel, shockmarker,
+          fd.Esuel().size()/4, m_offset, coord, U, P, nmat );
       }
       else if (limiter == ctr::LimiterType::WENOP1)
       {
-        WENOMultiMat_P1( fd.Esuel(), m_offset, U, P, nmat );
+        WENOMultiMat_P1( fd.Esuel(), m_offset, shockmarker, U, P, nmat );
       }
     }
 
@@ -808,6 +788,22 @@ class MultiMat {
     std::vector< std::string > names() const
     { return Problem::names( m_ncomp ); }
 
+    //! Return components used to detect shocks, see MarkShockCells()
+    //! \return Indices of the material partial densities and total energies
+    //!   among all components
+    //! \details Momentum is not used, as it may vanish in smooth regions where
+    //!   its normalized jump is not defined.
+    std::vector< ncomp_t > shockVars() const {
+      const auto nmat =
+        g_inputdeck.get< tag::param, tag::multimat, tag::nmat >()[m_system];
+      std::vector< ncomp_t > v;
+      for (std::size_t k=0; k<nmat; ++k) {
+        v.push_back( m_offset + densityIdx(nmat,k) );
+        v.push_back( m_offset + energyIdx(nmat,k) );
+      }
+      return v;
+    }
+
     //! Return analytic solution (if defined by Problem) at xi, yi, zi, t
     //! \param[in] xi X-coordinate at which to evaluate the analytic solution
     //! \param[in] yi Y-coordinate at which to evaluate the analytic solution
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "Vector.hpp"
+#include "Around.hpp"
 #include "Base/HashMapReducer.hpp"
 #include "Reconstruction.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
@@ -101,6 +102,75 @@ tk::lhsLeastSq_P0P1( const inciter::FaceData& fd,
   }
 }
 
+void
+tk::recoLeastSqOperator_P0P1( const inciter::FaceData& fd,
+  const Fields& geoElem,
+  const Fields& geoFace,
+  const std::vector< std::size_t >& inpoel,
+  const UnsMesh::Coords& coord,
+  std::vector< real >& lsop )
+// *****************************************************************************
+//  Compute the least-squares reconstruction operators of all elements
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] geoElem Element geometry array
+//! \param[in] geoFace Face geometry array
+//! \param[in] inpoel Element-node connectivity
+//! \param[in] coord Array of nodal coordinates
+//! \param[in,out] lsop Least-squares reconstruction operators, 3x3 row-major
+//!   for each element
+//! \details The operator of an element is the inverse of the transform from
+//!   the Dubiner dofs to the derivatives of the P1 solution times the inverse
+//!   of the lhs matrix of the least-squares normal equations, see
+//!   lhsLeastSq_P0P1(). Both only depend on the mesh, so the operators are
+//!   computed once for a mesh, and the reconstruction is reduced to computing
+//!   the rhs vectors and multiplying them with the operators, see
+//!   solveLeastSq_P0P1().
+// *****************************************************************************
+{
+  const auto nelem = fd.Esuel().size()/4;
+  const auto& cx = coord[0];
+  const auto& cy = coord[1];
+  const auto& cz = coord[2];
+
+  std::vector< std::array< std::array< real, 3 >, 3 > >
+    lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
+                      {{0.0, 0.0, 0.0}},
+                      {{0.0, 0.0, 0.0}} }} );
+  lhsLeastSq_P0P1( fd, geoElem, geoFace, lhs_ls );
+
+  lsop.resize( 9*nelem );
+
+  for (std::size_t e=0; e<nelem; ++e)
+  {
+    // Extract the element coordinates
+    std::array< std::array< real, 3>, 4 > coordel {{
+      {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
+      {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
+      {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
+      {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }}
+    }};
+
+    auto jacInv =
+      tk::inverseJacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
+
+    // Compute the derivatives of basis function for DG(P1)
+    auto dBdx = tk::eval_dBdx_p1( 4, jacInv );
+    std::array< std::array< real, 3 >, 3 >
+      dB{{ {{dBdx[0][1], dBdx[0][2], dBdx[0][3]}},
+           {{dBdx[1][1], dBdx[1][2], dBdx[1][3]}},
+           {{dBdx[2][1], dBdx[2][2], dBdx[2][3]}} }};
+
+    // Compute the operator column by column
+    for (std::size_t j=0; j<3; ++j)
+    {
+      std::array< real, 3 > ej{{ 0.0, 0.0, 0.0 }};
+      ej[j] = 1.0;
+      auto col = tk::cramer( dB, tk::cramer( lhs_ls[e], ej ) );
+      for (std::size_t i=0; i<3; ++i) lsop[ 9*e + 3*i + j ] = col[i];
+    }
+  }
+}
+
 void
 tk::intLeastSq_P0P1( ncomp_t ncomp,
                      ncomp_t offset,
@@ -108,7 +178,7 @@ tk::intLeastSq_P0P1( ncomp_t ncomp,
                      const inciter::FaceData& fd,
                      const Fields& geoElem,
                      const Fields& W,
-                     std::vector< std::vector< std::array< real, 3 > > >& rhs_ls )
+                     std::vector< real >& rhs_ls )
 // *****************************************************************************
 //  \brief Compute internal surface contributions to rhs vector of the
 //    least-squares reconstruction
@@ -118,7 +188,8 @@ tk::intLeastSq_P0P1( ncomp_t ncomp,
 //! \param[in] fd Face connectivity and boundary conditions object
 //! \param[in] geoElem Element geometry array
 //! \param[in] W Solution vector to be reconstructed at recent time step
-//! \param[in,out] rhs_ls RHS reconstruction vector
+//! \param[in,out] rhs_ls RHS reconstruction vector, indexed by
+//!   (element*ncomp + component)*3 + direction
 //! \details This function computing the internal face contributions to the rhs
 //!   vector for reconstruction, is common for primitive and conserved
 //!   quantities. If `W` == `U`, compute internal face contributions for the
@@ -153,10 +224,10 @@ tk::intLeastSq_P0P1( ncomp_t ncomp,
       for (ncomp_t c=0; c<ncomp; ++c)
       {
         auto mark = c*rdof;
-        rhs_ls[el][c][idir] +=
+        rhs_ls[ (el*ncomp+c)*3+idir ] +=
           wdeltax[idir] * (W(er,mark,offset)-W(el,mark,offset));
         if (er < nelem)
-          rhs_ls[er][c][idir] +=
+          rhs_ls[ (er*ncomp+c)*3+idir ] +=
             wdeltax[idir] * (W(er,mark,offset)-W(el,mark,offset));
       }
     }
@@ -176,7 +247,7 @@ tk::bndLeastSqConservedVar_P0P1( ncomp_t system,
   const StateFn& state,
   const Fields& P,
   const Fields& U,
-  std::vector< std::vector< std::array< real, 3 > > >& rhs_ls,
+  std::vector< real >& rhs_ls,
   std::size_t nprim )
 // *****************************************************************************
 //  \brief Compute boundary surface contributions to rhs vector of the
@@ -194,7 +265,7 @@ tk::bndLeastSqConservedVar_P0P1( ncomp_t system,
 //!   boundaries
 //! \param[in] P Primitive vector to be reconstructed at recent time step
 //! \param[in] U Solution vector to be reconstructed at recent time step
-//! \param[in,out] rhs_ls RHS reconstruction vector
+//! \param[in,out] rhs_ls RHS reconstruction vector, see intLeastSq_P0P1()
 //! \param[in] nprim This is the number of primitive quantities stored for this
 //!   PDE system. This is necessary to extend the state vector to the right
 //!   size, so that correct boundary conditions are obtained.
@@ -247,7 +318,7 @@ tk::bndLeastSqConservedVar_P0P1( ncomp_t system,
         {
           // rhs vector
           for (ncomp_t c=0; c<ncomp; ++c)
-            rhs_ls[el][c][idir] +=
+            rhs_ls[ (el*ncomp+c)*3+idir ] +=
               wdeltax[idir] * (ustate[1][c]-ustate[0][c]);
         }
       }
@@ -268,7 +339,7 @@ tk::bndLeastSqPrimitiveVar_P0P1( ncomp_t system,
   const StateFn& state,
   const Fields& P,
   const Fields& U,
-  std::vector< std::vector< std::array< real, 3 > > >& rhs_ls,
+  std::vector< real >& rhs_ls,
   std::size_t ncomp )
 // *****************************************************************************
 //  \brief Compute boundary surface contributions to rhs vector of the
@@ -286,7 +357,7 @@ tk::bndLeastSqPrimitiveVar_P0P1( ncomp_t system,
 //!   boundaries
 //! \param[in] P Primitive vector to be reconstructed at recent time step
 //! \param[in] U Conserved vector at recent time step
-//! \param[in,out] rhs_ls RHS reconstruction vector
+//! \param[in,out] rhs_ls RHS reconstruction vector, see intLeastSq_P0P1()
 //! \param[in] ncomp This is the number of conserved quantities stored for this
 //!   system. This is necessary to extend the state vector to the right size,
 //!   so that correct boundary conditions are obtained.
@@ -343,7 +414,7 @@ tk::bndLeastSqPrimitiveVar_P0P1( ncomp_t system,
           for (ncomp_t c=0; c<nprim; ++c)
           {
             auto cp = ustate[0].size()-nprim+c;
-            rhs_ls[el][c][idir] +=
+            rhs_ls[ (el*nprim+c)*3+idir ] +=
               wdeltax[idir] * (ustate[1][cp]-ustate[0][cp]);
           }
         }
@@ -356,37 +427,40 @@ void
 tk::solveLeastSq_P0P1( ncomp_t ncomp,
   ncomp_t offset,
   const std::size_t rdof,
-  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhs,
-  const std::vector< std::vector< std::array< real, 3 > > >& rhs,
+  const std::vector< real >& lsop,
+  const std::vector< real >& rhs,
   Fields& W )
 // *****************************************************************************
-//  Solve the 3x3 linear system for least-squares reconstruction
+//  \brief Apply the least-squares reconstruction operators yielding the Dubiner
+//    dofs of the P1 solution
 //! \param[in] ncomp Number of scalar components in this PDE system
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] rdof Maximum number of reconstructed degrees of freedom
-//! \param[in] lhs LHS reconstruction matrix
-//! \param[in] rhs RHS reconstruction vector
+//! \param[in] lsop Least-squares reconstruction operators of all elements, see
+//!   recoLeastSqOperator_P0P1()
+//! \param[in] rhs RHS reconstruction vector, see intLeastSq_P0P1()
 //! \param[in,out] W Solution vector to be reconstructed at recent time step
-//! \details Solves the 3x3 linear system for each element, individually. For
-//!   systems that require reconstructions of primitive quantities, this should
-//!   be called twice, once with the argument 'W' as U (conserved), and again
-//!   with 'W' as P (primitive).
+//! \details Multiplies the rhs vector of each component with the 3x3 operator
+//!   of each element. For systems that require reconstructions of primitive
+//!   quantities, this should be called twice, once with the argument 'W' as U
+//!   (conserved), and again with 'W' as P (primitive).
 // *****************************************************************************
 {
-  auto nelem = lhs.size();
+  auto nelem = lsop.size()/9;
+
+  Assert( rhs.size() == nelem*ncomp*3, "Size mismatch in least-squares rhs" );
 
   for (std::size_t e=0; e<nelem; ++e)
   {
+    const auto m = lsop.data() + 9*e;
     for (ncomp_t c=0; c<ncomp; ++c)
     {
       auto mark = c*rdof;
+      const auto r = rhs.data() + (e*ncomp+c)*3;
 
-      // solve system using Cramer's rule
-      auto ux = tk::cramer( lhs[e], rhs[e][c] );
-
-      W(e,mark+1,offset) = ux[0];
-      W(e,mark+2,offset) = ux[1];
-      W(e,mark+3,offset) = ux[2];
+      W(e,mark+1,offset) = m[0]*r[0] + m[1]*r[1] + m[2]*r[2];
+      W(e,mark+2,offset) = m[3]*r[0] + m[4]*r[1] + m[5]*r[2];
+      W(e,mark+3,offset) = m[6]*r[0] + m[7]*r[1] + m[8]*r[2];
     }
   }
 }
@@ -395,7 +469,8 @@ void
 tk::recoLeastSqExtStencil( std::size_t rdof,
   std::size_t offset,
   std::size_t nielem,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+                   std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const Fields& geoElem,
   Fields& W )
@@ -434,10 +509,9 @@ tk::recoLeastSqExtStencil( std::size_t rdof,
     for (std::size_t lp=0; lp<4; ++lp)
     {
       auto p = inpoel[4*e+lp];
-      const auto& pesup = cref_find(esup, p);
 
       // loop over all the elements surrounding this node p
-      for (auto er : pesup)
+      for (auto er : tk::Around(esup,p))
       {
         // centroid distance
         std::array< real, 3 > wdeltax{{ geoElem(er,1,0)-geoElem(e,1,0),
@@ -477,69 +551,6 @@ tk::recoLeastSqExtStencil( std::size_t rdof,
   }
 }
 
-void
-tk::transform_P0P1( ncomp_t ncomp,
-                    ncomp_t offset,
-                    std::size_t rdof,
-                    std::size_t nelem,
-                    const std::vector< std::size_t >& inpoel,
-                    const UnsMesh::Coords& coord,
-                    Fields& W )
-// *****************************************************************************
-//  Transform the reconstructed P1-derivatives to the Dubiner dofs
-//! \param[in] ncomp Number of scalar components in this PDE system
-//! \param[in] offset Index for equation systems
-//! \param[in] rdof Total number of reconstructed dofs
-//! \param[in] nelem Total number of elements
-//! \param[in] inpoel Element-node connectivity
-//! \param[in] coord Array of nodal coordinates
-//! \param[in,out] W Second-order reconstructed vector which gets transformed to
-//!   the Dubiner reference space
-//! \details Since the DG solution (and the primitive quantities) are assumed to
-//!   be stored in the Dubiner space, this transformation from Taylor
-//!   coefficients to Dubiner coefficients is necessary.
-// *****************************************************************************
-{
-  const auto& cx = coord[0];
-  const auto& cy = coord[1];
-  const auto& cz = coord[2];
-
-  for (std::size_t e=0; e<nelem; ++e)
-  {
-    // Extract the element coordinates
-    std::array< std::array< real, 3>, 4 > coordel {{
-      {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-      {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-      {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-      {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }}
-    }};
-
-    auto jacInv =
-      tk::inverseJacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
-
-    // Compute the derivatives of basis function for DG(P1)
-    auto dBdx = tk::eval_dBdx_p1( rdof, jacInv );
-
-    for (ncomp_t c=0; c<ncomp; ++c)
-    {
-      auto mark = c*rdof;
-
-      // solve system using Cramer's rule
-      auto ux = tk::cramer( {{ {{dBdx[0][1], dBdx[0][2], dBdx[0][3]}},
-                               {{dBdx[1][1], dBdx[1][2], dBdx[1][3]}},
-                               {{dBdx[2][1], dBdx[2][2], dBdx[2][3]}} }},
-                            {{ W(e,mark+1,offset),
-                               W(e,mark+2,offset),
-                               W(e,mark+3,offset) }} );
-
-      // replace physical derivatives with transformed dofs
-      W(e,mark+1,offset) = ux[0];
-      W(e,mark+2,offset) = ux[1];
-      W(e,mark+3,offset) = ux[2];
-    }
-  }
-}
-
 void
 tk::safeReco( std::size_t offset,
   std::size_t rdof,
@@ -35,6 +35,15 @@ lhsLeastSq_P0P1( const inciter::FaceData& fd,
   const Fields& geoFace,
   std::vector< std::array< std::array< real, 3 >, 3 > >& lhs_ls );
 
+//! Compute the least-squares reconstruction operators of all elements
+void
+recoLeastSqOperator_P0P1( const inciter::FaceData& fd,
+  const Fields& geoElem,
+  const Fields& geoFace,
+  const std::vector< std::size_t >& inpoel,
+  const UnsMesh::Coords& coord,
+  std::vector< real >& lsop );
+
 //! Compute internal surface contributions to the least-squares reconstruction
 void
 intLeastSq_P0P1( ncomp_t ncomp,
@@ -43,7 +52,7 @@ intLeastSq_P0P1( ncomp_t ncomp,
                  const inciter::FaceData& fd,
                  const Fields& geoElem,
                  const Fields& W,
-                 std::vector< std::vector< std::array< real, 3 > > >& rhs_ls );
+                 std::vector< real >& rhs_ls );
 
 //! \brief Compute boundary surface contributions to rhs vector of the
 //!   least-squares reconstruction of conserved quantities of the PDE system
@@ -60,7 +69,7 @@ bndLeastSqConservedVar_P0P1( ncomp_t system,
   const StateFn& state,
   const Fields& P,
   const Fields& U,
-  std::vector< std::vector< std::array< real, 3 > > >& rhs_ls,
+  std::vector< real >& rhs_ls,
   std::size_t nprim=0 );
 
 //! \brief Compute boundary surface contributions to rhs vector of the
@@ -78,17 +87,18 @@ bndLeastSqPrimitiveVar_P0P1( ncomp_t system,
   const StateFn& state,
   const Fields& P,
   const Fields& U,
-  std::vector< std::vector< std::array< real, 3 > > >& rhs_ls,
+  std::vector< real >& rhs_ls,
   std::size_t ncomp );
 
-//! Solve 3x3 system for least-squares reconstruction
+//! \brief Apply the least-squares reconstruction operators yielding the
+//!   Dubiner dofs of the P1 solution
 void
 solveLeastSq_P0P1(
   ncomp_t ncomp,
   ncomp_t offset,
   const std::size_t rdof,
-  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhs,
-  const std::vector< std::vector< std::array< real, 3 > > >& rhs,
+  const std::vector< real >& lsop,
+  const std::vector< real >& rhs,
   Fields& W );
 
 //! \brief Reconstruct the second-order solution using least-squares approach
@@ -97,21 +107,12 @@ void
 recoLeastSqExtStencil( std::size_t rdof,
   std::size_t offset,
   std::size_t nelem,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::pair< std::vector< std::size_t >,
+                   std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const Fields& geoElem,
   Fields& W );
 
-//! Transform the reconstructed P1-derivatives to the Dubiner dofs
-void
-transform_P0P1( ncomp_t ncomp,
-                ncomp_t offset,
-                std::size_t rdof,
-                std::size_t nelem,
-                const std::vector< std::size_t >& inpoel,
-                const UnsMesh::Coords& coord,
-                Fields& W );
-
 //! Compute safe reconstructions near material interfaces
 void
 safeReco( std::size_t offset,
@@ -0,0 +1,167 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/ShockIndicator.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Troubled-cell indicator for discontinuous Galerkin methods
+  \details   This file contains the troubled-cell (shock) indicator that
+    selects the elements whose solution is limited by the DG limiters. It does
+    not depend on the input deck, so that it can be unit tested.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+#include "Vector.hpp"
+#include "ShockIndicator.hpp"
+#include "Integrate/Basis.hpp"
+
+namespace inciter {
+
+void
+MarkShockCells( std::size_t nelem,
+                std::size_t ndof,
+                std::size_t rdof,
+                tk::real coeff,
+                const std::vector< std::size_t >& vars,
+                const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& inpoel,
+                const tk::UnsMesh::Coords& coord,
+                const inciter::FaceData& fd,
+                const tk::Fields& geoElem,
+                const tk::Fields& U,
+                std::vector< std::size_t >& shockmarker )
+// *****************************************************************************
+//  Mark the elements that need limiting using a troubled-cell indicator
+//! \param[in] nelem Number of elements, not counting chare-boundary ghosts
+//! \param[in] ndof Maximum number of degrees of freedom
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] coeff Threshold of the indicator, zero disables the indicator
+//! \param[in] vars Components of U whose jumps are tested, see
+//!   DGPDE::shockVars()
+//! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] inpoel Element connectivity
+//! \param[in] coord Array of nodal coordinates
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] geoElem Element geometry array
+//! \param[in] U High-order solution vector, including ghost elements
+//! \param[in,out] shockmarker Nonzero for elements to be limited, size nelem
+//! \details The indicator is evaluated on internal faces (including those
+//!   shared with ghost elements) as the jump of the high-order solution of the
+//!   components in vars at the face centroid, normalized by the larger
+//!   magnitude of the cell averages on the two sides and by h^((p+1)/2),
+//!   where h is the cube root of the element volume and p is the polynomial
+//!   order. In smooth regions the jump scales with h^(p+1), so the indicator
+//!   vanishes with mesh refinement, while it grows at discontinuities, similar
+//!   to the indicator of Krivodonova et al., Applied Numerical Mathematics,
+//!   48(3-4), 323-338, 2004. Since the jump is normalized by the magnitude of
+//!   the solution, only components bounded away from zero, e.g., density and
+//!   energy, are to be tested. Both elements of a face whose indicator exceeds
+//!   the threshold are marked, as well as their face-neighbors.
+// *****************************************************************************
+{
+  shockmarker.assign( nelem, 0 );
+
+  // indicator disabled: limit all elements
+  if (coeff < std::numeric_limits< tk::real >::epsilon()) {
+    std::fill( begin(shockmarker), end(shockmarker), 1 );
+    return;
+  }
+
+  const auto& esuel = fd.Esuel();
+  const auto& esuf = fd.Esuf();
+  const auto& inpofa = fd.Inpofa();
+
+  const auto& cx = coord[0];
+  const auto& cy = coord[1];
+  const auto& cz = coord[2];
+
+  auto ncomp = U.nprop()/rdof;
+
+  // evaluate solution of element e at point x
+  auto state = [&]( std::size_t e, const std::array< tk::real, 3 >& x,
+                    std::size_t dof )
+  {
+    std::array< std::array< tk::real, 3>, 4 > coordel {{
+      {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
+      {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
+      {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
+      {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }} }};
+    auto detT =
+      tk::Jacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
+    auto B = tk::eval_basis( dof,
+      tk::Jacobian( coordel[0], x, coordel[2], coordel[3] ) / detT,
+      tk::Jacobian( coordel[0], coordel[1], x, coordel[3] ) / detT,
+      tk::Jacobian( coordel[0], coordel[1], coordel[2], x ) / detT );
+    return tk::eval_state( ncomp, 0, rdof, dof, e, U, B );
+  };
+
+  // elements with a large jump on any of their faces, including ghosts
+  std::vector< char > troubled( U.nunk(), 0 );
+
+  for (auto f=fd.Nbfac(); f<esuf.size()/2; ++f)
+  {
+    Assert( esuf[2*f] > -1 && esuf[2*f+1] > -1, "Interior element detected "
+            "as -1" );
+
+    std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+    std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+
+    // see the same workaround for P0P1 in the limiters above
+    auto dof_el = rdof > ndof ? rdof : ndofel[el];
+    auto dof_er = rdof > ndof ? rdof : ndofel[er];
+
+    // nothing to limit if both sides are first order
+    if (dof_el == 1 && dof_er == 1) continue;
+
+    std::array< tk::real, 3 > fc{{
+      (cx[inpofa[3*f]] + cx[inpofa[3*f+1]] + cx[inpofa[3*f+2]]) / 3.0,
+      (cy[inpofa[3*f]] + cy[inpofa[3*f+1]] + cy[inpofa[3*f+2]]) / 3.0,
+      (cz[inpofa[3*f]] + cz[inpofa[3*f+1]] + cz[inpofa[3*f+2]]) / 3.0 }};
+
+    auto ul = state( el, fc, dof_el );
+    auto ur = state( er, fc, dof_er );
+
+    auto p = std::max( dof_el, dof_er ) > 4 ? 2.0 : 1.0;
+    auto h = std::cbrt( std::min( geoElem(el,0,0), geoElem(er,0,0) ) );
+    auto hp = coeff * std::pow( h, (p+1.0)/2.0 );
+
+    for (auto c : vars)
+    {
+      auto mark = c*rdof;
+      auto norm =
+        std::max( std::abs( U(el,mark,0) ), std::abs( U(er,mark,0) ) );
+      if (std::abs( ul[c] - ur[c] ) > hp * norm)
+      {
+        troubled[el] = troubled[er] = 1;
+        break;
+      }
+    }
+  }
+
+  // mark troubled elements and their face-neighbors
+  for (std::size_t e=0; e<nelem; ++e)
+  {
+    if (troubled[e]) {
+      shockmarker[e] = 1;
+      continue;
+    }
+    for (std::size_t i=0; i<4; ++i)
+    {
+      auto n = esuel[4*e+i];
+      if (n > -1 && troubled[ static_cast< std::size_t >( n ) ])
+      {
+        shockmarker[e] = 1;
+        break;
+      }
+    }
+  }
+}
+
+} // inciter::
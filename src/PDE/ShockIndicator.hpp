@@ -0,0 +1,43 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/ShockIndicator.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Troubled-cell indicator for discontinuous Galerkin methods
+  \details   This file contains the troubled-cell (shock) indicator that
+    selects the elements whose solution is limited by the DG limiters. It does
+    not depend on the input deck, so that it can be unit tested.
+*/
+// *****************************************************************************
+#ifndef ShockIndicator_h
+#define ShockIndicator_h
+
+#include <vector>
+
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "UnsMesh.hpp"
+#include "FaceData.hpp"
+
+namespace inciter {
+
+//! Mark the elements that need limiting using a troubled-cell indicator
+void
+MarkShockCells( std::size_t nelem,
+                std::size_t ndof,
+                std::size_t rdof,
+                tk::real coeff,
+                const std::vector< std::size_t >& vars,
+                const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& inpoel,
+                const tk::UnsMesh::Coords& coord,
+                const inciter::FaceData& fd,
+                const tk::Fields& geoElem,
+                const tk::Fields& U,
+                std::vector< std::size_t >& shockmarker );
+
+} // inciter::
+
+#endif // ShockIndicator_h
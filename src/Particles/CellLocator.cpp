@@ -0,0 +1,263 @@
+// *****************************************************************************
+/*!
+  \file      src/Particles/CellLocator.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Locate points in cells of a tetrahedron mesh chunk
+  \details   Locate points in cells of a tetrahedron mesh chunk, see
+    CellLocator.hpp.
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <algorithm>
+
+#include "CellLocator.hpp"
+#include "Exception.hpp"
+
+using tk::CellLocator;
+
+bool
+CellLocator::locate( const std::array< std::vector< tk::real >, 3 >& coord,
+                     const std::vector< std::size_t >& inpoel,
+                     const std::array< tk::real, 3 >& p,
+                     std::size_t& e,
+                     std::array< tk::real, 4 >& N,
+                     int& face )
+// *****************************************************************************
+//  Find mesh cell of a point walking from a cell it was last seen in
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] p Point coordinates
+//! \param[in,out] e Mesh cell to start the walk from on input, cell in which
+//!   the point was found on output
+//! \param[in,out] N Shapefunctions evaluated at the point in cell e
+//! \param[out] face Face, 4*cell+local face id, across which the walk has
+//!   left our chunk of the mesh, -1 if the walk did not reach the boundary
+//! \return True if the point has been found in our chunk of the mesh
+//! \details Starting from cell e, we walk across the face opposite the node
+//!   with the most negative shapefunction (barycentric coordinate) until a cell
+//!   containing the point is found. Since particles move little during a time
+//!   step, this usually takes only a few steps. If the walk hits the boundary
+//!   of our mesh chunk (which may be non-convex) or does not terminate within
+//!   a few steps, we resort to the bin-grid search, see search().
+// *****************************************************************************
+{
+  Assert( m_esuel.size() == inpoel.size(), "Elements surrounding elements "
+          "size mismatch" );
+
+  // Maximum number of steps in the walk before resorting to the bin search
+  const std::size_t maxstep = 64;
+
+  face = -1;
+  auto f = e;
+  for (std::size_t s=0; s<maxstep; ++s) {
+    if (shapefn( coord, inpoel, p, f, N )) { e = f; return true; }
+    // find node with the most negative shapefunction, the point lies beyond
+    // the face opposite that node, see tk::lpofa
+    std::size_t k = 0;
+    for (std::size_t i=1; i<4; ++i) if (N[i] < N[k]) k = i;
+    auto n = m_esuel[ f*4+k ];
+    if (n < 0) {          // walked into the boundary of our chunk
+      face = static_cast< int >( f*4+k );
+      break;
+    }
+    f = static_cast< std::size_t >( n );
+  }
+
+  return search( coord, inpoel, p, e, N );
+}
+
+bool
+CellLocator::search( const std::array< std::vector< tk::real >, 3 >& coord,
+                     const std::vector< std::size_t >& inpoel,
+                     const std::array< tk::real, 3 >& p,
+                     std::size_t& e,
+                     std::array< tk::real, 4 >& N )
+// *****************************************************************************
+//  Find mesh cell of a point using a bin grid
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] p Point coordinates
+//! \param[in,out] e Mesh cell in which the point was found
+//! \param[in,out] N Shapefunctions evaluated at the point in cell e
+//! \return True if the point has been found in our chunk of the mesh
+//! \details Only the cells whose bounding box overlaps the bin containing the
+//!   point are tested. The bin grid is generated at the first search.
+// *****************************************************************************
+{
+  if (m_binel.second.empty()) bins( coord, inpoel );
+
+  // find bin of point, return if outside of the bounding box of our chunk
+  std::size_t b = 0;
+  for (std::size_t j=0; j<3; ++j) {
+    auto r = (p[j] - m_binlo[j]) / m_binsz[j];
+    if (r < 0.0 || r > static_cast< tk::real >( m_nbin[j] )) return false;
+    auto i = std::min( static_cast< std::size_t >( r ), m_nbin[j]-1 );
+    b = b*m_nbin[j] + i;
+  }
+
+  // test cells in bin
+  for (auto i=m_binel.second[b]; i<m_binel.second[b+1]; ++i)
+    if (shapefn( coord, inpoel, p, m_binel.first[i], N )) {
+      e = m_binel.first[i];
+      return true;
+    }
+
+  return false;
+}
+
+void
+CellLocator::bins( const std::array< std::vector< tk::real >, 3 >& coord,
+                   const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Generate bin grid of mesh cells for searching points
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \details A uniform grid of about as many bins as cells is laid over the
+//!   bounding box of our mesh chunk and each cell is registered in all bins
+//!   its bounding box overlaps. The cells of bin b are stored in
+//!   m_binel.first[ m_binel.second[b] ... m_binel.second[b+1]-1 ].
+// *****************************************************************************
+{
+  auto nelem = inpoel.size()/4;
+
+  // Lambda to compute bounding box of a cell
+  auto bbox = [&]( std::size_t e, std::size_t j ) {
+    auto lo = coord[j][ inpoel[e*4] ], hi = lo;
+    for (std::size_t a=1; a<4; ++a) {
+      auto c = coord[j][ inpoel[e*4+a] ];
+      lo = std::min( lo, c );
+      hi = std::max( hi, c );
+    }
+    return std::make_pair( lo, hi );
+  };
+
+  // bounding box of our chunk and bin sizes
+  auto n = std::max( std::size_t(1), static_cast< std::size_t >(
+             std::cbrt( static_cast< tk::real >( nelem ) ) ) );
+  for (std::size_t j=0; j<3; ++j) {
+    auto mm = std::minmax_element( begin(coord[j]), end(coord[j]) );
+    m_binlo[j] = *mm.first;
+    m_nbin[j] = n;
+    m_binsz[j] = (*mm.second - *mm.first) / static_cast< tk::real >( n );
+    if (!(m_binsz[j] > 0.0)) m_binsz[j] = 1.0;
+  }
+
+  // Lambda to compute range of bins a cell overlaps in a direction
+  auto range = [&]( std::size_t e, std::size_t j ) {
+    auto b = bbox( e, j );
+    auto i = [&]( tk::real x ) {
+      auto r = std::max( 0.0, (x - m_binlo[j]) / m_binsz[j] );
+      return std::min( static_cast< std::size_t >( r ), m_nbin[j]-1 );
+    };
+    return std::make_pair( i(b.first), i(b.second) );
+  };
+
+  // Lambda to call a function for all bins a cell overlaps
+  auto overlap = [&]( std::size_t e, auto&& fn ) {
+    auto x = range( e, 0 ), y = range( e, 1 ), z = range( e, 2 );
+    for (auto i=x.first; i<=x.second; ++i)
+      for (auto j=y.first; j<=y.second; ++j)
+        for (auto k=z.first; k<=z.second; ++k)
+          fn( (i*m_nbin[1] + j)*m_nbin[2] + k );
+  };
+
+  // count cells in bins, then store them
+  auto& cells = m_binel.first;
+  auto& start = m_binel.second;
+  start.assign( m_nbin[0]*m_nbin[1]*m_nbin[2] + 1, 0 );
+  for (std::size_t e=0; e<nelem; ++e)
+    overlap( e, [&]( std::size_t b ){ ++start[b+1]; } );
+  for (std::size_t b=1; b<start.size(); ++b) start[b] += start[b-1];
+  cells.resize( start.back() );
+  auto pos = start;
+  for (std::size_t e=0; e<nelem; ++e)
+    overlap( e, [&]( std::size_t b ){ cells[ pos[b]++ ] = e; } );
+}
+
+bool
+CellLocator::shapefn( const std::array< std::vector< tk::real >, 3 >& coord,
+                      const std::vector< std::size_t >& inpoel,
+                      const std::array< tk::real, 3 >& p,
+                      std::size_t e,
+                      std::array< tk::real, 4 >& N ) const
+// *****************************************************************************
+//  Evaluate shapefunctions of a mesh cell at a point
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] p Point coordinates
+//! \param[in] e Mesh cell index
+//! \param[in,out] N Shapefunctions evaluated at the point
+//! \return True if point is in mesh cell
+// *****************************************************************************
+{
+  // Tetrahedron node indices
+  const auto A = inpoel[e*4+0];
+  const auto B = inpoel[e*4+1];
+  const auto C = inpoel[e*4+2];
+  const auto D = inpoel[e*4+3];
+
+  // Tetrahedron node coordinates
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  // Point coordinates
+  const auto xp = p[0];
+  const auto yp = p[1];
+  const auto zp = p[2];
+
+  // Evaluate linear shapefunctions at particle locations using Cramer's Rule
+  //    | xp |   | x1 x2 x3 x4 |   | N1 |
+  //    | yp | = | y1 y2 y3 y4 | • | N2 |
+  //    | zp |   | z1 z2 z3 z4 |   | N3 |
+  //    | 1  |   | 1  1  1  1  |   | N4 |
+
+  tk::real DetX = (y[B]*z[C] - y[C]*z[B] - y[B]*z[D] + y[D]*z[B] +
+    y[C]*z[D] - y[D]*z[C])*x[A] + x[B]*y[C]*z[A] - x[B]*y[A]*z[C] +
+    x[C]*y[A]*z[B] - x[C]*y[B]*z[A] + x[B]*y[A]*z[D] - x[B]*y[D]*z[A] -
+    x[D]*y[A]*z[B] + x[D]*y[B]*z[A] - x[C]*y[A]*z[D] + x[C]*y[D]*z[A] +
+    x[D]*y[A]*z[C] - x[D]*y[C]*z[A] - x[B]*y[C]*z[D] + x[B]*y[D]*z[C] +
+    x[C]*y[B]*z[D] - x[C]*y[D]*z[B] - x[D]*y[B]*z[C] + x[D]*y[C]*z[B];
+
+  tk::real DetX1 = (y[D]*z[C] - y[C]*z[D] + y[C]*zp - yp*z[C] -
+    y[D]*zp + yp*z[D])*x[B] + x[C]*y[B]*z[D] - x[C]*y[D]*z[B] -
+    x[D]*y[B]*z[C] + x[D]*y[C]*z[B] - x[C]*y[B]*zp + x[C]*yp*z[B] +
+    xp*y[B]*z[C] - xp*y[C]*z[B] + x[D]*y[B]*zp - x[D]*yp*z[B] -
+    xp*y[B]*z[D] + xp*y[D]*z[B] + x[C]*y[D]*zp - x[C]*yp*z[D] -
+    x[D]*y[C]*zp + x[D]*yp*z[C] + xp*y[C]*z[D] - xp*y[D]*z[C];
+
+  tk::real DetX2 = (y[C]*z[D] - y[D]*z[C] - y[C]*zp + yp*z[C] +
+    y[D]*zp - yp*z[D])*x[A] + x[C]*y[D]*z[A] - x[C]*y[A]*z[D] +
+    x[D]*y[A]*z[C] - x[D]*y[C]*z[A] + x[C]*y[A]*zp - x[C]*yp*z[A] -
+    xp*y[A]*z[C] + xp*y[C]*z[A] - x[D]*y[A]*zp + x[D]*yp*z[A] +
+    xp*y[A]*z[D] - xp*y[D]*z[A] - x[C]*y[D]*zp + x[C]*yp*z[D] +
+    x[D]*y[C]*zp - x[D]*yp*z[C] - xp*y[C]*z[D] + xp*y[D]*z[C];
+
+  tk::real DetX3 = (y[D]*z[B] - y[B]*z[D] + y[B]*zp - yp*z[B] -
+    y[D]*zp + yp*z[D])*x[A] + x[B]*y[A]*z[D] - x[B]*y[D]*z[A] -
+    x[D]*y[A]*z[B] + x[D]*y[B]*z[A] - x[B]*y[A]*zp + x[B]*yp*z[A] +
+    xp*y[A]*z[B] - xp*y[B]*z[A] + x[D]*y[A]*zp - x[D]*yp*z[A] -
+    xp*y[A]*z[D] + xp*y[D]*z[A] + x[B]*y[D]*zp - x[B]*yp*z[D] -
+    x[D]*y[B]*zp + x[D]*yp*z[B] + xp*y[B]*z[D] - xp*y[D]*z[B];
+
+  tk::real DetX4 = (y[B]*z[C] - y[C]*z[B] - y[B]*zp + yp*z[B] +
+    y[C]*zp - yp*z[C])*x[A] + x[B]*y[C]*z[A] - x[B]*y[A]*z[C] +
+    x[C]*y[A]*z[B] - x[C]*y[B]*z[A] + x[B]*y[A]*zp - x[B]*yp*z[A] -
+    xp*y[A]*z[B] + xp*y[B]*z[A] - x[C]*y[A]*zp + x[C]*yp*z[A] +
+    xp*y[A]*z[C] - xp*y[C]*z[A] - x[B]*y[C]*zp + x[B]*yp*z[C] +
+    x[C]*y[B]*zp - x[C]*yp*z[B] - xp*y[B]*z[C] + xp*y[C]*z[B];
+
+  // Shape functions evaluated at particle location
+  N[0] = DetX1/DetX;
+  N[1] = DetX2/DetX;
+  N[2] = DetX3/DetX;
+  N[3] = DetX4/DetX;
+
+  // if min( N^i, 1-N^i ) > 0 for all i, point is in cell
+  return std::min(N[0],1.0-N[0]) > 0 && std::min(N[1],1.0-N[1]) > 0 &&
+         std::min(N[2],1.0-N[2]) > 0 && std::min(N[3],1.0-N[3]) > 0;
+}
@@ -0,0 +1,110 @@
+// *****************************************************************************
+/*!
+  \file      src/Particles/CellLocator.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Locate points in cells of a tetrahedron mesh chunk
+  \details   Locate points in cells of a tetrahedron mesh chunk. Used by
+    tk::Tracker to find the mesh cells Lagrangian particles reside in, either
+    by walking across cell faces from the cell a particle has last been found
+    in, or by searching the cells registered in a uniform bin grid laid over
+    the mesh chunk.
+*/
+// *****************************************************************************
+#ifndef CellLocator_h
+#define CellLocator_h
+
+#include <vector>
+#include <array>
+#include <utility>
+
+#include "NoWarning/pup.hpp"
+
+#include "Types.hpp"
+#include "DerivedData.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Locate points in cells of a tetrahedron mesh chunk
+class CellLocator {
+
+  public:
+    //! Constructor
+    //! \param[in] inpoel Mesh element connectivity
+    explicit CellLocator( const std::vector< std::size_t >& inpoel = {} ) :
+      m_esuel( inpoel.empty() ? std::vector< int >() :
+               tk::genEsuelTet( inpoel, tk::genEsup(inpoel,4) ) ),
+      m_binel(),
+      m_binlo(),
+      m_binsz(),
+      m_nbin()
+    {}
+
+    //! Find mesh cell of a point walking from a cell it was last seen in
+    bool locate( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel,
+                 const std::array< tk::real, 3 >& p,
+                 std::size_t& e,
+                 std::array< tk::real, 4 >& N,
+                 int& face );
+
+    //! Find mesh cell of a point using a bin grid
+    bool search( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel,
+                 const std::array< tk::real, 3 >& p,
+                 std::size_t& e,
+                 std::array< tk::real, 4 >& N );
+
+    //! Generate bin grid of mesh cells for searching points
+    void bins( const std::array< std::vector< tk::real >, 3 >& coord,
+               const std::vector< std::size_t >& inpoel );
+
+    //! Number of bins in all three directions accessor
+    //! \return Number of bins in all three directions, zero if the bin grid
+    //!   has not yet been generated
+    const std::array< std::size_t, 3 >& nbin() const { return m_nbin; }
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note The bin grid is not migrated, it is regenerated at the first
+    //!   search after migration.
+    void pup( PUP::er& p ) {
+      p | m_esuel;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] l CellLocator object reference
+    friend void operator|( PUP::er& p, CellLocator& l ) { l.pup(p); }
+    //@}
+
+  private:
+    //! Elements surrounding elements of mesh chunk we operate on, see
+    //!   tk::genEsuelTet()
+    std::vector< int > m_esuel;
+    //! \brief Mesh cells overlapping bins of a uniform grid, generated at the
+    //!   first search, see bins()
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+      m_binel;
+    //! Lower corner of the bin grid
+    std::array< tk::real, 3 > m_binlo;
+    //! Bin sizes in all three directions
+    std::array< tk::real, 3 > m_binsz;
+    //! Number of bins in all three directions
+    std::array< std::size_t, 3 > m_nbin;
+
+    //! Evaluate shapefunctions of a mesh cell at a point
+    bool shapefn( const std::array< std::vector< tk::real >, 3 >& coord,
+                  const std::vector< std::size_t >& inpoel,
+                  const std::array< tk::real, 3 >& p,
+                  std::size_t e,
+                  std::array< tk::real, 4 >& N ) const;
+};
+
+} // tk::
+
+#endif // CellLocator_h
@@ -0,0 +1,207 @@
+// *****************************************************************************
+/*!
+  \file      src/Particles/ParticleStore.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Structure-of-arrays particle store with deferred deletion
+  \details   Structure-of-arrays particle store with deferred deletion. Used by
+    tk::Tracker to store the coordinates of Lagrangian particles together with
+    the mesh cells they reside in. Each component is stored in its own array.
+    Particles are appended at the end, while erased particles are only marked
+    (tombstoned), so that particle indices stay valid while particles are
+    communicated among chares. Tombstones are removed by compact(), which also
+    reorders the particles by their mesh cell for locality.
+*/
+// *****************************************************************************
+#ifndef ParticleStore_h
+#define ParticleStore_h
+
+#include <vector>
+#include <algorithm>
+
+#include "NoWarning/pup.hpp"
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Structure-of-arrays particle store with deferred deletion
+class ParticleStore {
+
+  public:
+    //! Constructor
+    //! \param[in] ncomp Number of particle components
+    //! \param[in] npar Number of particles
+    explicit ParticleStore( std::size_t ncomp = 0, std::size_t npar = 0 ) :
+      m_x( ncomp, std::vector< tk::real >( npar, 0.0 ) ),
+      m_elp( npar, 0 ),
+      m_dead( npar, 0 ),
+      m_ndead( 0 ) {}
+
+    //! Number of particles stored, including those erased
+    //! \return Number of particle slots, live and erased
+    std::size_t size() const { return m_elp.size(); }
+
+    //! Number of live particles
+    //! \return Number of particles not erased
+    std::size_t nlive() const { return m_elp.size() - m_ndead; }
+
+    //! Number of particle components
+    //! \return Number of particle components
+    std::size_t ncomp() const { return m_x.size(); }
+
+    //! Read-only access to a particle component
+    //! \param[in] i Particle index
+    //! \param[in] c Component index
+    //! \return Const reference to the particle component
+    const tk::real& operator()( std::size_t i, std::size_t c ) const {
+      Assert( c < m_x.size(), "Out-of-bounds access: component index" );
+      Assert( i < m_elp.size(), "Out-of-bounds access: particle index" );
+      return m_x[c][i];
+    }
+
+    //! Read-write access to a particle component
+    //! \param[in] i Particle index
+    //! \param[in] c Component index
+    //! \return Non-const reference to the particle component
+    tk::real& operator()( std::size_t i, std::size_t c ) {
+      return const_cast< tk::real& >(
+        static_cast< const ParticleStore& >( *this ).operator()( i, c ) );
+    }
+
+    //! Extract (a copy of) all components of a particle
+    //! \param[in] i Particle index
+    //! \return Vector of all components of the particle
+    std::vector< tk::real > operator[]( std::size_t i ) const {
+      std::vector< tk::real > p( m_x.size() );
+      for (std::size_t c=0; c<m_x.size(); ++c) p[c] = operator()( i, c );
+      return p;
+    }
+
+    //! Read-write access to the mesh cell of a particle
+    //! \param[in] i Particle index
+    //! \return Non-const reference to the mesh cell index of the particle
+    std::size_t& elp( std::size_t i ) {
+      Assert( i < m_elp.size(), "Out-of-bounds access: particle index" );
+      return m_elp[i];
+    }
+
+    //! Query if a particle has been erased
+    //! \param[in] i Particle index
+    //! \return True if the particle has been erased
+    bool dead( std::size_t i ) const { return m_dead[i]; }
+
+    //! Extract (a copy of) a component of all live particles
+    //! \param[in] c Component index
+    //! \return Component of all live particles
+    std::vector< tk::real > extract( std::size_t c ) const {
+      Assert( c < m_x.size(), "Out-of-bounds access: component index" );
+      std::vector< tk::real > x;
+      x.reserve( nlive() );
+      for (std::size_t i=0; i<size(); ++i)
+        if (!m_dead[i]) x.push_back( m_x[c][i] );
+      return x;
+    }
+
+    //! Append a particle
+    //! \param[in] p All components of the particle
+    //! \param[in] e Mesh cell index the particle resides in
+    //! \details Storage grows by doubling its capacity, equally for all
+    //!   arrays, so appending particles one by one is amortized constant time.
+    void push_back( const std::vector< tk::real >& p, std::size_t e ) {
+      Assert( p.size() == m_x.size(), "Particle components size mismatch" );
+      if (m_elp.size() == m_elp.capacity()) {
+        auto cap = std::max< std::size_t >( 2*m_elp.capacity(), 64 );
+        for (auto& x : m_x) x.reserve( cap );
+        m_elp.reserve( cap );
+        m_dead.reserve( cap );
+      }
+      for (std::size_t c=0; c<m_x.size(); ++c) m_x[c].push_back( p[c] );
+      m_elp.push_back( e );
+      m_dead.push_back( 0 );
+    }
+
+    //! Erase a particle
+    //! \param[in] i Particle index
+    //! \details The particle is only marked as erased, its storage is reused
+    //!   by compact(). Indices of other particles remain unchanged.
+    void erase( std::size_t i ) {
+      Assert( i < m_elp.size(), "Out-of-bounds access: particle index" );
+      if (!m_dead[i]) {
+        m_dead[i] = 1;
+        ++m_ndead;
+      }
+    }
+
+    //! Query if it is worth calling compact()
+    //! \return True if a significant fraction of the particles are erased
+    bool fragmented() const { return m_ndead > 0 && m_ndead >= size()/8; }
+
+    //! Remove erased particles and sort the rest by their mesh cells
+    //! \details Counting sort on the mesh cell index, which is stable, so
+    //!   particles in the same cell keep their relative order. Changes the
+    //!   indices of the particles.
+    void compact() {
+      std::size_t nelem = 0;
+      for (std::size_t i=0; i<size(); ++i)
+        if (!m_dead[i]) nelem = std::max( nelem, m_elp[i]+1 );
+
+      // count live particles in cells and compute their new positions
+      std::vector< std::size_t > pos( nelem+1, 0 );
+      for (std::size_t i=0; i<size(); ++i) if (!m_dead[i]) ++pos[ m_elp[i]+1 ];
+      for (std::size_t e=1; e<pos.size(); ++e) pos[e] += pos[e-1];
+      std::vector< std::size_t > perm( size() );
+      for (std::size_t i=0; i<size(); ++i)
+        if (!m_dead[i]) perm[i] = pos[ m_elp[i] ]++;
+
+      // scatter components of live particles to their new positions
+      auto n = nlive();
+      std::vector< tk::real > y( n );
+      for (auto& x : m_x) {
+        for (std::size_t i=0; i<size(); ++i)
+          if (!m_dead[i]) y[ perm[i] ] = x[i];
+        x.swap( y );
+        y.resize( n );
+      }
+      std::vector< std::size_t > elp( n );
+      for (std::size_t i=0; i<size(); ++i)
+        if (!m_dead[i]) elp[ perm[i] ] = m_elp[i];
+      m_elp.swap( elp );
+      m_dead.assign( n, 0 );
+      m_ndead = 0;
+    }
+
+    /** @name Pack/Unpack: Serialize ParticleStore object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_x;
+      p | m_elp;
+      p | m_dead;
+      p | m_ndead;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] s ParticleStore object reference
+    friend void operator|( PUP::er& p, ParticleStore& s ) { s.pup(p); }
+    //@}
+
+  private:
+    //! Particle components, one array per component
+    std::vector< std::vector< tk::real > > m_x;
+    //! Mesh cell index in which a particle has last been found
+    std::vector< std::size_t > m_elp;
+    //! Flags marking erased particles
+    std::vector< char > m_dead;
+    //! Number of erased particles
+    std::size_t m_ndead;
+};
+
+} // tk::
+
+#endif // ParticleStore_h
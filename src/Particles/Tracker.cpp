@@ -12,6 +12,9 @@
 */
 // *****************************************************************************
 
+#include <cmath>
+#include <algorithm>
+
 #include "NoWarning/threefry.hpp"
 
 #include "Random123.hpp"
@@ -34,8 +37,7 @@ Tracker::genpar( const std::array< std::vector< tk::real >, 3 >& coord,
 //! \param[in] chid Host chare ID (thisIndex)
 // *****************************************************************************
 {
-  Assert( m_elp.size() >= m_particles.nunk(),
-          "Element-of-particle array not large enough" );
+  m_nchare = nchare;
 
   auto rng = tk::Random123< r123::Threefry2x64 >( nchare );
 
@@ -45,7 +47,7 @@ Tracker::genpar( const std::array< std::vector< tk::real >, 3 >& coord,
   const auto& z = coord[2];
 
   // Generate npar number of particles into each mesh cell
-  auto npar = m_particles.nunk() / (inpoel.size()/4);
+  auto npar = m_particles.size() / (inpoel.size()/4);
   for (std::size_t e=0; e<inpoel.size()/4; ++e) {
     for (std::size_t p=0; p<npar; ++p) {
       std::array< tk::real, 4 > N;
@@ -58,10 +60,10 @@ Tracker::genpar( const std::array< std::vector< tk::real >, 3 >& coord,
         const auto C = inpoel[e*4+2];
         const auto D = inpoel[e*4+3];
         const auto i = e * npar + p;
-        m_particles(i,0,0) = x[A]*N[0] + x[B]*N[1] + x[C]*N[2] + x[D]*N[3];
-        m_particles(i,1,0) = y[A]*N[0] + y[B]*N[1] + y[C]*N[2] + y[D]*N[3];
-        m_particles(i,2,0) = z[A]*N[0] + z[B]*N[1] + z[C]*N[2] + z[D]*N[3];
-        m_elp[i] = e;
+        m_particles(i,0) = x[A]*N[0] + x[B]*N[1] + x[C]*N[2] + x[D]*N[3];
+        m_particles(i,1) = y[A]*N[0] + y[B]*N[1] + y[C]*N[2] + y[D]*N[3];
+        m_particles(i,2) = z[A]*N[0] + z[B]*N[1] + z[C]*N[2] + z[D]*N[3];
+        m_particles.elp(i) = e;
       } else --p; // retry if particle was not generated into cell
     }
   }
@@ -79,6 +81,8 @@ Tracker::addpar( const std::array< std::vector< tk::real >, 3 >& coord,
 //! \param[in] miss Indices of particles to find
 //! \param[in] ps Particle data associated to those particle indices to find
 //! \return Particle indices found
+//! \details Received particles are located via the bin grid without touching
+//!   our particle array, and only those found are appended to it.
 // *****************************************************************************
 {
   Assert( ps.size() == miss.size(), "Size mismatch" );
@@ -86,113 +90,100 @@ Tracker::addpar( const std::array< std::vector< tk::real >, 3 >& coord,
   std::vector< std::size_t > found; // will store indices of particles found
 
   // try to find particles received
-  for (std::size_t i=0; i<ps.size(); ++i)
-    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-      std::array< tk::real, 4 > N;
-      auto last = m_particles.nunk();
-      m_particles.push_back( ps[i] );
-      if (parinel( coord, inpoel, last, e, N )) {
-        found.push_back( miss[i] );
-        m_elp.resize( last+1 );
-        m_elp[ last ] = e;
-        e = inpoel.size()/4;
-      } else {
-        m_particles.rm( { last } );
-      }
+  for (std::size_t i=0; i<ps.size(); ++i) {
+    std::array< tk::real, 4 > N;
+    std::size_t e = 0;
+    if (m_locator.search( coord, inpoel, {{ ps[i][0], ps[i][1], ps[i][2] }},
+                          e, N )) {
+      found.push_back( miss[i] );
+      m_particles.push_back( ps[i], e );
     }
+  }
 
   return found;
 }
 
-bool
-Tracker::parinel( const std::array< std::vector< tk::real >, 3 >& coord,
-                  const std::vector< std::size_t >& inpoel,
-                  std::size_t p,
-                  std::size_t e,
-                  std::array< tk::real, 4 >& N )
+int
+Tracker::facech( const std::vector< std::size_t >& inpoel,
+                 const std::vector< std::size_t >& gid,
+                 const std::unordered_map< std::size_t, std::vector< int > >&
+                   nodech,
+                 int face ) const
 // *****************************************************************************
-//  Search particle in a single mesh cell
-//! \param[in] coord Mesh node coordinates
+//  Find the fellow chare we share a face of our mesh chunk with
 //! \param[in] inpoel Mesh element connectivity
-//! \param[in] p Particle index
-//! \param[in] e Mesh cell index
-//! \param[in,out] N Shapefunctions evaluated at the particle position
-//! \return True if particle is in mesh cell
+//! \param[in] gid Global node IDs of mesh chunk
+//! \param[in] nodech Fellow chare IDs associated to global node IDs we share
+//! \param[in] face Face, 4*cell+local face id, see tk::lpofa, -1 if unknown
+//! \return Chare ID sharing all three nodes of the face, -1 if none
 // *****************************************************************************
 {
-  // Tetrahedron node indices
-  const auto A = inpoel[e*4+0];
-  const auto B = inpoel[e*4+1];
-  const auto C = inpoel[e*4+2];
-  const auto D = inpoel[e*4+3];
+  if (face < 0) return -1;
+
+  auto f = static_cast< std::size_t >( face );
+  auto e = f/4, k = f%4;
+
+  // chares sharing the first node of the face
+  auto n = nodech.find( gid[ inpoel[ e*4+lpofa[k][0] ] ] );
+  if (n == end(nodech)) return -1;
+
+  // return the first of those that also share the other two nodes
+  for (auto c : n->second) {
+    bool shared = true;
+    for (std::size_t j=1; j<3; ++j) {
+      auto m = nodech.find( gid[ inpoel[ e*4+lpofa[k][j] ] ] );
+      if (m == end(nodech) ||
+          std::find( begin(m->second), end(m->second), c ) == end(m->second))
+        shared = false;
+    }
+    if (shared) return c;
+  }
 
-  // Tetrahedron node coordinates
-  const auto& x = coord[0];
-  const auto& y = coord[1];
-  const auto& z = coord[2];
+  return -1;
+}
 
-  // Particle coordinates
-  const auto& xp = m_particles(p,0,0);
-  const auto& yp = m_particles(p,1,0);
-  const auto& zp = m_particles(p,2,0);
-
-  // Evaluate linear shapefunctions at particle locations using Cramer's Rule
-  //    | xp |   | x1 x2 x3 x4 |   | N1 |
-  //    | yp | = | y1 y2 y3 y4 | • | N2 |
-  //    | zp |   | z1 z2 z3 z4 |   | N3 |
-  //    | 1  |   | 1  1  1  1  |   | N4 |
-
-  tk::real DetX = (y[B]*z[C] - y[C]*z[B] - y[B]*z[D] + y[D]*z[B] +
-    y[C]*z[D] - y[D]*z[C])*x[A] + x[B]*y[C]*z[A] - x[B]*y[A]*z[C] +
-    x[C]*y[A]*z[B] - x[C]*y[B]*z[A] + x[B]*y[A]*z[D] - x[B]*y[D]*z[A] -
-    x[D]*y[A]*z[B] + x[D]*y[B]*z[A] - x[C]*y[A]*z[D] + x[C]*y[D]*z[A] +
-    x[D]*y[A]*z[C] - x[D]*y[C]*z[A] - x[B]*y[C]*z[D] + x[B]*y[D]*z[C] +
-    x[C]*y[B]*z[D] - x[C]*y[D]*z[B] - x[D]*y[B]*z[C] + x[D]*y[C]*z[B];
-
-  tk::real DetX1 = (y[D]*z[C] - y[C]*z[D] + y[C]*zp - yp*z[C] -
-    y[D]*zp + yp*z[D])*x[B] + x[C]*y[B]*z[D] - x[C]*y[D]*z[B] -
-    x[D]*y[B]*z[C] + x[D]*y[C]*z[B] - x[C]*y[B]*zp + x[C]*yp*z[B] +
-    xp*y[B]*z[C] - xp*y[C]*z[B] + x[D]*y[B]*zp - x[D]*yp*z[B] -
-    xp*y[B]*z[D] + xp*y[D]*z[B] + x[C]*y[D]*zp - x[C]*yp*z[D] -
-    x[D]*y[C]*zp + x[D]*yp*z[C] + xp*y[C]*z[D] - xp*y[D]*z[C];
-
-  tk::real DetX2 = (y[C]*z[D] - y[D]*z[C] - y[C]*zp + yp*z[C] +
-    y[D]*zp - yp*z[D])*x[A] + x[C]*y[D]*z[A] - x[C]*y[A]*z[D] +
-    x[D]*y[A]*z[C] - x[D]*y[C]*z[A] + x[C]*y[A]*zp - x[C]*yp*z[A] -
-    xp*y[A]*z[C] + xp*y[C]*z[A] - x[D]*y[A]*zp + x[D]*yp*z[A] +
-    xp*y[A]*z[D] - xp*y[D]*z[A] - x[C]*y[D]*zp + x[C]*yp*z[D] +
-    x[D]*y[C]*zp - x[D]*yp*z[C] - xp*y[C]*z[D] + xp*y[D]*z[C];
-
-  tk::real DetX3 = (y[D]*z[B] - y[B]*z[D] + y[B]*zp - yp*z[B] -
-    y[D]*zp + yp*z[D])*x[A] + x[B]*y[A]*z[D] - x[B]*y[D]*z[A] -
-    x[D]*y[A]*z[B] + x[D]*y[B]*z[A] - x[B]*y[A]*zp + x[B]*yp*z[A] +
-    xp*y[A]*z[B] - xp*y[B]*z[A] + x[D]*y[A]*zp - x[D]*yp*z[A] -
-    xp*y[A]*z[D] + xp*y[D]*z[A] + x[B]*y[D]*zp - x[B]*yp*z[D] -
-    x[D]*y[B]*zp + x[D]*yp*z[B] + xp*y[B]*z[D] - xp*y[D]*z[B];
-
-  tk::real DetX4 = (y[B]*z[C] - y[C]*z[B] - y[B]*zp + yp*z[B] +
-    y[C]*zp - yp*z[C])*x[A] + x[B]*y[C]*z[A] - x[B]*y[A]*z[C] +
-    x[C]*y[A]*z[B] - x[C]*y[B]*z[A] + x[B]*y[A]*zp - x[B]*yp*z[A] -
-    xp*y[A]*z[B] + xp*y[B]*z[A] - x[C]*y[A]*zp + x[C]*yp*z[A] +
-    xp*y[A]*z[C] - xp*y[C]*z[A] - x[B]*y[C]*zp + x[B]*yp*z[C] +
-    x[C]*y[B]*zp - x[C]*yp*z[B] - xp*y[B]*z[C] + xp*y[C]*z[B];
-
-  // Shape functions evaluated at particle location
-  N[0] = DetX1/DetX;
-  N[1] = DetX2/DetX;
-  N[2] = DetX3/DetX;
-  N[3] = DetX4/DetX;
-
-  // if min( N^i, 1-N^i ) > 0 for all i, particle is in cell
-  if ( std::min(N[0],1.0-N[0]) > 0 && std::min(N[1],1.0-N[1]) > 0 &&
-       std::min(N[2],1.0-N[2]) > 0 && std::min(N[3],1.0-N[3]) > 0 )
-  {
-    m_elp.resize( p+1 );
-    m_elp[ p ] = e; // store element of particle
-    return true;
-  } else {
-    return false;
+std::map< int, std::vector< std::size_t > >
+Tracker::lookup( int chid ) const
+// *****************************************************************************
+//  Find chares whose bounding box contains particles still missing
+//! \param[in] chid Charm++ array index (thisIndex of the holder class)
+//! \return Indices of particles still missing associated to the chare IDs
+//!   whose mesh chunk bounding box contains them
+// *****************************************************************************
+{
+  Assert( !m_dir.empty(), "Directory of mesh chunk bounding boxes not set up" );
+
+  std::map< int, std::vector< std::size_t > > dest;
+
+  for (auto i : m_parmiss) {
+    if (m_parelse.find(i) != end(m_parelse)) continue;  // found already
+    for (std::size_t b=0; b<m_dir.size()/7; ++b) {
+      auto c = static_cast< int >( m_dir[b*7] );
+      if (c == chid) continue;
+      bool in = true;
+      for (std::size_t j=0; j<3; ++j) {
+        auto x = m_particles(i,j);
+        if (x < m_dir[b*7+1+j*2] || x > m_dir[b*7+2+j*2]) in = false;
+      }
+      if (in) dest[c].push_back( i );
+    }
   }
+
+  return dest;
+}
+
+std::vector< std::vector< tk::real > >
+Tracker::extract( const std::vector< std::size_t >& idx ) const
+// *****************************************************************************
+//  Extract particle data to send to fellow chares
+//! \param[in] idx Particle indices whose data to extract
+//! \return Particle data associated to the particle indices
+// *****************************************************************************
+{
+  std::vector< std::vector< tk::real > > ps( idx.size() );
+  std::size_t j = 0;
+  for (auto i : idx) ps[ j++ ] = m_particles[i];
+  return ps;
 }
 
 void
@@ -201,9 +192,9 @@ Tracker::applyParBC( std::size_t i )
 // Apply boundary conditions to particles
 // *****************************************************************************
 {
-  auto& x = m_particles(i,0,0);
-  auto& y = m_particles(i,1,0);
-  auto& z = m_particles(i,2,0);
+  auto& x = m_particles(i,0);
+  auto& y = m_particles(i,1);
+  auto& z = m_particles(i,2);
 
   if (z > 1.0) z = 0.99;
   if (z < 0.0) z = 0.01;
@@ -218,23 +209,10 @@ Tracker::remove( const std::set< std::size_t >& idx )
 // *****************************************************************************
 // Remove particles
 //! \param[in] idx Set of particle indices whose data to remove
+//! \details Particles are only marked as erased here, so the indices of the
+//!   remaining particles do not change. The storage is compacted once a
+//!   tracking step has completed, see signal2host_parcomcomplete().
 // *****************************************************************************
 {
-  m_particles.rm( idx );
-
-  auto rem = [ &idx ]( std::size_t i ) -> bool {
-    if (idx.find(i) != end(idx)) return true;
-    return false;
-  };
-
-  std::size_t last = 0;
-  for(std::size_t i=0; i<m_elp.size(); ++i, ++last) {
-    while( rem(i) ) ++i;
-    if (i >= m_elp.size()) break;
-    m_elp[last] = m_elp[i];
-  }
-  m_elp.resize( last );
-
-  Assert( m_particles.nunk() == m_elp.size(),
-          "Number of particles and the number of host elements unequal" );
+  for (auto i : idx) m_particles.erase( i );
 }
@@ -17,13 +17,16 @@
 #include <vector>
 #include <array>
 #include <set>
+#include <map>
+#include <algorithm>
 #include <unordered_map>
 
 #include "NoWarning/pup.hpp"
 
 #include "Keywords.hpp"
-#include "Particles.hpp"
+#include "ParticleStore.hpp"
 #include "DerivedData.hpp"
+#include "CellLocator.hpp"
 #include "ParticleWriter.hpp"
 #include "ContainerUtil.hpp"
 #include "PUPUtil.hpp"
@@ -43,12 +46,14 @@ class Tracker {
     explicit Tracker( bool feedback = false,
                       std::size_t npar = 0,
                       const std::vector< std::size_t >& inpoel = {} ) :
-      m_particles( npar * inpoel.size()/4, 3 ), // only the 3 spatial components
-      m_elp( m_particles.nunk() ),
+      m_particles( 3, npar * inpoel.size()/4 ), // only the 3 spatial components
       m_parmiss(),
       m_parelse(),
       m_nchpar( 0 ),
-      m_esupel( tk::genEsupel( inpoel, 4, tk::genEsup(inpoel,4) ) ),
+      m_nexp( 0 ),
+      m_nchare( 0 ),
+      m_dir(),
+      m_locator( inpoel ),
       m_feedback( feedback )
     {}
 
@@ -69,7 +74,7 @@ class Tracker {
                          ChareArray* const array )
     {
       // Send number of partciles we will contribute to particle writer
-      pw.ckLocalBranch()->npar( m_particles.nunk() );
+      pw.ckLocalBranch()->npar( m_particles.nlive() );
       // Tell the host that we are done with sending our number of particles
       signal2host_nparcomplete( hostproxy, array );
     }
@@ -85,9 +90,9 @@ class Tracker {
     {
       pw.ckLocalBranch()->writeCoords( nchare,
                                        it,
-                                       m_particles.extract(0,0),
-                                       m_particles.extract(1,0),
-                                       m_particles.extract(2,0) );
+                                       m_particles.extract(0),
+                                       m_particles.extract(1),
+                                       m_particles.extract(2) );
     }
 
     //! Advance particle based on velocity from mesh cell
@@ -107,11 +112,11 @@ class Tracker {
       // Extract the transport velocity at nodes
       auto v = array->velocity( e );
       // Advance particle coordinates using the interpolated velocity
-      m_particles(i,0,0) +=
+      m_particles(i,0) +=
         dt*(Np[0]*v[0][0] + Np[1]*v[0][1] + Np[2]*v[0][2] + Np[3]*v[0][3]);
-      m_particles(i,1,0) +=
+      m_particles(i,1) +=
         dt*(Np[0]*v[1][0] + Np[1]*v[1][1] + Np[2]*v[1][2] + Np[3]*v[1][3]);
-      m_particles(i,2,0) +=
+      m_particles(i,2) +=
         dt*(Np[0]*v[2][0] + Np[1]*v[2][1] + Np[2]*v[2][2] + Np[3]*v[2][3]);
       // Apply boundary conditions to particle
       applyParBC( i );
@@ -123,72 +128,61 @@ class Tracker {
     //!   point-to-point communications (this is the proxy that holds us)
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
-    //! \param[in] msum Mesh chunks surrounding mesh chunks; we only use the
-    //!   keys of this container to address fellow Charm++ chare array elements
-    //!   via the arrayProxy
+    //! \param[in] gid Global node IDs of mesh chunk
+    //! \param[in] msum Global mesh node IDs shared with fellow chares
+    //!   associated to their chare IDs
     //! \param[in] chid Charm++ array index (thisIndex of the holder class)
     //! \param[in] array Charm++ array object pointer of the holder class
     //! \param[in] dt Time step size
+    //! \details Particles that have left our chunk of the mesh across a face
+    //!   shared with a fellow chare are sent only to that chare, batched per
+    //!   destination. Those not found that way are looked up in the directory
+    //!   of chunk bounding boxes, see directory(), or, if the holder has not
+    //!   set up the directory, broadcast to all chares.
     template< class HostProxy, class ChareArrayProxy, class ChareArray >
     void track( HostProxy& hostproxy,
                 const ChareArrayProxy& arrayProxy,
                 const std::array< std::vector< tk::real >, 3 >& coord,
                 const std::vector< std::size_t >& inpoel,
+                const std::vector< std::size_t >& gid,
                 const std::unordered_map< int, std::vector<std::size_t> >& msum,
                 int chid,
                 ChareArray* const array,
                 tk::real dt )
     {
-      // Lambda to attempt to find and advance particle i in element e. Returns
-      // true if the particle was found (and advanced), false if was not found.
-      std::array< tk::real, 4 > N;
-      auto adv = [ this, array, &N, &dt, &coord, &inpoel ]
-                ( std::size_t i, std::size_t e ) -> bool
-      {
-        if (this->parinel( coord, inpoel, i, e, N )) {
+      // Search cells of our mesh chunk for all particles, walking from the
+      // element where the particle has last been found. Particles not found
+      // have left our chunk of the mesh, mark them as missing and find the
+      // chare they went to based on the face they left our chunk across.
+      std::map< int, std::vector< std::size_t > > dest;
+      std::unordered_map< std::size_t, std::vector< int > > nodech;
+      for (const auto& [c,nodes] : msum)
+        for (auto g : nodes) nodech[g].push_back( c );
+      for (std::size_t i=0; i<m_particles.size(); ++i) {
+        if (m_particles.dead(i)) continue;
+        std::array< tk::real, 4 > N;
+        auto e = m_particles.elp(i);
+        int face = -1;
+        if (m_locator.locate( coord, inpoel, {{ m_particles(i,0),
+               m_particles(i,1), m_particles(i,2) }}, e, N, face ))
+        {
+          m_particles.elp(i) = e;
           advanceParticle( array, i, e, dt, N );
-          return true;
-        }
-        return false;
-      };
-      // Search cells of our mesh chunk for all particles
-      for (std::size_t i=0; i<m_particles.nunk(); ++i) {
-        // Get element ID where particle i has last been seen
-        bool found = adv( i, m_elp[i] );
-        // Next search in the elements surroundings the points of the element
-        // where the particle has last been found
-        if (!found) {
-          auto last = m_esupel.second[m_elp[i]+1];
-          for (auto j=m_esupel.second[m_elp[i]]+1; j<=last; ++j) {
-            found = adv( i, m_esupel.first[j] );
-            if (found) j = last+1;  // search for next particle
-          }
-        }
-        // Next search all cells in our chunk of the mesh
-        if (!found) {
-          for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-            found = adv( i, e );
-            if (found) e = inpoel.size()/4;  // search for next particle
-          }
-          // If the particle still has not been found, it left our chunk of the
-          // mesh, mark as missing (will initiate communication to find it)
-          if (!found) m_parmiss.insert( i );
+        } else {
+          m_parmiss.insert( i );
+          auto c = facech( inpoel, gid, nodech, face );
+          if (c >= 0) dest[c].push_back( i );
         }
       }
-      // If we have no missing particles, we are done, if we do, send out
-      // requests to find them to those ChareArray chares which we neighbor
-      // mesh cells with.
-      if (m_parmiss.empty()) {
-        signal2host_parcomcomplete( hostproxy, array );
-      } else {
-        std::vector< std::vector< tk::real > > pexp( m_parmiss.size() );
-        std::size_t j = 0;
-        for (auto i : m_parmiss) pexp[ j++ ] = m_particles[i];
-        m_nchpar = 0;
-        std::vector< std::size_t > miss( begin(m_parmiss), end(m_parmiss) );
-        for (const auto& n : msum)
-          arrayProxy[ n.first ].findpar( chid, miss, pexp );
-      }
+      // Send particles to those chares we share their exit faces with, if
+      // any, otherwise resort to the directory
+      m_nchpar = 0;
+      m_nexp = dest.size();
+      if (dest.empty())
+        farpar( hostproxy, arrayProxy, chid, array );
+      else
+        for (const auto& [c,miss] : dest)
+          arrayProxy[ c ].findpar( chid, miss, extract(miss) );
     }
 
     //! Find particles missing by the requestor and make those found ours
@@ -215,11 +209,8 @@ class Tracker {
 
     //! Receive particle indices found elsewhere (by fellow neighbors)
     //! \param[in] hostproxy Charm++ host proxy to which address reductions
-    //! \param[in] arrayProxy Charm++ array proxy to whose all elements te
-    //!   address our desparate broadcast (this is the proxy that holds us)
-    //! \param[in] msum Mesh chunks surrounding mesh chunks; we only use the
-    //!   keys of this container to address fellow Charm++ chare array elements
-    //!   via the arrayProxy
+    //! \param[in] arrayProxy Charm++ array proxy to which address
+    //!   point-to-point communications (this is the proxy that holds us)
     //! \param[in] array Charm++ array object pointer of the holder class
     //! \param[in] chid Charm++ array index (thisIndex of the holder class)
     //! \param[in] found Indices of particles found
@@ -227,35 +218,14 @@ class Tracker {
     void
     foundpar( HostProxy& hostproxy,
               ChareArrayProxy& arrayProxy,
-              const std::unordered_map< int, std::vector< std::size_t > >& msum,
               ChareArray* const array,
               int chid,
               const std::vector< std::size_t >& found )
     {
       m_parelse.insert( begin(found), end(found) );
-      if (++m_nchpar == msum.size()) {    // if we have heard from all neighbors
-        remove( m_parelse );  // delete particles found elsewhere
-        // find particle that are still have not been found (by close neighbors)
-        std::set< std::size_t > far;
-        std::set_difference( begin(m_parmiss), end(m_parmiss),
-                             begin(m_parelse), end(m_parelse), 
-                             std::inserter( far, begin(far) ) );
-        m_parmiss = far;
-        // if there are still missing particles (not found by close neighbors we
-        // share mesh nodes with), we resort to requesting them to be searched by
-        // all holder chares
-        if (m_parmiss.empty()) {
-          signal2host_parcomcomplete( hostproxy, array );
-        } else {
-          std::vector< std::vector< tk::real > > pexp( m_parmiss.size() );
-          std::size_t j = 0;
-          for (auto i : m_parmiss) pexp[ j++ ] = m_particles[i];
-          m_nchpar = 0;
-          std::vector< std::size_t > miss( begin(m_parmiss), end(m_parmiss) );
-          m_parelse.clear();
-          arrayProxy.collectpar( chid, miss, pexp ); // broadcast to everyone
-        }
-      }
+      // if we have heard from all chares we sent particles to, look up the
+      // particles still not found in the directory
+      if (++m_nchpar == m_nexp) farpar( hostproxy, arrayProxy, chid, array );
     }
 
     //! Find particles missing by the requestor and make those found ours
@@ -284,32 +254,63 @@ class Tracker {
     //! \param[in] hostproxy Charm++ host proxy to which address reductions
     //! \param[in] array Charm++ array object pointer of the holder class
     //! \param[in] found Indices of particles found
-    //! \param[in] nchare Total number of holder array chares
     template< class HostProxy, class ChareArray >
     void collectedpar( HostProxy& hostproxy,
                        ChareArray* const array,
-                       const std::vector< std::size_t >& found,
-                       std::size_t nchare )
+                       const std::vector< std::size_t >& found )
     {
-      // Collect particle indices found elsewhere (by distant neighbors)
+      // Collect particle indices found elsewhere (by distant fellows)
       m_parelse.insert( begin(found), end(found) );
-      if (++m_nchpar == nchare) {  // if we have heard from everyone
+      if (++m_nchpar == m_nexp) {  // if we have heard from all we asked
         remove( m_parelse );  // delete particles found elsewhere
         Assert( m_parmiss == m_parelse, "Not all particles have been found" );
         signal2host_parcomcomplete( hostproxy, array );
       }
     }
 
+    //! Bounding box of our mesh chunk to contribute to the directory
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] chid Charm++ array index (thisIndex of the holder class)
+    //! \return Chare ID followed by the bounding box, {xmin, xmax, ymin, ymax,
+    //!   zmin, zmax}, of our mesh chunk
+    //! \details The holder concatenates the boxes of all chares, e.g., via
+    //!   CkReduction::concat, and passes the result to directory() on all
+    //!   chares before tracking particles.
+    std::vector< tk::real >
+    box( const std::array< std::vector< tk::real >, 3 >& coord, int chid )
+    const {
+      std::vector< tk::real > b{ static_cast< tk::real >( chid ) };
+      for (const auto& x : coord) {
+        auto mm = std::minmax_element( begin(x), end(x) );
+        b.push_back( *mm.first );
+        b.push_back( *mm.second );
+      }
+      return b;
+    }
+
+    //! Store the directory of mesh chunk bounding boxes of all chares
+    //! \param[in] boxes Concatenated results of box() from all chares
+    //! \details Setting up the directory is optional: without it particles
+    //!   not found by the chares across the exit faces are broadcast to all
+    //!   chares.
+    void directory( const std::vector< tk::real >& boxes ) {
+      Assert( boxes.size() % 7 == 0, "Directory size must be divisible by 7" );
+      m_dir = boxes;
+    }
+
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
     //! \brief Pack/Unpack serialize member function
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     void pup( PUP::er& p ) {
       p | m_particles;
-      p | m_elp;
       p | m_parmiss;
       p | m_parelse;
       p | m_nchpar;
+      p | m_nexp;
+      p | m_nchare;
+      p | m_dir;
+      p | m_locator;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -318,19 +319,24 @@ class Tracker {
     //@}
 
   private:
-    //! Particle properties
-    tk::Particles m_particles;
-    //! Element ID in which a particle has last been found for all particles
-    std::vector< std::size_t > m_elp;
+    //! \brief Particle properties (only the 3 spatial components), and element
+    //!   IDs in which the particles have last been found
+    tk::ParticleStore m_particles;
     //! Indicies of particles not found here (missing)
     std::set< std::size_t > m_parmiss;
     //! Indicies of particles not found here but found by fellows
     std::set< std::size_t > m_parelse;
     //! Number of chares we received particles from
     std::size_t m_nchpar;
-    //! Elements surrounding points of elements of mesh chunk we operate on
-    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
-      m_esupel;
+    //! Number of chares we sent particles to and expect to hear back from
+    std::size_t m_nexp;
+    //! Total number of holder array chares
+    std::size_t m_nchare;
+    //! \brief Directory of mesh chunk bounding boxes of all chares, see box()
+    //!   and directory()
+    std::vector< tk::real > m_dir;
+    //! Locator of particles in cells of the mesh chunk we operate on
+    tk::CellLocator m_locator;
     //! Bool that determines whether to send sub-task feedback to host
     bool m_feedback;
 
@@ -341,14 +347,56 @@ class Tracker {
             const std::vector< std::size_t >& miss,
             const std::vector< std::vector< tk::real > >& ps );
 
-    //! Search particle in a single mesh cell
-    bool parinel( const std::array< std::vector< tk::real >, 3 >& coord,
-                  const std::vector< std::size_t >& inpoel,
-                  std::size_t p,
-                  std::size_t e,
-                  std::array< tk::real, 4 >& N );
+    //! Find the fellow chare we share a face of our mesh chunk with
+    int facech( const std::vector< std::size_t >& inpoel,
+                const std::vector< std::size_t >& gid,
+                const std::unordered_map< std::size_t, std::vector< int > >&
+                  nodech,
+                int face ) const;
+
+    //! Find chares whose bounding box contains particles still missing
+    std::map< int, std::vector< std::size_t > > lookup( int chid ) const;
+
+    //! Extract particle data to send to fellow chares
+    std::vector< std::vector< tk::real > >
+    extract( const std::vector< std::size_t >& idx ) const;
+
+    //! \brief Send particles still missing to the chares given by the
+    //!   directory, or to all chares if there is no directory
+    //! \param[in] hostproxy Charm++ host proxy to which address reductions
+    //! \param[in] arrayProxy Charm++ array proxy to which address
+    //!   point-to-point communications (this is the proxy that holds us)
+    //! \param[in] chid Charm++ array index (thisIndex of the holder class)
+    //! \param[in] array Charm++ array object pointer of the holder class
+    template< class HostProxy, class ChareArrayProxy, class ChareArray >
+    void farpar( HostProxy& hostproxy,
+                 const ChareArrayProxy& arrayProxy,
+                 int chid,
+                 ChareArray* const array )
+    {
+      m_nchpar = 0;
+      if (m_dir.empty()) {
+        // no directory set up by the holder, broadcast to all chares
+        std::vector< std::size_t > miss;
+        for (auto i : m_parmiss)
+          if (m_parelse.find(i) == end(m_parelse)) miss.push_back( i );
+        Assert( miss.empty() || m_nchare > 0, "Number of chares not set" );
+        m_nexp = miss.empty() ? 0 : m_nchare;
+        if (!miss.empty()) arrayProxy.collectpar( chid, miss, extract(miss) );
+      } else {
+        auto dest = lookup( chid );
+        m_nexp = dest.size();
+        for (const auto& [c,miss] : dest)
+          arrayProxy[ c ].collectpar( chid, miss, extract(miss) );
+      }
+      if (m_nexp == 0) {
+        remove( m_parelse );  // delete particles found elsewhere
+        Assert( m_parmiss == m_parelse, "Not all particles have been found" );
+        signal2host_parcomcomplete( hostproxy, array );
+      }
+    }
 
-     //! Apply boundary conditions to particles
+    //! Apply boundary conditions to particles
     void applyParBC( std::size_t i );
 
     //! Remove a set of particles
@@ -429,6 +477,8 @@ class Tracker {
       m_nchpar = 0;
       m_parmiss.clear();
       m_parelse.clear();
+      // reclaim storage of particles that left, sorting the rest by element
+      if (m_particles.fragmented()) m_particles.compact();
       using inciter::CkIndex_Transporter;
       array->contribute(
         CkCallback( CkIndex_Transporter::redn_wrapper_parcomcomplete(NULL),
@@ -0,0 +1,74 @@
+// *****************************************************************************
+/*!
+  \file      src/RNG/GaussianMV.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Multi-variate Gaussian random numbers from standard normals
+  \details   Multi-variate Gaussian random numbers from standard normals. Used
+    by the RNG interfaces that have no native multi-variate Gaussian generator,
+    tk::Random123 and tk::RNGSSE.
+*/
+// *****************************************************************************
+#ifndef GaussianMV_h
+#define GaussianMV_h
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Generate multi-variate Gaussian random vectors
+//! \tparam Gaussian Functor type generating standard normal random numbers
+//! \tparam ncomp_t Integer type for the number of vectors and their dimension
+//! \param[in] gaussian Function generating n standard normal numbers into the
+//!   memory given by its second argument, i.e., gaussian( n, r )
+//! \param[in] num Number of random vectors to generate
+//! \param[in] d Dimension d ( d ≥ 1) of output random vectors
+//! \param[in] mean Mean vector of dimension d
+//! \param[in] cov Upper triangular Cholesky factor, U, of the covariance
+//!   matrix, C = U'U, stored row-wise packed as a vector of length d(d+1)/2,
+//!   as returned by LAPACKE_dpptrf( LAPACK_ROW_MAJOR, 'U', ... ). This is the
+//!   same matrix expected by the MKL generator, see tk::MKLRNG::gaussianmv().
+//! \param[in,out] r Pointer to memory to write the num*d random numbers to
+//! \details All num*d standard normal numbers are generated in a single call,
+//!   then transformed to x = mean + U'z in place, vector by vector. The
+//!   triangular multiply proceeds from the last component to the first, since
+//!   component i only depends on components j ≤ i of z. The vectors are
+//!   processed in blocks so that the factor is reused from cache while the
+//!   loop over the vectors of a block is innermost.
+template< class Gaussian, typename ncomp_t >
+void gaussianmv( const Gaussian& gaussian, ncomp_t num, ncomp_t d,
+                 const double* const mean, const double* const cov, double* r )
+{
+  Assert( d > 0, "Dimension of multi-variate Gaussian RNGs must be positive" );
+
+  // Generate all standard normal numbers at once
+  gaussian( num*d, r );
+
+  // Offsets such that U_ji = cov[ row[j] + i ] in the packed upper triangle
+  std::vector< std::size_t > row( d, 0 );
+  for (ncomp_t j=1; j<d; ++j) row[j] = row[j-1] + d - j;
+
+  // Correlate and shift standard normals: x_i = mean_i + sum_{j<=i} U_ji z_j
+  const ncomp_t blk = 64;
+  for (ncomp_t b=0; b<num; b+=blk) {
+    const auto e = std::min( num, b+blk );
+    for (ncomp_t i=d; i-->0; ) {
+      for (ncomp_t v=b; v<e; ++v) {
+        double* z = r + v*d;
+        double x = mean[i];
+        for (ncomp_t j=0; j<=i; ++j) x += cov[ row[j] + i ] * z[j];
+        z[i] = x;
+      }
+    }
+  }
+}
+
+} // tk::
+
+#endif // GaussianMV_h
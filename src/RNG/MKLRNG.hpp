@@ -230,6 +230,15 @@ class MKLRNG {
       m_stream( nullptr )
     { *this = std::move(x); }
 
+    //! Per-particle positioning of streams is not supported by MKL generators
+    //! \details Does nothing, the stream is never positioned. Callers are
+    //!   expected to reject per-particle streams with MKL generators upfront.
+    void particles( int, uint64_t, uint64_t ) const {}
+
+    //! Per-particle positioning of streams is not supported by MKL generators
+    //! \return False, the stream is never positioned
+    bool particle( int, uint64_t, uint64_t ) const { return false; }
+
     //! Accessor to the number of threads we operate on
     std::size_t nthreads() const noexcept
     { return static_cast< std::size_t >( m_nthreads); }
@@ -18,6 +18,7 @@
 #define RNG_h
 
 #include <functional>
+#include <cstdint>
 #include <memory>
 
 #include "Keywords.hpp"
@@ -78,6 +79,14 @@ class RNG {
     void gamma( int stream, ncomp_t num, double a, double b, double* r ) const
     { self->gamma( stream, num, a, b, r ); }
 
+    //! Public interface to enabling per-particle positioning of a stream
+    void particles( int stream, uint64_t first, uint64_t it ) const
+    { self->particles( stream, first, it ); }
+
+    //! Public interface to positioning a stream at the numbers of a particle
+    bool particle( int stream, uint64_t p, uint64_t eq ) const
+    { return self->particle( stream, p, eq ); }
+
     //! Public interface to number of threads accessor
     std::size_t nthreads() const noexcept { return self->nthreads(); }
 
@@ -106,6 +115,8 @@ class RNG {
       virtual void beta(int, ncomp_t, double, double, double, double, double*)
         const = 0;
       virtual void gamma( int, ncomp_t, double, double, double* ) const = 0;
+      virtual void particles( int, uint64_t, uint64_t ) const = 0;
+      virtual bool particle( int, uint64_t, uint64_t ) const = 0;
       virtual std::size_t nthreads() const noexcept = 0;
     };
 
@@ -128,6 +139,10 @@ class RNG {
       { data.beta( stream, num, p, q, a, b, r ); }
       void gamma( int stream, ncomp_t num, double a, double b, double* r ) const
         override { data.gamma( stream, num, a, b, r ); }
+      void particles( int stream, uint64_t first, uint64_t it ) const override
+      { data.particles( stream, first, it ); }
+      bool particle( int stream, uint64_t p, uint64_t eq ) const override
+      { return data.particle( stream, p, eq ); }
       std::size_t nthreads() const noexcept override { return data.nthreads(); }
       T data;
     };
@@ -20,6 +20,7 @@
 #include <boost/random/gamma_distribution.hpp>
 
 #include "Exception.hpp"
+#include "GaussianMV.hpp"
 #include "Macro.hpp"
 #include "Options/RNGSSESeqLen.hpp"
 
@@ -111,17 +112,17 @@ class RNGSSE {
     //! \param[in] num Number of RNGs to generate
     //! \param[in] d Dimension d ( d ≥ 1) of output random vectors
     //! \param[in] mean Mean vector of dimension d
-    //! \param[in] cov Lower triangle of covariance matrix, stored as a vector
-    //!   of length d(d+1)/2
+    //! \param[in] cov Upper triangular Cholesky factor of the covariance
+    //!   matrix, stored row-wise packed as a vector of length d(d+1)/2
     //! \param[in,out] r Pointer to memory to write the random numbers to
-    //! \warning Not implemented!
-    void gaussianmv( [[maybe_unused]] int tid,
-                     [[maybe_unused]] ncomp_t num,
-                     [[maybe_unused]] ncomp_t d,
-                     [[maybe_unused]] const double* const mean,
-                     [[maybe_unused]] const double* const cov,
-                     [[maybe_unused]] double* r ) const
+    //! \details The standard normal numbers for all num vectors are generated
+    //!   in a single batch by gaussian(), then correlated with the Cholesky
+    //!   factor, see tk::gaussianmv().
+    void gaussianmv( int tid, ncomp_t num, ncomp_t d, const double* const mean,
+                     const double* const cov, double* r ) const
     {
+      tk::gaussianmv( [&]( ncomp_t n, double* z ){ gaussian( tid, n, z ); },
+                      num, d, mean, cov, r );
     }
 
     //! Beta RNG: Generate beta random numbers
@@ -201,6 +202,15 @@ class RNGSSE {
       m_stream( nullptr )
     { *this = std::move( x ); }
 
+    //! Per-particle positioning of streams is not supported by RNGSSE
+    //! \details Does nothing, the stream is never positioned. Callers are
+    //!   expected to reject per-particle streams with RNGSSE upfront.
+    void particles( int, uint64_t, uint64_t ) const {}
+
+    //! Per-particle positioning of streams is not supported by RNGSSE
+    //! \return False, the stream is never positioned
+    bool particle( int, uint64_t, uint64_t ) const { return false; }
+
     //! Accessor to the number of threads we operate on
     SeqNumType nthreads() const noexcept { return m_nthreads; }
 
@@ -6,7 +6,14 @@
              2019-2020 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Interface to Random123 random number generators
-  \details   Interface to Random123 random number generators
+  \details   Interface to Random123 random number generators. Every word of
+    each block generated by the counter-based generator is used: words not
+    consumed by a call are kept per stream and used by the next call on the
+    same stream. The sequence of numbers of a stream is thus independent of
+    how many numbers are requested per call. Optionally, a stream can be
+    positioned at a counter derived from a particle id, a time step, and an
+    equation, see particles() and particle(), which makes the numbers drawn
+    for a particle independent of which stream draws them.
 */
 // *****************************************************************************
 #ifndef Random123_h
@@ -23,6 +30,7 @@
 #include <boost/random/gamma_distribution.hpp>
 
 #include "Exception.hpp"
+#include "GaussianMV.hpp"
 #include "Keywords.hpp"
 #include "Macro.hpp"
 
@@ -40,29 +48,73 @@ class Random123 {
     using value_type = typename CBRNG::ctr_type::value_type;
     using arg_type = std::vector< std::array< value_type, CBRNG_DATA_SIZE > >;
 
+    //! Number of words generated per block
+    static const std::size_t NWORD = ctr_type::static_size;
+
+    //! Block of generated words, and the position of the next unused word
+    struct Block {
+      ctr_type res;
+      std::size_t pos;
+    };
+    using block_type = std::vector< Block >;
+
+    //! Particle numbering and time step of a stream positioned per particle
+    struct Particles {
+      bool on;
+      uint64_t first;
+      uint64_t it;
+    };
+    using particles_type = std::vector< Particles >;
+
+    //! Generate the next block of a stream and advance its counter
+    //! \param[in] rng Random123 RNG object
+    //! \param[in,out] d RNG arguments of the stream
+    //! \return Block of generated words
+    static ctr_type block( CBRNG& rng,
+                           std::array< value_type, CBRNG_DATA_SIZE >& d )
+    {
+      ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
+      key_type key = {{ d[2] }};            // assemble key
+      auto res = rng( ctr, key );           // generate
+      ctr.incr();
+      d[0] = ctr[0];
+      d[1] = ctr[1];
+      return res;
+    }
+
+    //! Return the next word of a stream, generating a new block if needed
+    //! \param[in] rng Random123 RNG object
+    //! \param[in,out] d RNG arguments of the stream
+    //! \param[in,out] b Last block generated by the stream
+    //! \return Next word of the stream
+    static value_type next( CBRNG& rng,
+                            std::array< value_type, CBRNG_DATA_SIZE >& d,
+                            Block& b )
+    {
+      if (b.pos == NWORD) {
+        b.res = block( rng, d );
+        b.pos = 0;
+      }
+      return b.res[ b.pos++ ];
+    }
+
     //! Adaptor to use a std distribution with the Random123 generator
     //! \see C++ concepts: UniformRandomNumberGenerator
     struct Adaptor {
-      using result_type = unsigned long;
-      Adaptor( CBRNG& r, arg_type& d, int t ) : rng(r), data(d), tid(t) {}
+      using result_type = value_type;
+      Adaptor( CBRNG& r, arg_type& d, block_type& b, int t ) :
+        rng(r), data(d), blk(b), tid(t) {}
       static constexpr result_type min() { return 0u; }
       static constexpr result_type max() {
         return std::numeric_limits< result_type >::max();
       }
-      result_type operator()()
-      {
-        auto& d = data[ static_cast< std::size_t >( tid ) ];
-        d[2] = static_cast< result_type >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
-        auto res = rng( ctr, key );           // generate
-        ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
-        return res[0];
+      result_type operator()() {
+        const auto s = static_cast< std::size_t >( tid );
+        return next( rng, data[s], blk[s] );
       }
       CBRNG& rng;
       arg_type& data;
+      block_type& blk;
       int tid;
     };
 
@@ -70,26 +122,57 @@ class Random123 {
     //! Constructor
     //! \param[in] n Initialize RNG using this many independent streams
     //! \param[in] seed RNG seed
-    explicit Random123( uint64_t n = 1, uint64_t seed = 0 ) {
+    //! \details The counter of each stream starts at {0,seed<<32} and the key
+    //!   of each stream is its ID.
+    explicit Random123( uint64_t n = 1, uint64_t seed = 0 ) : m_seed( seed ) {
       Assert( n > 0, "Need at least one thread" );
       m_data.resize( n, {{ 0, seed << 32, 0 }} );
+      for (uint64_t i=0; i<n; ++i) m_data[i][2] = i;
+      m_block.resize( n, Block{ ctr_type(), NWORD } );
+      m_particles.resize( n, Particles{ false, 0, 0 } );
     }
 
     //! Uniform RNG: Generate uniform random numbers
     //! \param[in] tid Thread (or more precisely) stream ID
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
+    //! \details Words left over from the previous call on this stream are
+    //!   used first. Then as many full blocks as fit are generated in a single
+    //!   loop whose iterations only differ in the counter, so the compiler can
+    //!   vectorize it across blocks. The remaining numbers are taken from one
+    //!   more block, whose unused words are kept for the next call.
     void uniform( int tid, ncomp_t num, double* r ) const {
-      auto& d = m_data[ static_cast< std::size_t >( tid ) ];
-      for (ncomp_t i=0; i<num; ++i) {
-        d[2] = static_cast< unsigned long >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
-        auto res = m_rng( ctr, key );         // generate
-        r[i] = r123::u01fixedpt< double, value_type >( res[0] );
-        ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
+      const auto s = static_cast< std::size_t >( tid );
+      auto& d = m_data[ s ];
+      auto& b = m_block[ s ];
+      ncomp_t i = 0;
+
+      // Use words left over from the previous call
+      for (; i<num && b.pos<NWORD; ++i)
+        r[i] = r123::u01fixedpt< double, value_type >( b.res[ b.pos++ ] );
+
+      // Generate full blocks in a batch if the counter does not carry
+      const auto nblk = (num - i) / NWORD;
+      if (nblk > 0 && d[0] <= std::numeric_limits< value_type >::max() - nblk)
+      {
+        const key_type key = {{ d[2] }};
+        const auto c0 = d[0];
+        const auto c1 = d[1];
+        double* o = r + i;
+        for (ncomp_t k=0; k<nblk; ++k) {
+          const ctr_type ctr = {{ c0 + k, c1 }};
+          const auto res = m_rng( ctr, key );
+          for (std::size_t w=0; w<NWORD; ++w)
+            o[ k*NWORD + w ] = r123::u01fixedpt< double, value_type >( res[w] );
+        }
+        d[0] = c0 + nblk;
+        i += nblk * NWORD;
+      }
+
+      // Generate the rest, keeping unused words of the last block
+      for (; i<num; ++i) {
+        const auto w = next( m_rng, d, b );
+        r[i] = r123::u01fixedpt< double, value_type >( w );
       }
     }
 
@@ -111,7 +194,7 @@ class Random123 {
     //!   cache, as Box-Muller, implemented using the polar algorithm generates
     //!   2 Gaussian numbers for each pair of uniform ones, caching every 2nd.
     void gaussian( int tid, ncomp_t num, double* r ) const {
-      Adaptor generator( m_rng, m_data, tid );
+      Adaptor generator( m_rng, m_data, m_block, tid );
       std::normal_distribution<> gauss_dist( 0.0, 1.0 );
       for (ncomp_t i=0; i<num; ++i) r[i] = gauss_dist( generator );
     }
@@ -122,17 +205,17 @@ class Random123 {
     //! \param[in] num Number of RNGs to generate
     //! \param[in] d Dimension d ( d ≥ 1) of output random vectors
     //! \param[in] mean Mean vector of dimension d
-    //! \param[in] cov Lower triangle of covariance matrix, stored as a vector
-    //!   of length d(d+1)/2
+    //! \param[in] cov Upper triangular Cholesky factor of the covariance
+    //!   matrix, stored row-wise packed as a vector of length d(d+1)/2
     //! \param[in,out] r Pointer to memory to write the random numbers to
-    //! \warning Not implemented!
-    void gaussianmv( [[maybe_unused]] int tid,
-                     [[maybe_unused]] ncomp_t num,
-                     [[maybe_unused]] ncomp_t d,
-                     [[maybe_unused]] const double* const mean,
-                     [[maybe_unused]] const double* const cov,
-                     [[maybe_unused]] double* r ) const
+    //! \details The standard normal numbers for all num vectors are generated
+    //!   in a single batch by gaussian(), then correlated with the Cholesky
+    //!   factor, see tk::gaussianmv().
+    void gaussianmv( int tid, ncomp_t num, ncomp_t d, const double* const mean,
+                     const double* const cov, double* r ) const
     {
+      tk::gaussianmv( [&]( ncomp_t n, double* z ){ gaussian( tid, n, z ); },
+                      num, d, mean, cov, r );
     }
 
     //! Beta RNG: Generate beta random numbers
@@ -153,7 +236,7 @@ class Random123 {
     //!   only known here) must be stored in the adaptor functor's state.
     void beta( int tid, ncomp_t num, double p, double q, double a, double b,
                double* r ) const {
-      Adaptor generator( m_rng, m_data, tid );
+      Adaptor generator( m_rng, m_data, m_block, tid );
       boost::random::beta_distribution<> beta_dist( p, q );
       fenv_t fe;
       feholdexcept( &fe );
@@ -177,7 +260,7 @@ class Random123 {
     //!   with no arguments, thus the RNG state and the thread ID (this latter
     //!   only known here) must be stored in the adaptor functor's state.
     void gamma( int tid, ncomp_t num, double a, double b, double* r ) const {
-      Adaptor generator( m_rng, m_data, tid );
+      Adaptor generator( m_rng, m_data, m_block, tid );
       boost::random::gamma_distribution<> gamma_dist( a, b );
       fenv_t fe;
       feholdexcept( &fe );
@@ -186,12 +269,53 @@ class Random123 {
       feupdateenv( &fe );
     }
 
+    //! Enable positioning a stream per particle
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \param[in] first Global id of the particle with local index zero
+    //! \param[in] it Time step the numbers are drawn for
+    //! \details After this call particle() positions the stream at the counter
+    //!   of a given particle, see particle().
+    void particles( int tid, uint64_t first, uint64_t it ) const {
+      m_particles[ static_cast< std::size_t >( tid ) ] =
+        Particles{ true, first, it };
+    }
+
+    //! Position a stream at the start of the numbers of a particle
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \param[in] p Local particle index, added to the global id of the
+    //!   particle with local index zero given to particles()
+    //! \param[in] eq Key distinguishing the equations drawing numbers for the
+    //!   same particle in the same time step
+    //! \return True if the stream has been positioned, false if particles()
+    //!   has not been called for the stream, in which case it is not changed
+    //! \details The key of the stream is set to (it << 16) + eq, and its
+    //!   counter to {seed<<32,id}, where id is the global particle id. The
+    //!   numbers drawn until the stream is positioned again are therefore a
+    //!   function of the seed, the global particle id, the time step, and the
+    //!   equation only. The 64-bit key leaves 16 bits for the equation and 48
+    //!   bits for the time step.
+    bool particle( int tid, uint64_t p, uint64_t eq ) const {
+      const auto s = static_cast< std::size_t >( tid );
+      const auto& q = m_particles[ s ];
+      if (!q.on) return false;
+      Assert( eq < (1UL << 16), "Equation key too large" );
+      auto& d = m_data[ s ];
+      d[0] = m_seed << 32;
+      d[1] = q.first + p;
+      d[2] = (q.it << 16) + eq;
+      m_block[ s ].pos = NWORD;
+      return true;
+    }
+
     //! Accessor to the number of threads we operate on
     uint64_t nthreads() const noexcept { return m_data.size(); }
 
   private:
-    mutable CBRNG m_rng;        //!< Random123 RNG object
-    mutable arg_type m_data;    //!< RNG arguments
+    uint64_t m_seed;                    //!< RNG seed
+    mutable CBRNG m_rng;                //!< Random123 RNG object
+    mutable arg_type m_data;            //!< RNG arguments
+    mutable block_type m_block;         //!< Last block generated by each stream
+    mutable particles_type m_particles; //!< Per-particle positioning by stream
 };
 
 } // tk::
@@ -34,7 +34,7 @@ class BigCrush {
     { return ctr::Battery().name( rngtest::ctr::BatteryType::BIGCRUSH ); }
 
     //! Add statistical tests to battery
-    void addTests( std::vector< std::function< StatTest() > >& tests,
+    void addTests( std::vector< std::function< StatTest(int) > >& tests,
                    tk::ctr::RNGType rng,
                    CProxy_TestU01Suite& proxy );
 };
@@ -45,7 +45,7 @@ extern TestStack g_testStack;
 using rngtest::Crush;
 
 void
-Crush::addTests( std::vector< std::function< StatTest() > >& tests,
+Crush::addTests( std::vector< std::function< StatTest(int) > >& tests,
                  tk::ctr::RNGType rng,
                  CProxy_TestU01Suite& proxy )
 // *****************************************************************************
@@ -0,0 +1,213 @@
+// *****************************************************************************
+/*!
+  \file      src/RNGTest/Random123Benchmark.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Throughput benchmark of the Random123 RNG wrapper
+  \details   Throughput benchmark of the Random123 RNG wrapper, tk::Random123,
+    comparing it to generating a full block for every number and using only
+    its first word, which is how tk::Random123 used to generate numbers.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <functional>
+#include <limits>
+#include <random>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <cfenv>
+
+#include "NoWarning/threefry.hpp"
+#include "NoWarning/philox.hpp"
+#include "NoWarning/uniform.hpp"
+#include "NoWarning/beta_distribution.hpp"
+#include <boost/random/gamma_distribution.hpp>
+
+#include "Types.hpp"
+#include "Keywords.hpp"
+#include "Timer.hpp"
+#include "Random123.hpp"
+#include "RNGTestPrint.hpp"
+#include "Random123Benchmark.hpp"
+
+namespace rngtest {
+
+namespace {
+
+//! Random123 generator using only the first word of every generated block
+//! \details This reproduces the previous implementation of tk::Random123 and
+//!   is only used as a reference for the throughput benchmark.
+template< class CBRNG >
+class SingleWord {
+
+  private:
+    using ctr_type = typename CBRNG::ctr_type;
+    using key_type = typename CBRNG::key_type;
+    using value_type = typename CBRNG::ctr_type::value_type;
+
+    //! Adaptor to use a distribution with the Random123 generator
+    struct Adaptor {
+      using result_type = value_type;
+      explicit Adaptor( SingleWord& g ) : gen( g ) {}
+      static constexpr result_type min() { return 0u; }
+      static constexpr result_type max() {
+        return std::numeric_limits< result_type >::max();
+      }
+      result_type operator()() { return gen.word(); }
+      SingleWord& gen;
+    };
+
+  public:
+    //! Constructor
+    //! \param[in] seed RNG seed
+    explicit SingleWord( uint64_t seed ) : m_rng(), m_ctr{{ 0, seed << 32 }} {}
+
+    //! Generate a block and return its first word
+    //! \return First word of the block generated
+    value_type word() {
+      key_type key = {{ 0 }};
+      auto res = m_rng( m_ctr, key );
+      m_ctr.incr();
+      return res[0];
+    }
+
+    //! Generate uniform random numbers
+    //! \param[in] num Number of RNGs to generate
+    //! \param[in,out] r Pointer to memory to write the random numbers to
+    void uniform( std::size_t num, double* r ) {
+      for (std::size_t i=0; i<num; ++i)
+        r[i] = r123::u01fixedpt< double, value_type >( word() );
+    }
+
+    //! Generate Gaussian random numbers
+    //! \param[in] num Number of RNGs to generate
+    //! \param[in,out] r Pointer to memory to write the random numbers to
+    void gaussian( std::size_t num, double* r ) {
+      Adaptor generator( *this );
+      std::normal_distribution<> gauss_dist( 0.0, 1.0 );
+      for (std::size_t i=0; i<num; ++i) r[i] = gauss_dist( generator );
+    }
+
+    //! Generate beta random numbers
+    //! \param[in] num Number of RNGs to generate
+    //! \param[in] p First beta shape parameter
+    //! \param[in] q Second beta shape parameter
+    //! \param[in,out] r Pointer to memory to write the random numbers to
+    void beta( std::size_t num, double p, double q, double* r ) {
+      Adaptor generator( *this );
+      boost::random::beta_distribution<> beta_dist( p, q );
+      fenv_t fe;
+      feholdexcept( &fe );
+      for (std::size_t i=0; i<num; ++i) r[i] = beta_dist( generator );
+      feclearexcept( FE_UNDERFLOW );
+      feupdateenv( &fe );
+    }
+
+    //! Generate gamma random numbers
+    //! \param[in] num Number of RNGs to generate
+    //! \param[in] a Gamma shape parameter
+    //! \param[in] b Gamma scale factor
+    //! \param[in,out] r Pointer to memory to write the random numbers to
+    void gamma( std::size_t num, double a, double b, double* r ) {
+      Adaptor generator( *this );
+      boost::random::gamma_distribution<> gamma_dist( a, b );
+      fenv_t fe;
+      feholdexcept( &fe );
+      for (std::size_t i=0; i<num; ++i) r[i] = gamma_dist( generator );
+      feclearexcept( FE_UNDERFLOW );
+      feupdateenv( &fe );
+    }
+
+  private:
+    CBRNG m_rng;        //!< Random123 RNG object
+    ctr_type m_ctr;     //!< Counter
+};
+
+//! Total number of random numbers to generate per measurement
+const std::size_t NUM = 1UL << 22;
+
+//! Sink preventing the compiler from optimizing away generating numbers
+volatile double g_sink = 0.0;
+
+//! Measure throughput of generating random numbers in batches
+//! \param[in] batch Number of random numbers generated per call
+//! \param[in] gen Function generating a batch of numbers into its argument
+//! \return Throughput in millions of random numbers per second
+tk::real throughput( std::size_t batch,
+                     const std::function< void(double*) >& gen )
+{
+  std::vector< double > r( batch );
+  tk::Timer timer;
+  for (std::size_t n=0; n<NUM; n+=batch) gen( r.data() );
+  g_sink = g_sink + r[0];
+  return static_cast< tk::real >( NUM ) / timer.dsec() / 1.0e6;
+}
+
+//! Benchmark a Random123 generator
+//! \param[in] print Pretty printer
+//! \param[in] name Name of the generator
+template< class CBRNG >
+void benchmark( const RNGTestPrint& print, const std::string& name ) {
+  print.subsection( name );
+  for (std::size_t batch : { 4UL, 4096UL }) {
+    SingleWord< CBRNG > o( 0 );
+    tk::Random123< CBRNG > n( 1, 0 );
+    auto b = static_cast< kw::ncomp::info::expect::type >( batch );
+
+    std::vector< std::pair< std::string, std::array< tk::real, 2 > > > t{
+      { "uniform",
+        {{ throughput( batch, [&]( double* r ){ o.uniform( batch, r ); } ),
+           throughput( batch, [&]( double* r ){ n.uniform( 0, b, r ); } ) }} },
+      { "Gaussian",
+        {{ throughput( batch, [&]( double* r ){ o.gaussian( batch, r ); } ),
+           throughput( batch, [&]( double* r ){ n.gaussian( 0, b, r ); } ) }} },
+      { "beta",
+        {{ throughput( batch,
+             [&]( double* r ){ o.beta( batch, 0.5, 0.5, r ); } ),
+           throughput( batch,
+             [&]( double* r ){ n.beta( 0, b, 0.5, 0.5, 0.0, 1.0, r ); } ) }} },
+      { "gamma",
+        {{ throughput( batch,
+             [&]( double* r ){ o.gamma( batch, 2.0, 1.0, r ); } ),
+           throughput( batch,
+             [&]( double* r ){ n.gamma( 0, b, 2.0, 1.0, r ); } ) }} } };
+
+    for (const auto& d : t) {
+      std::stringstream ss;
+      ss << std::fixed << std::setprecision(1)
+         << d.second[0] << " -> " << d.second[1] << " M/s (x"
+         << std::setprecision(2) << d.second[1] / d.second[0] << ")";
+      print.item( d.first + ", batch " + std::to_string(batch), ss.str() );
+    }
+  }
+}
+
+} // ::
+
+void
+benchmarkRandom123( const RNGTestPrint& print )
+// *****************************************************************************
+//  Run throughput benchmark of the Random123 RNG wrapper
+//! \param[in] print Pretty printer
+//! \details For each Random123 generator and distribution the throughput of
+//!   using only the first word of each block is compared to that of
+//!   tk::Random123, which uses all words of each block. Numbers are generated
+//!   in small batches, as done per particle by the differential equations, and
+//!   in large batches.
+// *****************************************************************************
+{
+  print.section( "Random123 throughput, single-word -> tk::Random123" );
+  benchmark< r123::Threefry2x64 >( print, "Threefry2x64" );
+  benchmark< r123::Philox2x64 >( print, "Philox2x64" );
+  print.endsubsection();
+}
+
+} // rngtest::
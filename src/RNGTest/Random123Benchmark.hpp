@@ -0,0 +1,26 @@
+// *****************************************************************************
+/*!
+  \file      src/RNGTest/Random123Benchmark.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Throughput benchmark of the Random123 RNG wrapper
+  \details   Throughput benchmark of the Random123 RNG wrapper, tk::Random123,
+    comparing it to generating a full block for every number and using only
+    its first word.
+*/
+// *****************************************************************************
+#ifndef Random123Benchmark_h
+#define Random123Benchmark_h
+
+namespace rngtest {
+
+class RNGTestPrint;
+
+//! Run throughput benchmark of the Random123 RNG wrapper
+void benchmarkRandom123( const RNGTestPrint& print );
+
+} // rngtest::
+
+#endif // Random123Benchmark_h
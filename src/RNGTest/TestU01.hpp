@@ -39,8 +39,12 @@ class TestU01 : public CBase_TestU01< TestU01Props > {
     //! Run test then evaluate it
     void run() { m_props.proxy().evaluate( m_props.run() ); }
 
-    //! Query and contribute test run time measured in seconds
-    void time() { m_props.proxy().time( m_props.time() ); }
+    //! \brief Query and contribute test run time measured in seconds, and the
+    //!   number of random numbers generated and the time spent generating them
+    void time() {
+      m_props.proxy().time( m_props.id(), m_props.time(), m_props.ngen(),
+                            m_props.tgen() );
+    }
 
   private:
     TestU01Props m_props;               //!< TestU01 test properties
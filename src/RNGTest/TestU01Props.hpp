@@ -59,19 +59,24 @@ class TestU01Props {
     //!    can.
     explicit TestU01Props() :
       m_proxy(),
+      m_id( 0 ),
       m_rng( tk::ctr::RNGType::NO_RNG ),
       m_names(),
       m_xargs(),
       m_gen( nullptr ),
       m_runner( g_testStack.TestU01.runner.get<Test>() ),
       m_res( ResultPtr(Creator()) ),
-      m_time( 0.0 ) {}
+      m_time( 0.0 ),
+      m_ngen( 0 ),
+      m_tgen( 0.0 ) {}
 
     //! \brief Initializer constructor
     //! \details None of the state data is const since the this class is
     //!   designed to be migratable over the network by the Charm++ runtime
     //!   system.
     //! \param[in] host Host proxy facilitating call-back to host object chare.
+    //! \param[in] id Index of the test in its suite, used to identify the test
+    //!   when calling back to the host
     //! \param[in] rng Random number generator ID enum to be tested
     //! \param[in] n Vector of statisical test names (can be more than one
     //!   associated with a given test, since a test can contain more than one
@@ -79,22 +84,27 @@ class TestU01Props {
     //! \param[in] gen Raw function pointer to TestU01 statistical test
     //! \param[in] xargs Extra arguments to test-run
     explicit TestU01Props( Proxy& host,
+                           std::size_t id,
                            tk::ctr::RNGType rng,
                            std::vector< std::string >&& n,
                            unif01_Gen* gen,
                            Ts&&... xargs ) :
       m_proxy( host ),
+      m_id( id ),
       m_rng( rng ),
       m_names( std::move(n) ),
       m_xargs( std::forward<Ts>(xargs)... ),
       m_gen( gen ),
       m_runner( g_testStack.TestU01.runner.get<Test>() ),
       m_res( ResultPtr(Creator()) ),
-      m_time( 0.0 ) {}
+      m_time( 0.0 ),
+      m_ngen( 0 ),
+      m_tgen( 0.0 ) {}
 
     //! Copy assignment
     TestU01Props& operator=( const TestU01Props& x) {
       m_proxy = x.m_proxy;
+      m_id = x.m_id;
       m_rng = x.m_rng;
       m_names = x.m_names;
       m_xargs = x.m_xargs;
@@ -102,6 +112,8 @@ class TestU01Props {
       m_runner = x.m_runner;
       m_res = ResultPtr(Creator());
       m_time = x.m_time;
+      m_ngen = x.m_ngen;
+      m_tgen = x.m_tgen;
       return *this;
     }
 
@@ -119,6 +131,7 @@ class TestU01Props {
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     void pup( PUP::er& p ) {
       p | m_proxy;
+      p | m_id;
       p | m_rng;
       p | m_names;
       p | m_xargs;
@@ -128,6 +141,8 @@ class TestU01Props {
         m_res = ResultPtr( Creator() );
       }
       p | m_time;
+      p | m_ngen;
+      p | m_tgen;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -139,6 +154,10 @@ class TestU01Props {
     //! \return Host proxy
     Proxy& proxy() noexcept { return m_proxy; }
 
+    //! Test index accessor
+    //! \return Index of the test in its suite
+    std::size_t id() const noexcept { return m_id; }
+
     //! Number of results/test (i.e., p-values) accessor
     //! \return Number of p-values this test yields
     std::size_t npval() const { return m_names.size(); }
@@ -162,10 +181,14 @@ class TestU01Props {
     //!   p-values)
     //! - 2: RNG name used to run the test: sub-vector length = 1
     std::vector< std::vector< std::string > > run() {
-      // Run and time statistical test
+      // Run and time statistical test, also collect time spent generating
+      const auto& stat = testU01GenStat();
+      const auto stat0 = stat;
       tk::Timer timer;
       const auto pvals = m_runner( m_gen, m_res.get(), m_xargs );
       m_time = timer.dsec();
+      m_ngen = stat.ngen - stat0.ngen;
+      m_tgen = stat.tgen - stat0.tgen;
       // Construct status
       std::vector< std::string > pvalstrs;
       for (std::size_t p=0; p<m_names.size(); ++p) {
@@ -182,6 +205,14 @@ class TestU01Props {
     std::pair< std::string, tk::real > time()
     { return { tk::ctr::RNG().name(m_rng), m_time }; }
 
+    //! Accessor to the number of random numbers generated for the test
+    //! \return Number of random numbers generated while running the test
+    uint64_t ngen() const noexcept { return m_ngen; }
+
+    //! Accessor to the time spent generating random numbers for the test
+    //! \return Time spent generating random numbers in seconds
+    tk::real tgen() const noexcept { return m_tgen; }
+
   private:
     //! \brief Pack/Unpack TestU01 external generator pointer
     //! \details Admittedly, the code below is ugly and looks stupid at first
@@ -311,6 +342,7 @@ class TestU01Props {
     }
 
     Proxy m_proxy;                      //!< Host proxy
+    std::size_t m_id;                   //!< Index of the test in its suite
     tk::ctr::RNGType m_rng;             //!< RNG id
     std::vector< std::string > m_names; //!< Name(s) of tests
     Xargs m_xargs;                      //!< Extra args for run()
@@ -318,6 +350,8 @@ class TestU01Props {
     RunFn m_runner;                     //!< Test runner function
     ResultPtr m_res;                    //!< TestU01 results
     tk::real m_time;                    //!< Test run time measured in seconds
+    uint64_t m_ngen;                    //!< Number of random numbers generated
+    tk::real m_tgen;                    //!< Time spent generating in seconds
 };
 
 } // rngtest::
@@ -53,7 +53,7 @@ class TestU01Stack {
     //!   constructor, it only records the information on how to call the test
     //!   constructor in the future. That is it binds the constructor arguments
     //!   to the constructor call and records the the information so only a
-    //!   function call "()" is necessary to instantiate it.
+    //!   function call "(pe)" is necessary to instantiate it on PE pe.
     //! \param[in] proxy Charm++ host proxy to which the test calls back to
     //! \param[in] tests Vector of test constructors to add tests to
     //! \param[in] r RNG ID enum
@@ -64,7 +64,7 @@ class TestU01Stack {
     //! \param[in] xargs Extra arguments to test-run
     template< class TestType, class Proxy, typename... Ts >
     void add( Proxy& proxy,
-              std::vector< std::function< StatTest() > >& tests,
+              std::vector< std::function< StatTest(int) > >& tests,
               tk::ctr::RNGType r,
               unif01_Gen* const gen,
               std::vector< std::string >&& names,
@@ -77,8 +77,9 @@ class TestU01Stack {
         std::bind( boost::value_factory< Host >(),
                    std::function< Model() >(),
                    std::forward< Props >(
-                     Props( proxy, r, std::move(names), gen,
-                            std::forward<Ts>(xargs)... ) ) ) );
+                     Props( proxy, tests.size(), r, std::move(names), gen,
+                            std::forward<Ts>(xargs)... ) ),
+                   std::placeholders::_1 ) );
     }
 
     /** @name Stack of TestU01 statistical tests wrappers
@@ -14,12 +14,18 @@
 
 #include <string>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <numeric>
+#include <algorithm>
 #include <cstddef>
 
 #include "NoWarning/format.hpp"
 
 #include "TestU01Suite.hpp"
 #include "TestStack.hpp"
+#include "Writer.hpp"
 #include "SmallCrush.hpp"
 #include "Crush.hpp"
 #include "BigCrush.hpp"
@@ -41,12 +47,16 @@ using rngtest::TestU01Suite;
 TestU01Suite::TestU01Suite( ctr::BatteryType suite ) :
   m_ctrs(),
   m_tests(),
+  m_cost(),
+  m_order(),
+  m_model(),
   m_name(),
   m_npval(0),
   m_ncomplete(0),
   m_ntest(0),
   m_nfail(),
   m_time(),
+  m_gen(),
   m_failed()
 // *****************************************************************************
 // Constructor
@@ -62,8 +72,8 @@ TestU01Suite::TestU01Suite( ctr::BatteryType suite ) :
     m_name = addTests< BigCrush >();
   else Throw( "Non-TestU01 RNG test suite passed to TestU01Suite" );
 
-  // Construct all tests and store handles
-  for (const auto& t : m_ctrs) m_tests.emplace_back( t() );
+  // Construct all tests distributed across PEs and store handles
+  schedule();
 
   // Collect number of results from all tests (one per RNG)
   for (std::size_t i=0; i<ntest(); ++i) m_tests[i].npval();
@@ -114,8 +124,8 @@ TestU01Suite::names( std::vector< std::string > n )
                      m_npval*rngs.size(),
                      m_ctrs.size() );
 
-    // Run battery of RNG tests
-    for (const auto& t : m_tests) t.run();
+    // Run battery of RNG tests, longest first
+    for (auto i : m_order) m_tests[i].run();
 
     // Initialize space for counting the number failed tests per RNG. Note
     // that we could use tk::ctr::RNGType as the map-key here instead of the
@@ -155,13 +165,23 @@ TestU01Suite::evaluate( std::vector< std::vector< std::string > > status )
 }
 
 void
-TestU01Suite::time( std::pair< std::string, tk::real > t )
+TestU01Suite::time( std::size_t id,
+                    std::pair< std::string, tk::real > t,
+                    uint64_t ngen,
+                    tk::real tgen )
 // *****************************************************************************
 // Collect test times measured in seconds from a statistical test
+//! \param[in] id Index of the test in the suite
 //! \param[in] t Measured time to do the test for an RNG
+//! \param[in] ngen Number of random numbers generated for the test
+//! \param[in] tgen Time spent generating random numbers for the test
 // *****************************************************************************
 {
   m_time[ t.first ] += t.second;
+  m_model[ costKey(id) ] = t.second;
+  auto& g = m_gen[ t.first ];
+  g.first += ngen;
+  g.second += tgen;
 
   if ( ++m_ncomplete == m_ctrs.size() ) assess();
 }
@@ -180,6 +200,22 @@ TestU01Suite::assess()
     print.failed( "Failed statistics", m_npval*rngs.size(), m_failed );
   } else print.note< tk::QUIET >( "All tests passed" );
 
+  // Output generator throughput and the fraction of test time it takes
+  print.section< tk::QUIET >( "Generator throughput" );
+  for (const auto& g : m_gen) {
+    std::stringstream ss;
+    ss << std::setprecision(3);
+    if (g.second.second > 0.0)
+      ss << static_cast< tk::real >( g.second.first ) / g.second.second / 1.0e6
+         << " M/s, ";
+    auto t = m_time.find( g.first );
+    if (t != end(m_time) && t->second > 0.0)
+      ss << 100.0 * g.second.second / t->second << "% of test time";
+    else
+      ss << "test time too short to measure";
+    print.item< tk::QUIET >( g.first, ss.str() );
+  }
+
   // Cost and quality assessment only for more than one RNG
   if (m_time.size() > 1) {
     // Output measured times per RNG in order of computational cost
@@ -192,6 +228,9 @@ TestU01Suite::assess()
                 m_nfail );
   }
 
+  // Store measured test costs for scheduling the next run
+  writeCost();
+
   // Quit
   mainProxy.finalize();
 }
@@ -207,4 +246,125 @@ TestU01Suite::ntest() const
   return m_ctrs.size() / rngs.size();
 }
 
+std::tuple< std::string, std::size_t, std::string >
+TestU01Suite::costKey( std::size_t i ) const
+// *****************************************************************************
+// Return the key of a test in the test cost model
+//! \param[in] i Index of the test in the suite
+//! \return Battery name, test index within the battery, and RNG name
+//! \details The tests of all RNGs are stored RNG by RNG, see addTests().
+// *****************************************************************************
+{
+  const auto& rngs = g_inputdeck.get< tag::selected, tag::rng >();
+  const auto n = ntest();
+  return std::make_tuple( m_name, i % n, tk::ctr::RNG().name( rngs[ i/n ] ) );
+}
+
+void
+TestU01Suite::schedule()
+// *****************************************************************************
+// Construct all tests distributed across PEs in order of decreasing cost
+//! \details The cost of a test is its run time measured by a previous run with
+//!   the same RNG, read from the test cost file. If a test has not been
+//!   measured with an RNG, its cost is estimated as the mean of its cost with
+//!   the other RNGs, or if it has not been measured at all, as the mean cost
+//!   of all tests measured, or one if no test has been measured. The tests are
+//!   then placed by the longest-processing-time-first rule: in order of
+//!   decreasing cost, each test is placed on the PE with the least total cost
+//!   placed so far. The tests of all RNGs are ordered together, so the shorter
+//!   tests of one RNG fill up the PEs left idle by the longer tests of another.
+//!   Since the tests are also run in order of decreasing cost, see names(),
+//!   every PE starts with its longest test.
+// *****************************************************************************
+{
+  readCost();
+
+  const auto ntot = m_ctrs.size();
+  const auto n = ntest();
+
+  // Look up measured costs
+  std::vector< tk::real > sum( n, 0.0 );
+  std::vector< std::size_t > cnt( n, 0 );
+  std::vector< char > measured( ntot, 0 );
+  m_cost.assign( ntot, 0.0 );
+  for (std::size_t i=0; i<ntot; ++i) {
+    auto it = m_model.find( costKey(i) );
+    if (it != end(m_model)) {
+      m_cost[i] = it->second;
+      measured[i] = 1;
+      sum[ i%n ] += it->second;
+      ++cnt[ i%n ];
+    }
+  }
+
+  // Estimate costs of tests not measured
+  auto total = std::accumulate( begin(sum), end(sum), 0.0 );
+  auto count = std::accumulate( begin(cnt), end(cnt), std::size_t(0) );
+  auto mean = count ? total / static_cast< tk::real >( count ) : 1.0;
+  for (std::size_t i=0; i<ntot; ++i)
+    if (!measured[i])
+      m_cost[i] = cnt[i%n] ? sum[i%n] / static_cast< tk::real >( cnt[i%n] )
+                           : mean;
+
+  // Order tests by decreasing cost, keeping the default order for equal costs
+  m_order.resize( ntot );
+  std::iota( begin(m_order), end(m_order), 0 );
+  std::stable_sort( begin(m_order), end(m_order),
+    [&]( std::size_t a, std::size_t b ){ return m_cost[a] > m_cost[b]; } );
+
+  // Place tests on the least loaded PE, longest first
+  std::vector< tk::real > load( static_cast< std::size_t >( CkNumPes() ), 0.0 );
+  std::vector< int > pe( ntot, 0 );
+  for (auto i : m_order) {
+    auto p = std::min_element( begin(load), end(load) ) - begin(load);
+    load[ static_cast< std::size_t >( p ) ] += m_cost[i];
+    pe[i] = static_cast< int >( p );
+  }
+
+  // Construct all tests and store handles
+  for (std::size_t i=0; i<ntot; ++i) m_tests.emplace_back( m_ctrs[i]( pe[i] ) );
+}
+
+void
+TestU01Suite::readCost()
+// *****************************************************************************
+// Read test costs measured by a previous run
+//! \details The test cost file is optional, and if it does not exist yet, all
+//!   tests are assumed to have the same cost. Each line of the file contains
+//!   the battery name, the index of the test within the battery, the measured
+//!   run time in seconds, and the RNG name.
+// *****************************************************************************
+{
+  const auto& file = g_inputdeck.get< tag::cmd, tag::io, tag::costmodel >();
+  if (file.empty()) return;
+
+  std::ifstream f( file, std::ifstream::in );
+  if (!f.good()) return;
+
+  std::string battery, rng;
+  std::size_t t = 0;
+  tk::real c = 0.0;
+  while (f >> battery >> t >> c && std::getline( f >> std::ws, rng ))
+    m_model[ std::make_tuple( battery, t, rng ) ] = c;
+}
+
+void
+TestU01Suite::writeCost() const
+// *****************************************************************************
+// Write test costs measured
+//! \details Costs in the file not measured by this run, e.g., those of other
+//!   batteries or RNGs, are kept. See readCost() for the file format.
+// *****************************************************************************
+{
+  const auto& file = g_inputdeck.get< tag::cmd, tag::io, tag::costmodel >();
+  if (file.empty()) return;
+
+  tk::Writer w( file );
+  auto& os = w.stream();
+  os << std::setprecision( 6 );
+  for (const auto& m : m_model)
+    os << std::get<0>(m.first) << ' ' << std::get<1>(m.first) << ' '
+       << m.second << ' ' << std::get<2>(m.first) << '\n';
+}
+
 #include "NoWarning/testu01suite.def.h"
@@ -16,6 +16,7 @@
 
 #include <vector>
 #include <map>
+#include <tuple>
 #include <utility>
 #include <functional>
 #include <iosfwd>
@@ -73,18 +74,30 @@ class TestU01Suite : public CBase_TestU01Suite {
     //! Evaluate a statistical test
     void evaluate( std::vector< std::vector< std::string > > status );
 
-    //! Collect test run time from a test
-    void time( std::pair< std::string, tk::real > t );
+    //! Collect test run time and generator throughput from a test
+    void time( std::size_t id,
+               std::pair< std::string, tk::real > t,
+               uint64_t ngen,
+               tk::real tgen );
 
  private:
-    std::vector< std::function< StatTest() > > m_ctrs; //! Tests constructors
+    std::vector< std::function< StatTest(int) > > m_ctrs; //! Tests ctors
     std::vector< StatTest > m_tests;   //!< Constructed statistical tests
+    std::vector< tk::real > m_cost;    //!< Estimated cost of each test
+    //! Test indices in decreasing order of estimated cost
+    std::vector< std::size_t > m_order;
+    //! \brief Test costs read from and written to the test cost file, keyed by
+    //!   battery name, test index within the battery, and RNG name
+    std::map< std::tuple< std::string, std::size_t, std::string >, tk::real >
+      m_model;
     std::string m_name;                //!< Test suite name
     std::size_t m_npval;               //!< Number of results from all tests
     std::size_t m_ncomplete;           //!< Number of completed tests
     std::size_t m_ntest;               //!< Number of tests info received from
     std::map< std::string, std::size_t > m_nfail; //! Number of failed tests/RNG
     std::map< std::string, tk::real > m_time;     //!< Measured time/RNG
+    //! Number of random numbers generated and time spent generating them/RNG
+    std::map< std::string, std::pair< uint64_t, tk::real > > m_gen;
 
     //! Information bundle for a failed test
     struct Failed {
@@ -111,6 +124,19 @@ class TestU01Suite : public CBase_TestU01Suite {
     //! Return number of statistical tests
     std::size_t ntest() const;
 
+    //! Return the key of a test in the test cost model
+    std::tuple< std::string, std::size_t, std::string >
+    costKey( std::size_t i ) const;
+
+    //! Construct all tests distributed across PEs in order of decreasing cost
+    void schedule();
+
+    //! Read test costs measured by a previous run
+    void readCost();
+
+    //! Write test costs measured
+    void writeCost() const;
+
     //! Output final assessment
     void assess();
 
@@ -15,13 +15,73 @@
 #define TestU01Wrappers_h
 
 #include <map>
+#include <vector>
+#include <cstdint>
 
 #include "RNG.hpp"
+#include "Timer.hpp"
+#include "Exception.hpp"
 
 namespace rngtest {
 
 extern std::map< tk::ctr::RawRNGType, tk::RNG > g_rng;
 
+//! Number of random numbers generated at a time for the TestU01 wrappers
+const std::size_t TESTU01_BUFFER_SIZE = 1UL << 14;
+
+//! Statistics on generating random numbers for the TestU01 wrappers on a PE
+struct TestU01GenStat {
+  uint64_t ngen = 0;    //!< Number of random numbers generated
+  tk::real tgen = 0.0;  //!< Time spent generating them in seconds
+};
+
+inline TestU01GenStat& testU01GenStat()
+// *****************************************************************************
+//  Access statistics on generating random numbers for TestU01 on this PE
+//! \details The statistics are thread-local, i.e., there is one per PE. A
+//!   statistical test runs to completion within a single entry method, so the
+//!   difference of the statistics before and after running a test on a PE
+//!   belongs to that test.
+//! \return Reference to statistics on generating random numbers on this PE
+// *****************************************************************************
+{
+  thread_local TestU01GenStat stat;
+  return stat;
+}
+
+template< tk::ctr::RawRNGType id >
+inline double buffered()
+// *****************************************************************************
+//  Return the next uniform random number from the buffer of an RNG on this PE
+//! \details TestU01 draws random numbers one at a time. Instead of looking up
+//!   the RNG and calling it for every number, a buffer of TESTU01_BUFFER_SIZE
+//!   numbers is refilled by a single call to tk::RNG::uniform() whenever it is
+//!   exhausted. The buffer is thread-local, i.e., there is one per RNG and PE,
+//!   and the numbers are generated from the stream of the PE. For generators
+//!   whose sequence does not depend on how many numbers are requested per
+//!   call, the numbers served are thus the same as if they were generated one
+//!   by one.
+//! \return Random number generated as a double-precision floating point value
+// *****************************************************************************
+{
+  thread_local std::vector< double > buf;
+  thread_local std::size_t pos = 0;
+
+  if (pos == buf.size()) {
+    const auto rng = g_rng.find( id );
+    if (rng == end(g_rng)) Throw( "RNG not found" );
+    buf.resize( TESTU01_BUFFER_SIZE );
+    tk::Timer timer;
+    rng->second.uniform( CkMyPe(), buf.size(), buf.data() );
+    auto& stat = testU01GenStat();
+    stat.tgen += timer.dsec();
+    stat.ngen += buf.size();
+    pos = 0;
+  }
+
+  return buf[ pos++ ];
+}
+
 template< tk::ctr::RawRNGType id >
 static inline double uniform( void*, void* )
 // *****************************************************************************
@@ -36,13 +96,7 @@ static inline double uniform( void*, void* )
 //! \return Random number generated as a double-precision floating point value
 // *****************************************************************************
 {
-  double r = 0.0;
-  const auto rng = g_rng.find( id );
-  if (rng != end(g_rng))
-    rng->second.uniform( CkMyPe(), 1, &r );
-  else
-    Throw( "RNG not found" );
-  return r;
+  return buffered< id >();
 }
 
 template< tk::ctr::RawRNGType id >
@@ -59,13 +113,7 @@ static inline unsigned long uniform_bits( void*, void* )
 //! \return Random number generated as a unsigned long integer value
 // *****************************************************************************
 {
-  double r = 0.0;
-  const auto rng = g_rng.find( id );
-  if (rng != end(g_rng))
-    rng->second.uniform( CkMyPe(), 1, &r );
-  else
-    Throw( "RNG not found" );
-  return static_cast<unsigned long>(r * unif01_NORM32);
+  return static_cast<unsigned long>( buffered< id >() * unif01_NORM32 );
 }
 
 template< tk::ctr::RawRNGType id >
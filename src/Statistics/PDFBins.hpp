@@ -0,0 +1,111 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/PDFBins.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Dense bin layout helpers for the PDF estimators
+  \details   Dense bin layout helpers for the PDF estimators. If the extents of
+    the sample space of a PDF are known, e.g., specified by the user, the PDF
+    estimators, tk::UniPDF, tk::BiPDF, and tk::TriPDF, count samples falling
+    inside the extents in a contiguous array instead of a hash map. The
+    functions here compute the layout of the dense array and convert between
+    bin ids and array indices. Samples outside of the extents are still
+    counted in the hash map.
+*/
+// *****************************************************************************
+#ifndef PDFBins_h
+#define PDFBins_h
+
+#include <array>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! Maximum number of bins of a dense PDF, above which only the map is used
+const std::size_t maxDenseBins = 1UL << 18;
+
+//! Compute dense bin layout of a PDF given its sample space extents
+//! \tparam D Number of sample space dimensions
+//! \param[in] bs Sample space bin sizes
+//! \param[in] ext Sample space extents, {xmin,xmax,ymin,ymax,...}, may be
+//!   empty if the extents are not known
+//! \param[out] lo Lowest bin id in each sample space dimension
+//! \param[out] nbi Number of bins in each sample space dimension
+//! \return Total number of dense bins, zero if dense storage is not used, in
+//!   which case nbi is also zeroed
+template< std::size_t D >
+std::size_t denseBins( const std::array< tk::real, D >& bs,
+                       const std::vector< tk::real >& ext,
+                       std::array< long, D >& lo,
+                       std::array< long, D >& nbi )
+{
+  lo.fill( 0 );
+  nbi.fill( 0 );
+  if (ext.size() != 2*D) return 0;
+
+  std::size_t n = 1;
+  for (std::size_t d=0; d<D; ++d) {
+    lo[d] = std::lround( ext[2*d] / bs[d] );
+    nbi[d] = std::lround( ext[2*d+1] / bs[d] ) - lo[d] + 1;
+    if (nbi[d] <= 0 ||
+        static_cast< std::size_t >( nbi[d] ) > maxDenseBins / n)
+    {
+      lo.fill( 0 );
+      nbi.fill( 0 );
+      return 0;
+    }
+    n *= static_cast< std::size_t >( nbi[d] );
+  }
+  return n;
+}
+
+//! Compute dense array index of a bin
+//! \tparam D Number of sample space dimensions
+//! \param[in] bin Bin ids in all sample space dimensions
+//! \param[in] lo Lowest bin id of dense storage in each dimension
+//! \param[in] nbi Number of bins of dense storage in each dimension
+//! \return Index into the dense array (row-major), -1 if the bin is outside of
+//!   the dense storage
+template< std::size_t D >
+long denseIndex( const std::array< long, D >& bin,
+                 const std::array< long, D >& lo,
+                 const std::array< long, D >& nbi )
+{
+  long i = 0;
+  for (std::size_t d=0; d<D; ++d) {
+    auto b = bin[d] - lo[d];
+    if (b < 0 || b >= nbi[d]) return -1;
+    i = i*nbi[d] + b;
+  }
+  return i;
+}
+
+//! Compute bin ids of a dense array index
+//! \tparam D Number of sample space dimensions
+//! \param[in] i Index into the dense array
+//! \param[in] lo Lowest bin id of dense storage in each dimension
+//! \param[in] nbi Number of bins of dense storage in each dimension
+//! \return Bin ids in all sample space dimensions
+template< std::size_t D >
+std::array< long, D > denseKey( std::size_t i,
+                                const std::array< long, D >& lo,
+                                const std::array< long, D >& nbi )
+{
+  std::array< long, D > bin;
+  auto j = static_cast< long >( i );
+  for (std::size_t d=D; d-->0; ) {
+    bin[d] = lo[d] + j % nbi[d];
+    j /= nbi[d];
+  }
+  return bin;
+}
+
+} // tk::
+
+#endif // PDFBins_h
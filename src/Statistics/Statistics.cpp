@@ -16,6 +16,7 @@
 // *****************************************************************************
 
 #include <map>
+#include <array>
 #include <iterator>
 #include <utility>
 #include <algorithm>
@@ -38,16 +39,19 @@ Statistics::Statistics( const tk::Particles& particles,
                         const ctr::OffsetMap& offset,
                         const std::vector< ctr::Product >& stat,
                         const std::vector< ctr::Probability >& pdf,
-                        const std::vector< std::vector< tk::real > >& binsize )
+                        const std::vector< std::vector< tk::real > >& binsize,
+                        const std::vector< std::vector< tk::real > >& extent )
   : m_particles( particles ),
     m_instOrd(),
     m_ordinary(),
     m_ordTerm(),
+    m_ordProduct(),
     m_nord( 0 ),
     m_instCen(),
-    m_central(),
-    m_ctr(),
     m_ncen( 0 ),
+    m_shift(),
+    m_shiftCen(),
+    m_censum(),
     m_instOrdUniPDF(),
     m_ordupdf(),
     m_instCenUniPDF(),
@@ -70,12 +74,14 @@ Statistics::Statistics( const tk::Particles& particles,
 //! \param[in] stat List of requested statistical moments
 //! \param[in] pdf List of requested probability density functions (PDF)
 //! \param[in] binsize List of binsize vectors configuring the PDF estimators
+//! \param[in] extent List of sample space extents configuring the PDF
+//!   estimators, empty vectors for PDFs whose extents are not known
 // *****************************************************************************
 {
   // Prepare for computing ordinary and central moments, PDFs
   setupOrdinary( offset, stat );
   setupCentral( offset, stat );
-  setupPDF( offset, pdf, binsize );
+  setupPDF( offset, pdf, binsize, extent );
 }
 
 void
@@ -105,6 +111,8 @@ Statistics::setupOrdinary( const ctr::OffsetMap& offset,
         ++i;
       }
 
+      m_ordProduct.push_back( product );
+
       // Increase number of ordinary moments by one
       m_ordinary.push_back( 0.0 );
       // Count up orindary moments
@@ -133,26 +141,29 @@ Statistics::setupCentral( const ctr::OffsetMap& offset,
 //! \param[in] stat List of requested statistical moments
 // *****************************************************************************
 {
+  // Storage for shifts, +1 for zero shift for ordinary terms, allocated
+  // before taking addresses into it
+  m_shift.resize( m_nord + 1, 0.0 );
+  m_censum.resize( ncensum( stat ), 0.0 );
+
   // Central moments can only be estimated about ordinary moments
   if (m_nord)
     for (const auto& product : stat) {
       if (central(product)) {
 
         m_instCen.emplace_back( std::vector< const tk::real* >() );
-        m_ctr.emplace_back( std::vector< const tk::real* >() );
+        m_shiftCen.emplace_back( std::vector< const tk::real* >() );
 
         for (const auto& term : product) {
           auto o = offset.find( term.var );
           Assert( o != end( offset ), "No such depvar" );
           // Put in starting address of instantaneous variable
           m_instCen.back().push_back( m_particles.cptr(term.field, o->second) );
-          // Put in index of center for central, m_nord for ordinary moment
-          m_ctr.back().push_back(
-           m_ordinary.data() + (std::islower(term.var) ? mean(term) : m_nord) );
+          // Put in index of shift, m_nord for ordinary moment (zero shift)
+          m_shiftCen.back().push_back(
+           m_shift.data() + (std::islower(term.var) ? mean(term) : m_nord) );
         }
 
-        // Increase number of central moments by one
-        m_central.push_back( 0.0 );
         // Count up central moments
         ++m_ncen;
       }
@@ -162,28 +173,38 @@ Statistics::setupCentral( const ctr::OffsetMap& offset,
 void
 Statistics::setupPDF( const ctr::OffsetMap& offset,
                       const std::vector< ctr::Probability >& pdf,
-                      const std::vector< std::vector< tk::real > >& binsize )
+                      const std::vector< std::vector< tk::real > >& binsize,
+                      const std::vector< std::vector< tk::real > >& extent )
 // *****************************************************************************
 //  Prepare for computing PDFs
 //! \param[in] offset Map of offsets in memory to address variable fields
 //! \param[in] pdf List of requested probability density functions (PDF)
 //! \param[in] binsize List of binsize vectors configuring the PDF estimators
+//! \param[in] extent List of sample space extents configuring the PDF
+//!   estimators, empty vectors for PDFs whose extents are not known
+//! \details If the sample space extents of a PDF are known, its estimator
+//!   counts samples inside the extents in dense storage, see PDFBins.hpp.
 // *****************************************************************************
 {
+  Assert( extent.empty() || extent.size() == binsize.size(),
+          "Number of PDF extents and bin sizes must equal" );
+
   std::size_t i = 0;
   for (const auto& probability : pdf) {
+    const auto& ext =
+      extent.empty() ? std::vector< tk::real >() : extent[i];
     if (ordinary(probability)) {
 
       // Detect number of sample space dimensions and create ordinary PDFs
       const auto& bs = binsize[i++];
       if (bs.size() == 1) {
-        m_ordupdf.emplace_back( bs[0] );
+        m_ordupdf.emplace_back( bs[0], ext );
         m_instOrdUniPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 2) {
-        m_ordbpdf.emplace_back( bs );
+        m_ordbpdf.emplace_back( bs, ext );
         m_instOrdBiPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 3) {
-        m_ordtpdf.emplace_back( bs );
+        m_ordtpdf.emplace_back( bs, ext );
         m_instOrdTriPDF.emplace_back( std::vector< const tk::real* >() );
       }
 
@@ -204,15 +225,15 @@ Statistics::setupPDF( const ctr::OffsetMap& offset,
       // storage for center pointer
       const auto& bs = binsize[i++];
       if (bs.size() == 1) {
-        m_cenupdf.emplace_back( bs[0] );
+        m_cenupdf.emplace_back( bs[0], ext );
         m_instCenUniPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrUniPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 2) {
-        m_cenbpdf.emplace_back( bs );
+        m_cenbpdf.emplace_back( bs, ext );
         m_instCenBiPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrBiPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 3) {
-        m_centpdf.emplace_back( bs );
+        m_centpdf.emplace_back( bs, ext );
         m_instCenTriPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrTriPDF.emplace_back( std::vector< const tk::real* >() );
       }
@@ -260,30 +281,68 @@ Statistics::mean( const tk::ctr::Term& term ) const
 }
 
 void
-Statistics::accumulateOrd()
+Statistics::accumulate( const std::map< ctr::Product, tk::real >& moments )
 // *****************************************************************************
-//  Accumulate (i.e., only do the sum for) ordinary moments
+//  Accumulate (i.e., only do the sum for) ordinary moments and shifted sums for
+//  central moments in a single pass
+//! \param[in] moments Map of statistical moments estimated in the previous time
+//!   step whose means are used as shifts
+//! \details Instead of summing products of fluctuations about the means, which
+//!   requires the means to be known before the sweep over the particles, the
+//!   products of the variables shifted by the means of the previous time step
+//!   are summed over all nonempty subsets of the terms of each central moment.
+//!   Since all PEs use the same shifts, these are partial sums that can be
+//!   merged by summation, just like the ordinary moments. Once the means are
+//!   known, central() expands the central moments in terms of the shifted
+//!   sums. Since the shifts are close to the means, the expansion does not
+//!   suffer from the catastrophic cancellation of expanding about zero, i.e.,
+//!   computing central moments from ordinary ones.
 // *****************************************************************************
 {
   fenv_t fe;
   feholdexcept( &fe );
 
   if (m_nord) {
-    // Zero ordinary moment accumulators
+    // Zero ordinary moment accumulators and shifted sums
     std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
+    std::fill( begin(m_censum), end(m_censum), 0.0 );
+
+    // Update shifts in place, since m_shiftCen points into m_shift
+    auto sh = shift( m_ordProduct, moments );
+    std::copy( begin(sh), end(sh), begin(m_shift) );
+
+    // Products of shifted terms for all subsets of terms of a central moment
+    std::vector< tk::real > sub;
 
-    // Accumulate sum for ordinary moments. This is a partial sum, so no
-    // division by the number of samples.
     const auto npar = m_particles.nunk();
     for (auto p=decltype(npar){0}; p<npar; ++p) {
+      // Accumulate sum for ordinary moments
       for (std::size_t i=0; i<m_nord; ++i) {
-       auto prod = m_particles.var( m_instOrd[i][0], p );
+        auto prod = m_particles.var( m_instOrd[i][0], p );
         const auto s = m_instOrd[i].size();
         for (auto j=decltype(s){1}; j<s; ++j) {
           prod *= m_particles.var( m_instOrd[i][j], p );
         }
         m_ordinary[i] += prod;
       }
+      // Accumulate shifted sums for central moments: the product of subset
+      // 'mask' is the product of subset 'mask' without its lowest term times
+      // the lowest term
+      std::size_t k = 0;
+      for (std::size_t i=0; i<m_ncen; ++i) {
+        const auto& inst = m_instCen[i];
+        const auto& shf = m_shiftCen[i];
+        std::size_t nsub = 1UL << inst.size();
+        sub.resize( nsub );
+        sub[0] = 1.0;
+        for (std::size_t mask=1; mask<nsub; ++mask) {
+          std::size_t j = 0;
+          while (!(mask & (1UL << j))) ++j;
+          sub[mask] = sub[ mask & (mask-1) ] *
+                      (m_particles.var( inst[j], p ) - *(shf[j]));
+          m_censum[k++] += sub[mask];
+        }
+      }
     }
   }
 
@@ -291,47 +350,111 @@ Statistics::accumulateOrd()
   feupdateenv( &fe );
 }
 
-void
-Statistics::accumulateCen( const std::vector< tk::real >& om )
+std::size_t
+Statistics::ncensum( const std::vector< ctr::Product >& stat )
 // *****************************************************************************
-//  Accumulate (i.e., only do the sum for) central moments
-//! \details The ordinary moments container, m_ordinary, is overwritten here
-//!   with the argument om, because each of multiple Statistics class objects
-//!   (residing on different PEs) only collect their partial sums when
-//!   accumulateOrd() is run. By the time the accumulation of the central
-//!   moments is started, the ordinary moments have been collected from all
-//!   PEs and thus are the same to be passed here on all PEs. For example
-//!   client-code, see walker::Distributor.
-//! \param[in] om Ordinary moments
+//  Number of shifted sums required to estimate the central moments
+//! \param[in] stat List of requested statistical moments
+//! \return Total number of nonempty subsets of the terms of all central moments
 // *****************************************************************************
 {
-  if (m_ncen) {
-    // Overwrite ordinary moments by those computed across all PEs
-    for (std::size_t i=0; i<om.size(); ++i) m_ordinary[i] = om[i];
+  std::size_t n = 0;
+  if (std::any_of( begin(stat), end(stat),
+                   []( const ctr::Product& p ){ return ordinary(p); } ))
+    for (const auto& product : stat)
+      if (central(product)) n += (1UL << product.size()) - 1;
+  return n;
+}
 
-    // Zero central moment accumulators
-    std::fill( begin(m_central), end(m_central), 0.0 );
+std::vector< tk::real >
+Statistics::shift( const std::vector< ctr::Product >& stat,
+                   const std::map< ctr::Product, tk::real >& moments )
+// *****************************************************************************
+//  Compute shifts about which central moments are accumulated
+//! \param[in] stat List of requested statistical moments
+//! \param[in] moments Map of statistical moments, e.g., estimated in the
+//!   previous time step, empty if not yet estimated
+//! \return Shift for each ordinary moment (zero if the moment is not yet
+//!   available) and a trailing zero used as the shift for ordinary terms
+// *****************************************************************************
+{
+  std::vector< tk::real > sh;
+  for (const auto& product : stat)
+    if (ordinary(product)) {
+      auto m = moments.find( product );
+      sh.push_back( m != end(moments) ? m->second : 0.0 );
+    }
+  sh.push_back( 0.0 );
+  return sh;
+}
 
-    // Accumulate sum for central moments. This is a partial sum, so no division
-    // by the number of samples.
-    const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      for (std::size_t i=0; i<m_ncen; ++i) {
-        auto prod = m_particles.var( m_instCen[i][0], p ) - *(m_ctr[i][0]);
-        const auto s = m_instCen[i].size();
-        for (auto j=decltype(s){1}; j<s; ++j) {
-          prod *= m_particles.var( m_instCen[i][j], p ) - *(m_ctr[i][j]);
-        }
-        m_central[i] += prod;
+std::vector< tk::real >
+Statistics::central( const std::vector< ctr::Product >& stat,
+                     const std::vector< tk::real >& ord,
+                     const std::vector< tk::real >& shift,
+                     const std::vector< tk::real >& censum )
+// *****************************************************************************
+//  Estimate central moments from means and shifted sums
+//! \param[in] stat List of requested statistical moments
+//! \param[in] ord Ordinary moments (estimated across all PEs)
+//! \param[in] shift Shifts used to accumulate the shifted sums, see shift()
+//! \param[in] censum Shifted sums (collected across all PEs and divided by the
+//!   number of samples), see accumulate()
+//! \return Central moments in the order requested
+//! \details With the deviations of the means from the shifts, d = <X>-K, the
+//!   central moment of the product of the terms (X-<X>) = (X-K)-d is expanded
+//!   into the sum over all subsets S of the terms of the product of the
+//!   shifted sums over S and the negative deviations of the terms not in S.
+//!   Ordinary terms of central moments have zero shift and zero mean, thus
+//!   zero deviation.
+// *****************************************************************************
+{
+  // Collect first terms of ordinary moments to find means for fluctuations, the
+  // same way as mean() does
+  std::vector< ctr::Term > ordterm;
+  for (const auto& product : stat)
+    if (ordinary(product)) ordterm.push_back( product[0] );
+  auto nord = ordterm.size();
+
+  std::vector< tk::real > cen;
+  if (!nord) return cen;
+
+  std::size_t k = 0;
+  for (const auto& product : stat) {
+    if (central(product)) {
+      // Deviations of means from shifts of all terms
+      std::vector< tk::real > d;
+      for (const auto& term : product) {
+        auto m = nord;
+        if (std::islower(term.var))
+          for (std::size_t i=0; i<nord; ++i)
+            if (ordterm[i].var == std::toupper(term.var) &&
+                ordterm[i].field == term.field) { m = i; break; }
+        d.push_back( m < nord ? ord[m] - shift[m] : 0.0 );
       }
+      // Expand central moment in terms of shifted sums
+      std::size_t nsub = 1UL << product.size();
+      tk::real c = 0.0;
+      for (std::size_t mask=0; mask<nsub; ++mask) {
+        auto t = mask ? censum[ k + mask - 1 ] : 1.0;
+        for (std::size_t j=0; j<product.size(); ++j)
+          if (!(mask & (1UL << j))) t *= -d[j];
+        c += t;
+      }
+      cen.push_back( c );
+      k += nsub - 1;
     }
   }
+
+  return cen;
 }
 
 void
 Statistics::accumulateOrdPDF()
 // *****************************************************************************
 //  Accumulate (i.e., only do the sum for) ordinary PDFs
+//! \details The loop over the particles is the inner loop so that each PDF
+//!   bins all particles in one go, keeping its (dense) bins in cache.
 // *****************************************************************************
 {
   if (!m_ordupdf.empty() || !m_ordbpdf.empty() || !m_ordtpdf.empty()) {
@@ -342,27 +465,29 @@ Statistics::accumulateOrdPDF()
 
     // Accumulate partial sum for PDFs
     const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      std::size_t i = 0;
-      // Accumulate partial sum for univariate PDFs
-      for (auto& pdf : m_ordupdf) {
-        pdf.add( m_particles.var( m_instOrdUniPDF[i++][0], p ) );
-      }
-      // Accumulate partial sum for bivariate PDFs
-      i = 0;
-      for (auto& pdf : m_ordbpdf) {
-        const auto inst = m_instOrdBiPDF[i++];
-        pdf.add( {{ m_particles.var( inst[0], p ),
-                    m_particles.var( inst[1], p ) }} );
-      }
-      // Accumulate partial sum for trivariate PDFs
-      i = 0;
-      for (auto& pdf : m_ordtpdf) {
-        const auto inst = m_instOrdTriPDF[i++];
-        pdf.add( {{ m_particles.var( inst[0], p ),
-                    m_particles.var( inst[1], p ),
-                    m_particles.var( inst[2], p ) }} );
-      }
+    std::size_t i = 0;
+    // Accumulate partial sum for univariate PDFs
+    for (auto& pdf : m_ordupdf) {
+      const auto inst = m_instOrdUniPDF[i++][0];
+      pdf.add( npar, [&]( std::size_t p ){
+        return m_particles.var( inst, p ); } );
+    }
+    // Accumulate partial sum for bivariate PDFs
+    i = 0;
+    for (auto& pdf : m_ordbpdf) {
+      const auto& inst = m_instOrdBiPDF[i++];
+      pdf.add( npar, [&]( std::size_t p ){
+        return std::array< tk::real, 2 >{{ m_particles.var( inst[0], p ),
+                                           m_particles.var( inst[1], p ) }}; } );
+    }
+    // Accumulate partial sum for trivariate PDFs
+    i = 0;
+    for (auto& pdf : m_ordtpdf) {
+      const auto& inst = m_instOrdTriPDF[i++];
+      pdf.add( npar, [&]( std::size_t p ){
+        return std::array< tk::real, 3 >{{ m_particles.var( inst[0], p ),
+                                           m_particles.var( inst[1], p ),
+                                           m_particles.var( inst[2], p ) }}; } );
     }
   }
 }
@@ -374,7 +499,7 @@ Statistics::accumulateCenPDF( const std::vector< tk::real >& om )
 //! \details The ordinary moments container, m_ordinary, is overwritten here
 //!   with the argument om, because each of multiple Statistics class objects
 //!   (residing on different PEs) only collect their partial sums when
-//!   accumulateOrd() is run. By the time the accumulation of the central
+//!   accumulate() is run. By the time the accumulation of the central
 //!   PDFs is started, the ordinary moments have been collected from all
 //!   PEs and thus are the same to be passed here on all PEs. For example
 //!   client-code, see walker::Distributor.
@@ -392,33 +517,40 @@ Statistics::accumulateCenPDF( const std::vector< tk::real >& om )
 
     // Accumulate partial sum for PDFs
     const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      std::size_t i = 0;
-      // Accumulate partial sum for univariate PDFs
-      for (auto& pdf : m_cenupdf) {
-        pdf.add(
-          m_particles.var( m_instCenUniPDF[i][0], p ) - *(m_ctrUniPDF[i][0]) );
-        ++i;
-      }
-      // Accumulate partial sum for bivariate PDFs
-      i = 0;
-      for (auto& pdf : m_cenbpdf) {
-        const auto& inst = m_instCenBiPDF[i];
-        const auto& cen = m_ctrBiPDF[i];
-        pdf.add( {{ m_particles.var( inst[0], p ) - *(cen[0]),
-                    m_particles.var( inst[1], p ) - *(cen[1]) }} );
-        ++i;
-      }
-      // Accumulate partial sum for trivariate PDFs
-      i = 0;
-      for (auto& pdf : m_centpdf) {
-        const auto inst = m_instCenTriPDF[i];
-        const auto& cen = m_ctrTriPDF[i];
-        pdf.add( {{ m_particles.var( inst[0], p ) - *(cen[0]),
-                    m_particles.var( inst[1], p ) - *(cen[1]),
-                    m_particles.var( inst[2], p ) - *(cen[2]) }} );
-        ++i;
-      }
+    std::size_t i = 0;
+    // Accumulate partial sum for univariate PDFs
+    for (auto& pdf : m_cenupdf) {
+      const auto inst = m_instCenUniPDF[i][0];
+      const auto cen = *(m_ctrUniPDF[i][0]);
+      pdf.add( npar, [&]( std::size_t p ){
+        return m_particles.var( inst, p ) - cen; } );
+      ++i;
+    }
+    // Accumulate partial sum for bivariate PDFs
+    i = 0;
+    for (auto& pdf : m_cenbpdf) {
+      const auto& inst = m_instCenBiPDF[i];
+      const std::array< tk::real, 2 > cen{{ *(m_ctrBiPDF[i][0]),
+                                            *(m_ctrBiPDF[i][1]) }};
+      pdf.add( npar, [&]( std::size_t p ){
+        return std::array< tk::real, 2 >{{
+                 m_particles.var( inst[0], p ) - cen[0],
+                 m_particles.var( inst[1], p ) - cen[1] }}; } );
+      ++i;
+    }
+    // Accumulate partial sum for trivariate PDFs
+    i = 0;
+    for (auto& pdf : m_centpdf) {
+      const auto& inst = m_instCenTriPDF[i];
+      const std::array< tk::real, 3 > cen{{ *(m_ctrTriPDF[i][0]),
+                                            *(m_ctrTriPDF[i][1]),
+                                            *(m_ctrTriPDF[i][2]) }};
+      pdf.add( npar, [&]( std::size_t p ){
+        return std::array< tk::real, 3 >{{
+                 m_particles.var( inst[0], p ) - cen[0],
+                 m_particles.var( inst[1], p ) - cen[1],
+                 m_particles.var( inst[2], p ) - cen[2] }}; } );
+      ++i;
     }
   }
 }
@@ -64,6 +64,7 @@
 #define Statistics_h
 
 #include <vector>
+#include <map>
 #include <cstddef>
 
 #include "Types.hpp"
@@ -85,13 +86,27 @@ class Statistics {
                          const ctr::OffsetMap& offset,
                          const std::vector< ctr::Product >& stat,
                          const std::vector< ctr::Probability >& pdf,
-                         const std::vector< std::vector< tk::real > >& binsize );
+                         const std::vector< std::vector< tk::real > >& binsize,
+                         const std::vector< std::vector< tk::real > >& extent );
 
-    //! Accumulate (i.e., only do the sum for) ordinary moments
-    void accumulateOrd();
+    //! \brief Accumulate (i.e., only do the sum for) ordinary moments and
+    //!   shifted sums for central moments in a single pass
+    void accumulate( const std::map< ctr::Product, tk::real >& moments );
 
-    //! Accumulate (i.e., only do the sum for) central moments
-    void accumulateCen( const std::vector< tk::real >& om );
+    //! Number of shifted sums required to estimate the central moments
+    static std::size_t ncensum( const std::vector< ctr::Product >& stat );
+
+    //! Compute shifts about which central moments are accumulated
+    static std::vector< tk::real >
+    shift( const std::vector< ctr::Product >& stat,
+           const std::map< ctr::Product, tk::real >& moments );
+
+    //! Estimate central moments from means and shifted sums
+    static std::vector< tk::real >
+    central( const std::vector< ctr::Product >& stat,
+             const std::vector< tk::real >& ord,
+             const std::vector< tk::real >& shift,
+             const std::vector< tk::real >& censum );
 
     //! Accumulate (i.e., only do the sum for) ordinary PDFs
     void accumulateOrdPDF();
@@ -102,8 +117,8 @@ class Statistics {
     //! Ordinary moments accessor
     const std::vector< tk::real >& ord() const noexcept { return m_ordinary; }
 
-    //! Central moments accessor
-    const std::vector< tk::real >& ctr() const noexcept { return m_central; }
+    //! Shifted sums for central moments accessor
+    const std::vector< tk::real >& censum() const noexcept { return m_censum; }
 
     //! Ordinary univariate PDFs accessor
     const std::vector< tk::UniPDF >& oupdf() const noexcept { return m_ordupdf; }
@@ -137,7 +152,8 @@ class Statistics {
     //! Setup PDFs
     void setupPDF( const ctr::OffsetMap& offset,
                    const std::vector< ctr::Probability >& pdf,
-                   const std::vector< std::vector< tk::real > >& binsize  );
+                   const std::vector< std::vector< tk::real > >& binsize,
+                   const std::vector< std::vector< tk::real > >& extent );
     ///@}
 
     //! Return mean for fluctuation
@@ -154,17 +170,22 @@ class Statistics {
     std::vector< tk::real > m_ordinary;
     //! Ordinary moment Terms, used to find means for fluctuations
     std::vector< tk::ctr::Term > m_ordTerm;
+    //! Ordinary moment products, used to look up shifts
+    std::vector< tk::ctr::Product > m_ordProduct;
     //! Number of ordinary moments
     std::size_t m_nord;
 
     //! Instantaneous variable pointers for computing central moments
     std::vector< std::vector< const tk::real* > > m_instCen;
-    //! Central moments
-    std::vector< tk::real > m_central;
-    //! Ordinary moments about which to compute central moments
-    std::vector< std::vector< const tk::real* > > m_ctr;
     //! Number of central moments
     std::size_t m_ncen;
+    //! Shifts (lagged means) about which shifted sums are accumulated
+    std::vector< tk::real > m_shift;
+    //! Shifts for each term of central moments pointing into m_shift
+    std::vector< std::vector< const tk::real* > > m_shiftCen;
+    //! \brief Sums of products of shifted variables over all nonempty subsets
+    //!   of the terms of all central moments
+    std::vector< tk::real > m_censum;
     ///@}
 
     /** @name Data for univariate probability density function estimation */
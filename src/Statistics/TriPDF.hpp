@@ -10,18 +10,23 @@
     a joint probability density function (PDF) of three scalar variables from an
     ensemble. The implementation uses the standard container std::unordered_map,
     which is a hash-based associative container with linear algorithmic
-    complexity for insertion of a new sample.
+    complexity for insertion of a new sample. If the extents of the sample
+    space are known, samples inside the extents are counted in a contiguous
+    array instead, see PDFBins.hpp, and only samples outside of the extents use
+    the map.
 */
 // *****************************************************************************
 #ifndef TriPDF_h
 #define TriPDF_h
 
 #include <array>
+#include <vector>
 #include <unordered_map>
 #include <algorithm>
 
 #include "Types.hpp"
 #include "PUPUtil.hpp"
+#include "PDFBins.hpp"
 
 namespace tk {
 
@@ -55,14 +60,25 @@ class TriPDF {
     using map_type = std::unordered_map< key_type, tk::real, key_hash >;
 
     //! Empty constructor for Charm++
-    explicit TriPDF() : m_binsize( {{ 0, 0, 0 }} ), m_nsample( 0 ), m_pdf() {}
+    explicit TriPDF() :
+      m_binsize( {{ 0, 0, 0 }} ), m_nsample( 0 ), m_lo( {{ 0, 0, 0 }} ),
+      m_nbi( {{ 0, 0, 0 }} ), m_dense(), m_pdf() {}
 
     //! Constructor: Initialize joint trivariate PDF container
     //! \param[in] bs Sample space bin size in all three directions
-    explicit TriPDF( const std::vector< tk::real >& bs ) :
+    //! \param[in] ext Sample space extents, {xmin,xmax,ymin,ymax,zmin,zmax}, if
+    //!   known, used to count samples inside the extents in dense storage
+    explicit TriPDF( const std::vector< tk::real >& bs,
+                    const std::vector< tk::real >& ext = {} ) :
       m_binsize( {{ bs[0], bs[1], bs[2] }} ),
       m_nsample( 0 ),
-      m_pdf() {}
+      m_lo(),
+      m_nbi(),
+      m_dense(),
+      m_pdf()
+    {
+      m_dense.resize( denseBins< dim >( m_binsize, ext, m_lo, m_nbi ), 0.0 );
+    }
 
     //! Accessor to number of samples
     //! \return Number of samples collected
@@ -72,25 +88,67 @@ class TriPDF {
     //! \param[in] sample Sample to add
     void add( std::array< tk::real, dim > sample ) {
       ++m_nsample;
-      ++m_pdf[ {{ std::lround( sample[0] / m_binsize[0] ),
-                  std::lround( sample[1] / m_binsize[1] ),
-                  std::lround( sample[2] / m_binsize[2] ) }} ];
+      count( {{ std::lround( sample[0] / m_binsize[0] ),
+                std::lround( sample[1] / m_binsize[1] ),
+                std::lround( sample[2] / m_binsize[2] ) }}, 1.0 );
+    }
+
+    //! Add multiple samples to trivariate PDF
+    //! \param[in] n Number of samples to add
+    //! \param[in] sample Function returning the ith sample, i=0...n-1
+    template< class Sample >
+    void add( std::size_t n, const Sample& sample ) {
+      m_nsample += n;
+      for (std::size_t i=0; i<n; ++i) {
+        const std::array< tk::real, dim > s = sample(i);
+        count( {{ std::lround( s[0] / m_binsize[0] ),
+                  std::lround( s[1] / m_binsize[1] ),
+                  std::lround( s[2] / m_binsize[2] ) }}, 1.0 );
+      }
     }
 
     //! Add multiple samples from a PDF
     //! \param[in] p PDF whose samples to add
+    //! \details If both PDFs use the same dense layout, the dense bins are
+    //!   added element by element. A PDF without samples and without dense
+    //!   storage, e.g., default-constructed, adopts the dense layout of p.
     void addPDF( const TriPDF& p ) {
       m_binsize = p.binsize();
+      if (m_dense.empty() && m_nsample == 0 && m_pdf.empty()) {
+        m_lo = p.m_lo;
+        m_nbi = p.m_nbi;
+        m_dense.assign( p.m_dense.size(), 0.0 );
+      }
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      if (m_lo == p.m_lo && m_nbi == p.m_nbi) {
+        for (std::size_t i=0; i<m_dense.size(); ++i) m_dense[i] += p.m_dense[i];
+      } else {
+        for (std::size_t i=0; i<p.m_dense.size(); ++i)
+          if (p.m_dense[i] > 0.0)
+            count( denseKey< dim >( i, p.m_lo, p.m_nbi ), p.m_dense[i] );
+      }
+      for (const auto& e : p.m_pdf) count( e.first, e.second );
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
+    void zero() noexcept {
+      m_nsample = 0;
+      std::fill( begin(m_dense), end(m_dense), 0.0 );
+      m_pdf.clear();
+    }
 
     //! Constant accessor to underlying PDF map
     //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    //! \details Samples counted in dense storage are moved to the map first.
+    //!   This does not change the distribution, only how it is stored.
+    const map_type& map() const {
+      for (std::size_t i=0; i<m_dense.size(); ++i)
+        if (m_dense[i] > 0.0) {
+          m_pdf[ denseKey< dim >( i, m_lo, m_nbi ) ] += m_dense[i];
+          m_dense[i] = 0.0;
+        }
+      return m_pdf;
+    }
 
     //! Constant accessor to bin sizes
     //! \return Constant reference to sample space bin sizes
@@ -101,14 +159,15 @@ class TriPDF {
     //!   dimensions
     //! \return {xmin,xmax,ymin,ymax,zmin,zmax} Minima and maxima of bin the ids
     std::array< long, 2*dim > extents() const {
-      Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
+      const auto& pdf = map();
+      Assert( !pdf.empty(), "PDF empty" );
+      auto x = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[0] < b.first[0]; } );
-      auto y = std::minmax_element( begin(m_pdf), end(m_pdf),
+      auto y = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[1] < b.first[1]; } );
-      auto z = std::minmax_element( begin(m_pdf), end(m_pdf),
+      auto z = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[2] < b.first[2]; } );
       return {{ x.first->first[0], x.second->first[0],
@@ -123,6 +182,9 @@ class TriPDF {
     void pup( PUP::er& p ) {
       p | m_binsize;
       p | m_nsample;
+      p | m_lo;
+      p | m_nbi;
+      p | m_dense;
       p | m_pdf;
     }
     //! \brief Pack/Unpack serialize operator|
@@ -134,7 +196,21 @@ class TriPDF {
   private:
     std::array< tk::real, dim > m_binsize;   //!< Sample space bin sizes
     std::size_t m_nsample;                   //!< Number of samples collected
-    map_type m_pdf;                          //!< Probability density function
+    std::array< long, dim > m_lo;   //!< Lowest bin ids of dense storage
+    std::array< long, dim > m_nbi;  //!< Number of bins of dense storage
+    //! Dense bins (samples inside the extents), moved to m_pdf by map()
+    mutable std::vector< tk::real > m_dense;
+    //! Probability density function (samples outside of dense storage)
+    mutable map_type m_pdf;
+
+    //! Count samples into a bin, dense if inside the extents, sparse otherwise
+    //! \param[in] bin Bin ids
+    //! \param[in] c Number of samples to count
+    void count( const key_type& bin, tk::real c ) {
+      auto i = denseIndex< dim >( bin, m_lo, m_nbi );
+      if (i >= 0) m_dense[ static_cast< std::size_t >( i ) ] += c;
+      else m_pdf[ bin ] += c;
+    }
 };
 
 } // tk::
@@ -10,13 +10,16 @@
     probability density function of (PDF) a scalar variable from an ensemble.
     The implementation uses the standard container std::unordered_map, which is
     a hash-based associative container with linear algorithmic complexity for
-    insertion of a new sample.
+    insertion of a new sample. If the extents of the sample space are known,
+    samples inside the extents are counted in a contiguous array instead, see
+    PDFBins.hpp, and only samples outside of the extents use the map.
 */
 // *****************************************************************************
 #ifndef UniPDF_h
 #define UniPDF_h
 
 #include <array>
+#include <vector>
 #include <unordered_map>
 #include <algorithm>
 #include <cfenv>
@@ -24,6 +27,7 @@
 #include "Types.hpp"
 #include "Exception.hpp"
 #include "PUPUtil.hpp"
+#include "PDFBins.hpp"
 
 namespace tk {
 
@@ -48,12 +52,19 @@ class UniPDF {
     using map_type = std::unordered_map< key_type, tk::real >;
 
     //! Empty constructor for Charm++
-    explicit UniPDF() : m_binsize( 0 ), m_nsample( 0 ), m_pdf() {}
+    explicit UniPDF() :
+      m_binsize( 0 ), m_nsample( 0 ), m_lo( {{ 0 }} ), m_nbi( {{ 0 }} ),
+      m_dense(), m_pdf() {}
 
     //! Constructor: Initialize univariate PDF container
     //! \param[in] bs Sample space bin size
-    explicit UniPDF( tk::real bs ) :
-      m_binsize( bs ), m_nsample( 0 ), m_pdf() {}
+    //! \param[in] ext Sample space extents, {xmin,xmax}, if known, used to
+    //!   count samples inside the extents in dense storage
+    explicit UniPDF( tk::real bs, const std::vector< tk::real >& ext = {} ) :
+      m_binsize( bs ), m_nsample( 0 ), m_lo(), m_nbi(), m_dense(), m_pdf()
+    {
+      m_dense.resize( denseBins< dim >( {{ bs }}, ext, m_lo, m_nbi ), 0.0 );
+    }
 
     //! Accessor to number of samples
     //! \return Number of samples collected
@@ -66,25 +77,70 @@ class UniPDF {
       ++m_nsample;
       fenv_t fe;
       feholdexcept( &fe );
-      ++m_pdf[ std::lround( sample / m_binsize ) ];
+      count( std::lround( sample / m_binsize ), 1.0 );
+      feclearexcept( FE_UNDERFLOW );
+      feupdateenv( &fe );
+    }
+
+    //! Add multiple samples to univariate PDF
+    //! \param[in] n Number of samples to add
+    //! \param[in] sample Function returning the ith sample, i=0...n-1
+    //! \details Compared to calling add() for each sample, this saves and
+    //!   restores the floating-point environment only once for all samples.
+    template< class Sample >
+    void add( std::size_t n, const Sample& sample ) {
+      Assert( m_binsize > 0, "Bin size must be positive" );
+      m_nsample += n;
+      fenv_t fe;
+      feholdexcept( &fe );
+      for (std::size_t i=0; i<n; ++i)
+        count( std::lround( sample(i) / m_binsize ), 1.0 );
       feclearexcept( FE_UNDERFLOW );
       feupdateenv( &fe );
     }
 
     //! Add multiple samples from a PDF
     //! \param[in] p PDF whose samples to add
+    //! \details If both PDFs use the same dense layout, the dense bins are
+    //!   added element by element. A PDF without samples and without dense
+    //!   storage, e.g., default-constructed, adopts the dense layout of p.
     void addPDF( const UniPDF& p ) {
       m_binsize = p.binsize();
+      if (m_dense.empty() && m_nsample == 0 && m_pdf.empty()) {
+        m_lo = p.m_lo;
+        m_nbi = p.m_nbi;
+        m_dense.assign( p.m_dense.size(), 0.0 );
+      }
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      if (m_lo == p.m_lo && m_nbi == p.m_nbi) {
+        for (std::size_t i=0; i<m_dense.size(); ++i) m_dense[i] += p.m_dense[i];
+      } else {
+        for (std::size_t i=0; i<p.m_dense.size(); ++i)
+          if (p.m_dense[i] > 0.0)
+            count( denseKey< dim >( i, p.m_lo, p.m_nbi )[0], p.m_dense[i] );
+      }
+      for (const auto& e : p.m_pdf) count( e.first, e.second );
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
+    void zero() noexcept {
+      m_nsample = 0;
+      std::fill( begin(m_dense), end(m_dense), 0.0 );
+      m_pdf.clear();
+    }
 
     //! Constant accessor to underlying PDF map
     //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    //! \details Samples counted in dense storage are moved to the map first.
+    //!   This does not change the distribution, only how it is stored.
+    const map_type& map() const {
+      for (std::size_t i=0; i<m_dense.size(); ++i)
+        if (m_dense[i] > 0.0) {
+          m_pdf[ denseKey< dim >( i, m_lo, m_nbi )[0] ] += m_dense[i];
+          m_dense[i] = 0.0;
+        }
+      return m_pdf;
+    }
 
     //! Constant accessor to bin size
     //! \return Sample space bin size
@@ -93,8 +149,9 @@ class UniPDF {
     //! Return minimum and maximum bin ids of sample space
     //! \return {min,max} Minimum and maximum of the bin ids
     std::array< long, 2*dim > extents() const {
-      Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
+      const auto& pdf = map();
+      Assert( !pdf.empty(), "PDF empty" );
+      auto x = std::minmax_element( begin(pdf), end(pdf),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first < b.first; } );
       return {{ x.first->first, x.second->first }};
@@ -103,7 +160,8 @@ class UniPDF {
     //! Compute integral of the distribution across the whole sample space
     //! \return Integral of the distribution
     tk::real integral() const {
-      return std::accumulate( m_pdf.cbegin(), m_pdf.cend(), 0.0,
+      const auto& pdf = map();
+      return std::accumulate( pdf.cbegin(), pdf.cend(), 0.0,
         [&]( tk::real i, const pair_type& p ){
           return i + p.second; } ) / m_nsample;
     }
@@ -115,6 +173,9 @@ class UniPDF {
     void pup( PUP::er& p ) {
       p | m_binsize;
       p | m_nsample;
+      p | m_lo;
+      p | m_nbi;
+      p | m_dense;
       p | m_pdf;
     }
     //! \brief Pack/Unpack serialize operator|
@@ -126,7 +187,21 @@ class UniPDF {
   private:
     tk::real m_binsize;         //!< Sample space bin size
     std::size_t m_nsample;      //!< Number of samples collected
-    map_type m_pdf;             //!< Probability density function
+    std::array< long, dim > m_lo;       //!< Lowest bin id of dense storage
+    std::array< long, dim > m_nbi;      //!< Number of bins of dense storage
+    //! Dense bins (samples inside the extents), moved to m_pdf by map()
+    mutable std::vector< tk::real > m_dense;
+    //! Probability density function (samples outside of dense storage)
+    mutable map_type m_pdf;
+
+    //! Count samples into a bin, dense if inside the extents, sparse otherwise
+    //! \param[in] bin Bin id
+    //! \param[in] c Number of samples to count
+    void count( key_type bin, tk::real c ) {
+      auto i = denseIndex< dim >( {{ bin }}, m_lo, m_nbi );
+      if (i >= 0) m_dense[ static_cast< std::size_t >( i ) ] += c;
+      else m_pdf[ bin ] += c;
+    }
 };
 
 //! Output univariate PDF to output stream
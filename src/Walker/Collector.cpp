@@ -33,12 +33,15 @@ using walker::Collector;
 
 void
 Collector::chareOrd( const std::vector< tk::real >& ord,
+                     const std::vector< tk::real >& censum,
                      const std::vector< tk::UniPDF >& updf,
                      const std::vector< tk::BiPDF >& bpdf,
                      const std::vector< tk::TriPDF >& tpdf )
 // *****************************************************************************
-// Chares contribute ordinary moments and ordinary PDFs
+// Chares contribute moments and ordinary PDFs
 //! \param[in] ord Vector of partial sums for the estimation of ordinary moments
+//! \param[in] censum Vector of partial shifted sums for the estimation of
+//!   central moments, see tk::Statistics::accumulate()
 //! \param[in] updf Vector of partial sums for the estimation of univariate
 //!   ordinary PDFs
 //! \param[in] bpdf Vector of partial sums for the estimation of bivariate
@@ -52,6 +55,7 @@ Collector::chareOrd( const std::vector< tk::real >& ord,
   ++m_nord;
 
   for (std::size_t i=0; i<m_ordinary.size(); ++i) m_ordinary[i] += ord[i];
+  for (std::size_t i=0; i<m_censum.size(); ++i) m_censum[i] += censum[i];
 
   // Add contribution from worker chares to partial sums on my PE
   std::size_t i = 0;
@@ -67,12 +71,16 @@ Collector::chareOrd( const std::vector< tk::real >& ord,
     // Create Charm++ callback function for reduction
     CkCallback c1( CkReductionTarget( Distributor, estimateOrd ), m_hostproxy );
 
-    // Contribute partial sums to host via Charm++ reduction
-    contribute( static_cast< int >( m_ordinary.size() * sizeof(tk::real) ),
-                m_ordinary.data(), CkReduction::sum_double, c1 );
+    // Contribute partial sums of ordinary moments followed by shifted sums for
+    // central moments to host via a single Charm++ reduction
+    auto sums = m_ordinary;
+    sums.insert( end(sums), begin(m_censum), end(m_censum) );
+    contribute( static_cast< int >( sums.size() * sizeof(tk::real) ),
+                sums.data(), CkReduction::sum_double, c1 );
 
     // Zero counters for next collection operation
     std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
+    std::fill( begin(m_censum), end(m_censum), 0.0 );
 
     // Serialize vector of PDFs to raw stream
     auto stream = tk::serialize( m_ordupdf, m_ordbpdf, m_ordtpdf );
@@ -95,13 +103,11 @@ Collector::chareOrd( const std::vector< tk::real >& ord,
 }
 
 void
-Collector::chareCen( const std::vector< tk::real >& cen,
-                     const std::vector< tk::UniPDF >& updf,
+Collector::chareCen( const std::vector< tk::UniPDF >& updf,
                      const std::vector< tk::BiPDF >& bpdf,
                      const std::vector< tk::TriPDF >& tpdf )
 // *****************************************************************************
-// Chares contribute central moments and central PDFs
-//! \param[in] cen Vector of partial sums for the estimation of central moments
+// Chares contribute central PDFs
 //! \param[in] updf Vector of partial sums for the estimation of univariate
 //!   central PDFs
 //! \param[in] bpdf Vector of partial sums for the estimation of bivariate
@@ -114,8 +120,6 @@ Collector::chareCen( const std::vector< tk::real >& cen,
 {
   ++m_ncen;
 
-  for (std::size_t i=0; i<m_central.size(); ++i) m_central[i] += cen[i];
-
   // Add contribution from worker chares to partial sums on my PE
   std::size_t i = 0;
   for (const auto& p : updf) m_cenupdf[i++].addPDF( p );
@@ -127,16 +131,6 @@ Collector::chareCen( const std::vector< tk::real >& cen,
   // If all chares on my PE have contributed, send partial sums to host
   if (m_ncen == m_nchare) {
 
-    // Create Charm++ callback function for reduction
-    CkCallback c1( CkReductionTarget( Distributor, estimateCen ), m_hostproxy );
-
-    // Contribute partial sums to host via Charm++ reduction
-    contribute( static_cast< int >( m_central.size() * sizeof(tk::real) ),
-                m_central.data(), CkReduction::sum_double, c1 );
-
-    // Zero counters for next collection operation
-    std::fill( begin(m_central), end(m_central), 0.0 );
-
     // Serialize vector of PDFs to raw stream
     auto stream = tk::serialize( m_cenupdf, m_cenbpdf, m_centpdf );
 
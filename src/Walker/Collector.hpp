@@ -18,6 +18,7 @@
 
 #include "Types.hpp"
 #include "PDFReducer.hpp"
+#include "Statistics.hpp"
 #include "Distributor.hpp"
 #include "Walker/InputDeck/InputDeck.hpp"
 
@@ -49,7 +50,8 @@ class Collector : public CBase_Collector {
       m_nord( 0 ),
       m_ncen( 0 ),
       m_ordinary( g_inputdeck.momentNames( tk::ctr::ordinary ).size(), 0.0 ),
-      m_central( g_inputdeck.momentNames( tk::ctr::central ).size(), 0.0 ),
+      m_censum( tk::Statistics::ncensum( g_inputdeck.get< tag::stat >() ),
+                0.0 ),
       m_ordupdf(
         tk::ctr::numPDF< 1 >( g_inputdeck.get< tag::discr, tag::binsize >(),
                               g_inputdeck.get< tag::pdf >(),
@@ -91,25 +93,25 @@ class Collector : public CBase_Collector {
     //!   method since it is always called by chares on the same PE.
     void checkin() { ++m_nchare; }
 
-    //! Chares contribute ordinary moments and ordinary PDFs
+    //! Chares contribute moments and ordinary PDFs
     void chareOrd( const std::vector< tk::real >& ord,
+                   const std::vector< tk::real >& censum,
                    const std::vector< tk::UniPDF >& updf,
                    const std::vector< tk::BiPDF >& bpdf,
                    const std::vector< tk::TriPDF >& tpdf );
 
-    //! Chares contribute central moments and central PDFs
-    void chareCen( const std::vector< tk::real >& cen,
-                   const std::vector< tk::UniPDF >& updf,
+    //! Chares contribute central PDFs
+    void chareCen( const std::vector< tk::UniPDF >& updf,
                    const std::vector< tk::BiPDF >& bpdf,
                    const std::vector< tk::TriPDF >& tpdf );
 
   private:
     CProxy_Distributor m_hostproxy;             //!< Host proxy    
     std::size_t m_nchare;  //!< Number of chares contributing to my PE
-    std::size_t m_nord;    //!< Number of chares contributed ordinary moments
-    std::size_t m_ncen;    //!< Number of chares contributed central moments
+    std::size_t m_nord;    //!< Number of chares contributed moments
+    std::size_t m_ncen;    //!< Number of chares contributed central PDFs
     std::vector< tk::real > m_ordinary;         //!< Ordinary moments
-    std::vector< tk::real > m_central;          //!< Central moments
+    std::vector< tk::real > m_censum;  //!< Shifted sums for central moments
     std::vector< tk::UniPDF > m_ordupdf;        //!< Ordinary univariate PDFs
     std::vector< tk::BiPDF > m_ordbpdf;         //!< Ordinary bivariate PDFs
     std::vector< tk::TriPDF > m_ordtpdf;        //!< Ordinary trivariate PDFs
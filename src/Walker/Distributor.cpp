@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <functional>
 #include <iomanip>
+#include <sstream>
 #include <iostream>
 #include <iterator>
 #include <limits>
@@ -32,6 +33,7 @@
 #include "Print.hpp"
 #include "Tags.hpp"
 #include "StatCtr.hpp"
+#include "Statistics.hpp"
 #include "Exception.hpp"
 #include "Particles.hpp"
 #include "LoadDistributor.hpp"
@@ -43,6 +45,7 @@
 #include "PDFWriter.hpp"
 #include "Options/PDFFile.hpp"
 #include "Options/PDFPolicy.hpp"
+#include "Options/RNG.hpp"
 #include "Walker/InputDeck/InputDeck.hpp"
 #include "NoWarning/walker.decl.h"
 
@@ -69,7 +72,8 @@ Distributor::Distributor() :
   m_cenbpdf(),
   m_centpdf(),
   m_tables(),
-  m_moments()
+  m_moments(),
+  m_lagerr( 0.0 )
 // *****************************************************************************
 // Constructor
 // *****************************************************************************
@@ -88,6 +92,15 @@ Distributor::Distributor() :
                   remainder );
   Assert( chunksize != 0, "Chunksize must not be zero" );
 
+  // Per-particle random number streams require counter-based generators
+  if (g_inputdeck.get< tag::discr, tag::particle_rng >()) {
+    tk::ctr::RNG rng;
+    for (auto r : g_inputdeck.get< tag::selected, tag::rng >())
+      ErrChk( rng.lib( r ) == tk::ctr::RNGLibType::R123,
+              "Per-particle random number streams, particle_rng, require "
+              "Random123 generators, but " + rng.name( r ) + " is selected" );
+  }
+
   // Compute total number of particles distributed over all workers. Note that
   // this number will not necessarily be the same as given by the user, coming
   // from g_inputdeck.get< tag::discr, tag::npar >(), since each Charm++ chare
@@ -106,7 +119,10 @@ Distributor::Distributor() :
                         std::string(),
                         g_inputdeck.get< tag::flformat, tag::stat >(),
                         g_inputdeck.get< tag::prec, tag::stat >() );
-  sw.header( m_nameOrdinary, m_nameCentral, m_tables.first );
+  auto extra = m_tables.first;
+  if (g_inputdeck.get< tag::discr, tag::lagtol >() > 0.0)
+    extra.push_back( "lagerr" );
+  sw.header( m_nameOrdinary, m_nameCentral, extra );
 
   // Print out time integration header
   print.endsubsection();
@@ -199,6 +215,11 @@ Distributor::info( const WalkerPrint& print,
               g_inputdeck.get< tag::discr, tag::term >() );
   print.item( "Initial time step size",
               g_inputdeck.get< tag::discr, tag::dt >() );
+  const auto lagtol = g_inputdeck.get< tag::discr, tag::lagtol >();
+  if (lagtol > 0.0)
+    print.item( "Lagged moments tolerance", lagtol );
+  if (g_inputdeck.get< tag::discr, tag::particle_rng >())
+    print.item( "Per-particle random number streams", "true" );
 
   // Print output intervals
   print.section( "Output intervals" );
@@ -243,13 +264,22 @@ Distributor::computedt()
 void
 Distributor::estimateOrd( tk::real* ord, [[maybe_unused]] int n )
 // *****************************************************************************
-// Estimate ordinary moments
-//! \param[in] ord Ordinary moments (sum) collected over all chares
-//! \param[in] n Number of ordinary moments in array ord
+// Estimate ordinary and central moments
+//! \param[in] ord Ordinary moments (sum) followed by the shifted sums for
+//!   central moments collected over all chares
+//! \param[in] n Number of sums in array ord
+//! \details Central moments are estimated from the same single pass over the
+//!   particles as the ordinary moments, using sums of products of fluctuations
+//!   about the means of the previous time step, see
+//!   tk::Statistics::accumulate(). Since all chares use the same shift, the
+//!   partial sums merge by simple summation.
 // *****************************************************************************
 {
-  Assert( static_cast<std::size_t>(n) == m_ordinary.size(),
-          "Number of ordinary moments contributed not equal to expected" );
+  const auto& stat = g_inputdeck.get< tag::stat >();
+
+  Assert( static_cast<std::size_t>(n) ==
+            m_ordinary.size() + tk::Statistics::ncensum( stat ),
+          "Number of moments contributed not equal to expected" );
 
   // Add contribution from PE to total sums, i.e., u[i] += v[i] for all i
   for (std::size_t i=0; i<m_ordinary.size(); ++i) m_ordinary[i] += ord[i];
@@ -258,30 +288,119 @@ Distributor::estimateOrd( tk::real* ord, [[maybe_unused]] int n )
   // cppcheck-suppress useStlAlgorithm
   for (auto& m : m_ordinary) m /= m_npar;
 
+  // Finish computing shifted sums and expand them into central moments
+  std::vector< tk::real > censum( ord + m_ordinary.size(), ord + n );
+  // cppcheck-suppress useStlAlgorithm
+  for (auto& m : censum) m /= m_npar;
+  m_central = tk::Statistics::central( stat, m_ordinary,
+                tk::Statistics::shift( stat, m_moments ), censum );
+
+  // Compute relative change of the moments since the previous time step
+  m_lagerr = lagError();
+
   // Activate SDAG trigger signaling that ordinary moments have been estimated
   estimateOrdDone();
+  // Activate SDAG trigger signaling that central moments have been estimated
+  estimateCenDone();
 }
 
 void
-Distributor::estimateCen( tk::real* cen, [[maybe_unused]] int n )
+Distributor::cenPDF()
 // *****************************************************************************
-// Estimate ordinary moments
-//! \param[in] cen Central moments (sum) collected over all chares
-//! \param[in] n Number of central moments in array cen
+// Start estimating central PDFs if they are to be output at this step
+//! \details Central PDFs require the ordinary moments to be known, so
+//!   estimating them requires another pass over the particles. This is only
+//!   done at the time steps at which PDFs are output, otherwise we signal that
+//!   central PDFs have been estimated.
 // *****************************************************************************
 {
-  Assert( static_cast<std::size_t>(n) == m_central.size(),
-          "Number of central moments contributed not equal to expected" );
+  if (cenPDFStep())
+    m_intproxy.accumulateCen( m_it, m_t, m_dt, m_ordinary );
+  else
+    estimateCenPDFDone();
+}
 
-  // Add contribution from PE to total sums, i.e., u[i] += v[i] for all i
-  for (std::size_t i=0; i<m_central.size(); ++i) m_central[i] += cen[i];
+bool
+Distributor::cenPDFStep() const
+// *****************************************************************************
+// Decide if central PDFs are to be estimated at this time step
+//! \return True if central PDFs are to be estimated at this time step
+// *****************************************************************************
+{
+  const auto& binsize = g_inputdeck.get< tag::discr, tag::binsize >();
+  const auto& pdf = g_inputdeck.get< tag::pdf >();
+  const auto term = g_inputdeck.get< tag::discr, tag::term >();
+  const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+  const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
 
-  // Finish computing moments, i.e., divide sums by the number of samples
-  // cppcheck-suppress useStlAlgorithm
-  for (auto& m : m_central) m /= m_npar;
+  const auto ncenpdf =
+    tk::ctr::numPDF< 1 >( binsize, pdf, tk::ctr::Moment::CENTRAL ) +
+    tk::ctr::numPDF< 2 >( binsize, pdf, tk::ctr::Moment::CENTRAL ) +
+    tk::ctr::numPDF< 3 >( binsize, pdf, tk::ctr::Moment::CENTRAL );
 
-  // Activate SDAG trigger signaling that central moments have been estimated
-  estimateCenDone();
+  return ncenpdf > 0 && g_inputdeck.pdf() &&
+         ( m_it == 0 ||
+           !((m_it+1) % pdffreq) ||
+           (std::fabs(m_t+m_dt-term) < eps && (m_it+1) >= nstep) );
+}
+
+tk::real
+Distributor::lagError() const
+// *****************************************************************************
+// Compute relative change of the moments since the previous time step
+//! \return Maximum change of the moments just estimated compared to those of
+//!   the previous time step, relative to their magnitude if larger than unity
+//! \details This is the difference between the moments the particles would be
+//!   advanced with in the next time step and the moments used instead if the
+//!   next time step is pipelined, see lag().
+// *****************************************************************************
+{
+  std::size_t ord = 0;
+  std::size_t cen = 0;
+  tk::real err = 0.0;
+  for (const auto& product : g_inputdeck.get< tag::stat >()) {
+    auto m = tk::ctr::ordinary( product ) ? m_ordinary[ ord++ ]
+                                          : m_central[ cen++ ];
+    auto d = std::abs( m - tk::ctr::lookup( product, m_moments ) );
+    err = std::max( err, d / std::max( 1.0, std::abs(m) ) );
+  }
+  return err;
+}
+
+bool
+Distributor::lag() const
+// *****************************************************************************
+// Decide if the time step after the next one may be pipelined
+//! \return True if, after contributing their statistics for the next time
+//!   step, the integrators may advance the particles in the time step after,
+//!   using the moments of the current time step, while the statistics of the
+//!   next time step are being estimated
+//! \details This is called after the moments of the current time step have
+//!   been estimated and the time step counter has been incremented, i.e., m_it
+//!   denotes the next time step. The time step after the next one is not
+//!   pipelined if (1) lagging is not enabled by the user, (2) the relative
+//!   change of the moments in the current time step exceeds the user-specified
+//!   tolerance, (3) central PDFs are estimated in the next time step, since
+//!   that requires another pass over the particles once the ordinary moments
+//!   are known, (4) particles are output in the time step after, or (5) the
+//!   next time step is the last one.
+// *****************************************************************************
+{
+  const auto lagtol = g_inputdeck.get< tag::discr, tag::lagtol >();
+  const auto term = g_inputdeck.get< tag::discr, tag::term >();
+  const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
+  const auto parfreq = g_inputdeck.get< tag::interval, tag::particles >();
+  const auto poseq =
+    !g_inputdeck.get< tag::param, tag::position, tag::depvar >().empty();
+
+  auto t = std::min( m_t + m_dt, term );
+
+  return lagtol > 0.0 && m_lagerr <= lagtol &&
+         !cenPDFStep() &&
+         !(poseq && !((m_it+2) % parfreq)) &&
+         std::fabs(t-term) > eps && m_it+1 < nstep;
 }
 
 void
@@ -333,6 +452,8 @@ Distributor::outStat()
     std::vector< tk::real > x( m_tables.second.size() );
     std::size_t j = 0;
     for (const auto& t : m_tables.second) x[ j++ ] = tk::sample(m_t,t);
+    if (g_inputdeck.get< tag::discr, tag::lagtol >() > 0.0)
+      x.push_back( m_lagerr );
     return x;
   };
 
@@ -638,7 +759,12 @@ Distributor::evaluateTime()
   // Finish if either max iterations or max time reached 
   if ( std::fabs(m_t-term) > eps && m_it < nstep ) {
 
+    // Decide if the time step after the next one may be pipelined
+    bool pipeline = false;
+
     if (g_inputdeck.stat()) {
+      pipeline = lag();
+
       // Update map of statistical moments
       std::size_t ord = 0;
       std::size_t cen = 0;
@@ -659,7 +785,7 @@ Distributor::evaluateTime()
     }
 
     // Continue with next time step with all integrators
-    m_intproxy.advance( m_dt, m_t, m_it, m_moments );
+    m_intproxy.advance( m_dt, m_t, m_it, m_moments, pipeline );
 
   } else finish();
 }
@@ -684,6 +810,40 @@ Distributor::finish()
      print.note( "Normal finish, maximum time reached: " +
                  std::to_string( term ) );
 
+  // Collect timings of advancing the equations, then quit
+  m_intproxy.timing();
+}
+
+void
+Distributor::timing( tk::real* t, int n )
+// *****************************************************************************
+//  Output throughput of advancing the differential equations and quit
+//! \param[in] t Time spent in seconds advancing each differential equation
+//!   summed over all Integrator chares, followed by the total number of
+//!   particle-steps taken
+//! \param[in] n Size of timing array
+//! \details The throughput is given as particle-steps per second per PE, i.e.,
+//!   the number of particle-steps divided by the sum of the times spent by all
+//!   Integrator chares advancing a given equation.
+// *****************************************************************************
+{
+  const auto neq = static_cast< std::size_t >( n ) - 1;
+  const auto parstep = t[ neq ];
+
+  auto print = printer();
+
+  if (parstep > 0.0) {
+    const auto info = DiffEqStack().info();
+    Assert( info.size() == neq, "Size mismatch in timing of diffeqs" );
+    print.section( "Differential equation throughput" );
+    for (std::size_t e=0; e<neq; ++e) {
+      std::stringstream ss;
+      ss << std::scientific << std::setprecision(3)
+         << (t[e] > 0.0 ? parstep / t[e] : 0.0) << " particle-steps/s/PE";
+      print.item( info[e][0].first, ss.str() );
+    }
+  }
+
   // Quit
   mainProxy.finalize();
 }
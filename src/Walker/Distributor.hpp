@@ -78,12 +78,9 @@ class Distributor : public CBase_Distributor {
     //!   broadcast to all Itegrator chares to continue with their setup.
     void registered() { m_intproxy.setup( m_dt, m_t, m_it, m_moments ); }
 
-    //! Estimate ordinary moments
+    //! Estimate ordinary and central moments
     void estimateOrd( tk::real* ord, int n );
 
-    //! Estimate central moments
-    void estimateCen( tk::real* cen, int n );
-
     //! Estimate ordinary PDFs
     void estimateOrdPDF( CkReductionMsg* msg );
 
@@ -93,6 +90,9 @@ class Distributor : public CBase_Distributor {
     //! Charm++ reduction target enabling shortcutting sync points if no stats
     void nostat();
 
+    //! Output throughput of advancing the differential equations and quit
+    void timing( tk::real* t, int n );
+
   private:
     //! Type alias for output indicators
     using OutputIndicators = tk::TaggedTuple< brigand::list<
@@ -122,6 +122,20 @@ class Distributor : public CBase_Distributor {
                std::vector< tk::Table > > m_tables;
     //! Map used to lookup moments
     std::map< tk::ctr::Product, tk::real > m_moments;
+    //! Relative change of the moments in the last time step
+    tk::real m_lagerr;
+
+    //! Start estimating central PDFs if they are to be output at this step
+    void cenPDF();
+
+    //! Decide if central PDFs are to be estimated at this time step
+    bool cenPDFStep() const;
+
+    //! Compute relative change of the moments since the previous time step
+    tk::real lagError() const;
+
+    //! Decide if the time step after the next one may be pipelined
+    bool lag() const;
 
     //! Print information at startup
     void info( const WalkerPrint& print,
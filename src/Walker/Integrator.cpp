@@ -15,12 +15,18 @@
 */
 // *****************************************************************************
 
+#include <algorithm>
+
+#include "Timer.hpp"
+#include "RNG.hpp"
+#include "Options/RNG.hpp"
 #include "Integrator.hpp"
 #include "Collector.hpp"
 
 namespace walker {
 
 extern std::vector< DiffEq > g_diffeqs;
+extern std::map< tk::ctr::RawRNGType, tk::RNG > g_rng;
 
 }
 
@@ -38,11 +44,18 @@ Integrator::Integrator( CProxy_Distributor hostproxy,
           g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
           g_inputdeck.get< tag::stat >(),
           g_inputdeck.get< tag::pdf >(),
-          g_inputdeck.get< tag::discr, tag::binsize >() ),
+          g_inputdeck.get< tag::discr, tag::binsize >(),
+          g_inputdeck.get< tag::discr, tag::extent >() ),
   m_dt( 0.0 ),
   m_t( 0.0 ),
   m_it( 0 ),
-  m_itp( 0 )
+  m_itp( 0 ),
+  m_moments(),
+  m_advtime( g_diffeqs.size(), 0.0 ),
+  m_parstep( 0 ),
+  m_lag( false ),
+  m_ahead( false ),
+  m_wait( false )
 // *****************************************************************************
 // Constructor
 //! \param[in] hostproxy Host proxy to call back to
@@ -75,8 +88,8 @@ Integrator::setup( tk::real dt,
 //! \param[in] moments Map of statistical moments
 // *****************************************************************************
 {
-  ic();                           // set initial conditions for all equations
-  advance( dt, t, it, moments );  // start time stepping all equations
+  ic();                        // set initial conditions for all equations
+  step( dt, t, it, moments );  // start time stepping all equations
 }
 
 void
@@ -85,6 +98,7 @@ Integrator::ic()
 // Set initial conditions
 // *****************************************************************************
 {
+  particleStreams( 0 );
   for (const auto& eq : g_diffeqs) eq.initialize( CkMyPe(), m_particles );
 }
 
@@ -92,7 +106,44 @@ void
 Integrator::advance( tk::real dt,
                      tk::real t,
                      uint64_t it,
-                     const std::map< tk::ctr::Product, tk::real >& moments )
+                     const std::map< tk::ctr::Product, tk::real >& moments,
+                     bool lag )
+// *****************************************************************************
+// Continue with the next time step once the moments have been estimated
+//! \param[in] dt Size of time step
+//! \param[in] t Physical time
+//! \param[in] it Iteration count
+//! \param[in] moments Map of statistical moments estimated in the previous
+//!   time step
+//! \param[in] lag True if, after contributing the statistics of this time
+//!   step, the particles may be advanced in the next time step using lagged
+//!   moments, see Distributor::lag()
+//! \details If the particles have already been advanced in this time step
+//!   using lagged moments, the moments received are only used to shift the
+//!   sums for central moments, and estimating the statistics of this time step
+//!   is continued if it has been waiting for them.
+// *****************************************************************************
+{
+  m_lag = lag;
+
+  if (m_ahead) {
+    Assert( it == m_it, "Lagged time step mismatch" );
+    m_ahead = false;
+    m_moments = moments;
+    if (m_wait) {
+      m_wait = false;
+      accumulate();
+    }
+  } else {
+    step( dt, t, it, moments );
+  }
+}
+
+void
+Integrator::step( tk::real dt,
+                  tk::real t,
+                  uint64_t it,
+                  const std::map< tk::ctr::Product, tk::real >& moments )
 // *****************************************************************************
 // Advance all particles owned by this integrator
 //! \param[in] dt Size of time step
@@ -104,14 +155,21 @@ Integrator::advance( tk::real dt,
   // Advance all equations one step in time. At the 0th iteration skip advance
   // but estimate statistics and (potentially) PDFs (at the interval given by
   // the user).
-  if (it > 0)
-    for (const auto& e : g_diffeqs)
-      e.advance( m_particles, CkMyPe(), dt, t, moments );
+  if (it > 0) {
+    particleStreams( it );
+    for (std::size_t e=0; e<g_diffeqs.size(); ++e) {
+      tk::Timer timer;
+      g_diffeqs[e].advance( m_particles, CkMyPe(), dt, t, moments );
+      m_advtime[e] += timer.dsec();
+    }
+    m_parstep += m_particles.nunk();
+  }
 
   // Save time stepping data
   m_dt = dt;
   m_t = t;
   m_it = it;
+  m_moments = moments;
 
   // Contribute number of particles we hit the particles output frequency
   auto poseq =
@@ -126,6 +184,24 @@ Integrator::advance( tk::real dt,
     c.send();
 }
 
+void
+Integrator::particleStreams( uint64_t it )
+// *****************************************************************************
+// Enable per-particle random number streams if configured
+//! \param[in] it Iteration count the random numbers are drawn for
+//! \details Positions the stream of this PE of all random number generators to
+//!   number particles starting from the global id of the first particle of
+//!   this integrator. All integrators own the same number of particles, so the
+//!   global ids only depend on the array index, and the random numbers drawn
+//!   for a particle do not depend on which PE or integrator advances it.
+// *****************************************************************************
+{
+  if (!g_inputdeck.get< tag::discr, tag::particle_rng >()) return;
+
+  const auto first = static_cast< uint64_t >( thisIndex ) * m_particles.nunk();
+  for (const auto& r : g_rng) r.second.particles( CkMyPe(), first, it );
+}
+
 void
 Integrator::out()
 // *****************************************************************************
@@ -151,6 +227,21 @@ Integrator::out()
   }
 }
 
+void
+Integrator::timing()
+// *****************************************************************************
+// Contribute time spent advancing each differential equation
+//! \details The time spent in each differential equation and the number of
+//!   particle-steps taken are summed over all Integrator chares and sent to
+//!   Distributor::timing(), which computes the throughput of each equation.
+// *****************************************************************************
+{
+  auto t = m_advtime;
+  t.push_back( static_cast< tk::real >( m_parstep ) );
+  contribute( t, CkReduction::sum_double,
+              CkCallback(CkReductionTarget(Distributor,timing), m_host) );
+}
+
 void
 Integrator::accumulate()
 // *****************************************************************************
@@ -159,16 +250,28 @@ Integrator::accumulate()
 {
   if (!g_inputdeck.stat()) {// if no stats to estimate, skip to end of time step
     contribute( CkCallback(CkReductionTarget(Distributor, nostat), m_host) );
+  } else if (m_ahead) {
+    // Particles were advanced using lagged moments, wait for the moments of
+    // the previous time step to shift the sums for central moments with
+    m_wait = true;
   } else {
     // Accumulate sums for ordinary moments (every time step)
     accumulateOrd( m_it, m_t, m_dt );
+    // Advance the next time step using the moments of the previous time step
+    // while the statistics of this time step are being estimated
+    if (m_lag) {
+      m_lag = false;
+      m_ahead = true;
+      const auto term = g_inputdeck.get< tag::discr, tag::term >();
+      step( m_dt, std::min( m_t+m_dt, term ), m_it+1, m_moments );
+    }
   }
 }
 
 void
 Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
 // *****************************************************************************
-// Accumulate sums for ordinary moments and ordinary PDFs
+// Accumulate sums for moments and ordinary PDFs
 //! \param[in] it Iteration count
 //! \param[in] t Physical time
 //! \param[in] dt Time step size
@@ -179,8 +282,9 @@ Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
   const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
 
-  // Accumulate partial sums for ordinary moments
-  m_stat.accumulateOrd();
+  // Accumulate partial sums for ordinary moments and shifted sums for central
+  // moments, using the moments of the previous time step as shifts
+  m_stat.accumulate( m_moments );
   // Accumulate sums for ordinary PDFs at first and last iterations and at
   // select times
   if ( g_inputdeck.pdf() &&
@@ -189,9 +293,9 @@ Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
          (std::fabs(t+dt-term) < eps && (it+1) >= nstep) ) )
     m_stat.accumulateOrdPDF();
 
-  // Send accumulated ordinary moments and ordinary PDFs to collector for
-  // estimation
+  // Send accumulated moments and ordinary PDFs to collector for estimation
   m_coll.ckLocalBranch()->chareOrd( m_stat.ord(),
+                                    m_stat.censum(),
                                     m_stat.oupdf(),
                                     m_stat.obpdf(),
                                     m_stat.otpdf() );
@@ -203,11 +307,15 @@ Integrator::accumulateCen( uint64_t it,
                            tk::real dt,
                            const std::vector< tk::real >& ord )
 // *****************************************************************************
-// Accumulate sums for central moments and central PDFs
+// Accumulate sums for central PDFs
 //! \param[in] it Iteration count
 //! \param[in] t Physical time
 //! \param[in] dt Time step size
 //! \param[in] ord Estimated ordinary moments (collected from all PEs)
+//! \details Central moments are accumulated in a single pass with the ordinary
+//!   moments, see accumulateOrd(). Central PDFs require the ordinary moments to
+//!   be known, so they need a second pass over the particles. This is only
+//!   called if central PDFs are to be output at this time step.
 // *****************************************************************************
 {
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
@@ -215,8 +323,6 @@ Integrator::accumulateCen( uint64_t it,
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
   const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
 
-  // Accumulate partial sums for central moments
-  m_stat.accumulateCen( ord );
   // Accumulate partial sums for central PDFs at first and last iteraions and
   // at select times
   if ( g_inputdeck.pdf() &&
@@ -225,9 +331,8 @@ Integrator::accumulateCen( uint64_t it,
          (std::fabs(t+dt-term) < eps && (it+1) >= nstep) ) )
     m_stat.accumulateCenPDF( ord );
 
-  // Send accumulated central moments to host for estimation
-  m_coll.ckLocalBranch()->chareCen( m_stat.ctr(),
-                                    m_stat.cupdf(),
+  // Send accumulated central PDFs to host for estimation
+  m_coll.ckLocalBranch()->chareCen( m_stat.cupdf(),
                                     m_stat.cbpdf(),
                                     m_stat.ctpdf() );
 }
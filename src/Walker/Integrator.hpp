@@ -59,7 +59,8 @@ class Integrator : public CBase_Integrator {
               g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
               g_inputdeck.get< tag::stat >(),
               g_inputdeck.get< tag::pdf >(),
-              g_inputdeck.get< tag::discr, tag::binsize >() ) {}
+              g_inputdeck.get< tag::discr, tag::binsize >(),
+              g_inputdeck.get< tag::discr, tag::extent >() ) {}
 
     //! Perform setup: set initial conditions and advance a time step
     void setup( tk::real dt,
@@ -70,19 +71,23 @@ class Integrator : public CBase_Integrator {
     //! Set initial conditions
     void ic();
 
-    //! Advance all particles owned by this integrator
+    //! Continue with the next time step once the moments have been estimated
     void advance( tk::real dt,
                   tk::real t,
                   uint64_t it,
-                  const std::map< tk::ctr::Product, tk::real >& moments );
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  bool lag );
 
     //! Output particle positions to file
     void out();
 
+    //! Contribute time spent advancing each differential equation
+    void timing();
+
     //! Start collecting statistics
     void accumulate();
 
-    // Accumulate sums for central moments and central PDFs
+    // Accumulate sums for central PDFs
     void accumulateCen( uint64_t it,
                         tk::real t,
                         tk::real dt,
@@ -98,9 +103,30 @@ class Integrator : public CBase_Integrator {
     tk::real m_t;                  //!< Physical time
     uint64_t m_it;                 //!< Iteration count
     uint64_t m_itp;                //!< Particle position output iteration count
+    //! Statistical moments estimated in the previous time step
+    std::map< tk::ctr::Product, tk::real > m_moments;
+    //! Time spent advancing each differential equation in seconds
+    std::vector< tk::real > m_advtime;
+    //! Number of particle-steps taken, i.e., sum of particles advanced
+    uint64_t m_parstep;
+    //! True if the next time step may be advanced with lagged moments
+    bool m_lag;
+    //! True if this time step was advanced before its moments were received
+    bool m_ahead;
+    //! True if estimating statistics waits for the moments of this time step
+    bool m_wait;
 
-    // Accumulate sums for ordinary moments and ordinary PDFs
+    //! Advance all particles owned by this integrator
+    void step( tk::real dt,
+               tk::real t,
+               uint64_t it,
+               const std::map< tk::ctr::Product, tk::real >& moments );
+
+    // Accumulate sums for moments and ordinary PDFs
     void accumulateOrd( uint64_t it, tk::real t, tk::real dt );
+
+    //! Enable per-particle random number streams if configured
+    void particleStreams( uint64_t it );
 };
 
 #if defined(__clang__)
@@ -0,0 +1,104 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/Table.hpp
+  \details   Unit tests for Base/Table.hpp
+*/
+// *****************************************************************************
+
+#include <vector>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Table.hpp"
+#include "Types.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Table_common {
+  double precision = 1.0e-14;
+};
+
+//! Test group shortcuts
+using Table_group = test_group< Table_common, MAX_TESTS_IN_GROUP >;
+using Table_object = Table_group::object;
+
+//! Define test group
+static Table_group Table( "Base/Table" );
+
+//! Test definitions for group
+
+//! Test sampling a table with non-uniformly spaced abscissa values
+template<> template<>
+void Table_object::test< 1 >() {
+  set_test_name( "sample non-uniform" );
+
+  const tk::Table t{ {0.0, 1.0}, {1.0, 3.0}, {3.0, 2.0}, {3.5, 4.0} };
+
+  ensure_not( "non-uniform", t.uniform() );
+  ensure_equals( "below first x", t.sample(-1.0), 1.0, precision );
+  ensure_equals( "above last x", t.sample(4.0), 4.0, precision );
+  ensure_equals( "interpolate", t.sample(0.5), 2.0, precision );
+  ensure_equals( "interpolate", t.sample(2.0), 2.5, precision );
+  ensure_equals( "interpolate backwards", t.sample(0.25), 1.5, precision );
+  ensure_equals( "knot", t.sample(1.0), 3.0, precision );
+  ensure_equals( "knot", t.sample(3.0), 2.0, precision );
+  ensure_equals( "last knot", t.sample(3.5), 4.0, precision );
+  ensure_equals( "free function", tk::sample(3.25,t), 3.0, precision );
+}
+
+//! Test sampling a table with uniformly spaced abscissa values
+template<> template<>
+void Table_object::test< 2 >() {
+  set_test_name( "sample uniform" );
+
+  const tk::Table t{ {0.1, 0.0}, {0.2, 1.0}, {0.3, 4.0}, {0.4, 9.0} };
+
+  ensure( "uniform", t.uniform() );
+  ensure_equals( "below first x", t.sample(0.0), 0.0, precision );
+  ensure_equals( "above last x", t.sample(0.5), 9.0, precision );
+  ensure_equals( "interpolate", t.sample(0.15), 0.5, precision );
+  ensure_equals( "interpolate", t.sample(0.35), 6.5, precision );
+  ensure_equals( "knot", t.sample(0.2), 1.0, precision );
+  ensure_equals( "knot", t.sample(0.3), 4.0, precision );
+}
+
+//! Test that pairs stepping back in x are skipped
+template<> template<>
+void Table_object::test< 3 >() {
+  set_test_name( "skip decreasing x" );
+
+  const tk::Table t{ {0.0, 0.0}, {1.0, 1.0}, {0.5, 7.0}, {1.0, 2.0},
+                     {2.0, 4.0} };
+
+  ensure_equals( "size", t.size(), 4UL );
+  ensure_equals( "before repeated x", t.sample(0.5), 0.5, precision );
+  ensure_equals( "after repeated x", t.sample(1.5), 3.0, precision );
+}
+
+//! Test that batch sampling equals sampling one by one
+template<> template<>
+void Table_object::test< 4 >() {
+  set_test_name( "batch sample" );
+
+  const tk::Table t{ {0.0, 1.0}, {1.0, 3.0}, {3.0, 2.0}, {3.5, 4.0} };
+
+  std::vector< tk::real > x{ 3.2, -1.0, 0.5, 0.7, 1.0, 2.9, 5.0, 0.1 };
+  std::vector< tk::real > y( x.size() );
+  t.sample( x.size(), x.data(), y.data() );
+
+  for (std::size_t i=0; i<x.size(); ++i)
+    ensure_equals( "batch sample", y[i], t.sample(x[i]), precision );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
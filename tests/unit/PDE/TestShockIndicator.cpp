@@ -0,0 +1,239 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/PDE/TestShockIndicator.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for PDE/ShockIndicator.hpp
+  \details   Unit tests for PDE/ShockIndicator.hpp. The tests use a row of unit
+    cubes along the x direction, each cube split into six tetrahedra, on which
+    a smooth and a discontinuous DG(P1) solution are set up.
+*/
+// *****************************************************************************
+
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "Vector.hpp"
+#include "DerivedData.hpp"
+#include "FaceData.hpp"
+#include "ShockIndicator.hpp"
+#include "Integrate/Basis.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct ShockIndicator_common {
+  //! Number of unit cubes along x
+  static constexpr std::size_t ncube = 6;
+  //! Number of (reconstructed) degrees of freedom, DG(P1)
+  static constexpr std::size_t rdof = 4;
+  //! Threshold of the indicator
+  static constexpr tk::real coeff = 0.1;
+
+  ShockIndicator_common() : coord(), inpoel(), fd(), geoElem() {
+    // nodes of the cubes, node of cube corner (i,j,k) is 4*i + 2*j + k
+    for (std::size_t i=0; i<=ncube; ++i)
+      for (std::size_t j=0; j<2; ++j)
+        for (std::size_t k=0; k<2; ++k) {
+          coord[0].push_back( static_cast< tk::real >( i ) );
+          coord[1].push_back( static_cast< tk::real >( j ) );
+          coord[2].push_back( static_cast< tk::real >( k ) );
+        }
+    // split each cube into six tetrahedra along its main diagonal, which
+    // yields a conforming mesh of the row of cubes
+    const std::array< std::array< std::size_t, 3 >, 6 > perm{{
+      {{0,1,2}}, {{0,2,1}}, {{1,0,2}}, {{1,2,0}}, {{2,0,1}}, {{2,1,0}} }};
+    const std::array< std::size_t, 3 > stride{{ 4, 2, 1 }};
+    for (std::size_t i=0; i<ncube; ++i)
+      for (const auto& p : perm) {
+        auto a = 4*i;
+        auto b = a + stride[p[0]];
+        auto c = b + stride[p[1]];
+        auto d = c + stride[p[2]];
+        // swap two nodes of left-handed tetrahedra to yield positive volume
+        if (tk::Jacobian( node(a), node(b), node(c), node(d) ) < 0.0)
+          std::swap( c, d );
+        inpoel.insert( end(inpoel), { a, b, c, d } );
+      }
+    // collect boundary faces, all assigned to side set 1
+    auto esuel = tk::genEsuelTet( inpoel, tk::genEsup(inpoel,4) );
+    std::map< int, std::vector< std::size_t > > bface;
+    std::vector< std::size_t > triinpoel;
+    for (std::size_t e=0; e<inpoel.size()/4; ++e)
+      for (std::size_t f=0; f<4; ++f)
+        if (esuel[4*e+f] == -1) {
+          bface[1].push_back( triinpoel.size()/3 );
+          for (auto n : tk::lpofa[f]) triinpoel.push_back( inpoel[4*e+n] );
+        }
+    fd = inciter::FaceData( inpoel, bface, triinpoel );
+    geoElem = tk::genGeoElemTet( inpoel, coord );
+  }
+
+  //! Return coordinates of a mesh node
+  //! \param[in] p Node id
+  //! \return Coordinates of node p
+  std::array< tk::real, 3 > node( std::size_t p ) const
+  { return {{ coord[0][p], coord[1][p], coord[2][p] }}; }
+
+  //! Set DG(P1) dofs of a component to a linear function of x
+  //! \param[in] c Component index
+  //! \param[in] a Value of the function at x = 0
+  //! \param[in] g Derivative of the function in x
+  //! \param[in,out] U Solution vector
+  void linear( std::size_t c, tk::real a, tk::real g, tk::Fields& U ) const {
+    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      const auto* N = inpoel.data() + 4*e;
+      auto xc = (coord[0][N[0]] + coord[0][N[1]] + coord[0][N[2]] +
+                 coord[0][N[3]]) / 4.0;
+      auto dBdx = tk::eval_dBdx_p1( rdof,
+        tk::inverseJacobian( node(N[0]), node(N[1]), node(N[2]), node(N[3]) ) );
+      auto ux = tk::cramer( {{ {{dBdx[0][1], dBdx[0][2], dBdx[0][3]}},
+                               {{dBdx[1][1], dBdx[1][2], dBdx[1][3]}},
+                               {{dBdx[2][1], dBdx[2][2], dBdx[2][3]}} }},
+                            {{ g, 0.0, 0.0 }} );
+      U(e,c*rdof+0,0) = a + g*xc;
+      U(e,c*rdof+1,0) = ux[0];
+      U(e,c*rdof+2,0) = ux[1];
+      U(e,c*rdof+3,0) = ux[2];
+    }
+  }
+
+  //! Mesh node coordinates
+  tk::UnsMesh::Coords coord;
+  //! Mesh connectivity
+  std::vector< std::size_t > inpoel;
+  //! Face connectivity
+  inciter::FaceData fd;
+  //! Element geometry
+  tk::Fields geoElem;
+};
+
+//! Test group shortcuts
+using ShockIndicator_group =
+  test_group< ShockIndicator_common, MAX_TESTS_IN_GROUP >;
+using ShockIndicator_object = ShockIndicator_group::object;
+
+//! Define test group
+static ShockIndicator_group ShockIndicator( "PDE/ShockIndicator" );
+
+//! Test definitions for group
+
+//! Test that no elements are marked in a smooth solution
+template<> template<>
+void ShockIndicator_object::test< 1 >() {
+  set_test_name( "smooth solution marks nothing" );
+
+  auto nelem = inpoel.size()/4;
+  std::vector< std::size_t > ndofel( nelem, rdof );
+
+  // component 0 is linear in x, component 1 is linear in x and crosses zero,
+  // like a momentum component, and is not tested
+  tk::Fields U( nelem, 2*rdof );
+  linear( 0, 1.0, 0.1, U );
+  linear( 1, -3.0, 1.0, U );
+
+  std::vector< std::size_t > shockmarker;
+  inciter::MarkShockCells( nelem, rdof, rdof, coeff, {0}, ndofel, inpoel,
+                           coord, fd, geoElem, U, shockmarker );
+
+  ensure_equals( "shockmarker size", shockmarker.size(), nelem );
+  for (std::size_t e=0; e<nelem; ++e)
+    ensure_equals( "element " + std::to_string(e) + " marked",
+                   shockmarker[e], 0UL );
+}
+
+//! Test that a step marks the elements at the step and their face-neighbors
+template<> template<>
+void ShockIndicator_object::test< 2 >() {
+  set_test_name( "step marks step cells and face-neighbors" );
+
+  auto nelem = inpoel.size()/4;
+  std::vector< std::size_t > ndofel( nelem, rdof );
+
+  // constant 1.0 left of and constant 2.0 right of x = 3
+  const tk::real xs = 3.0;
+  tk::Fields U( nelem, rdof );
+  U.fill( 0.0 );
+  for (std::size_t e=0; e<nelem; ++e) {
+    const auto* N = inpoel.data() + 4*e;
+    auto xc = (coord[0][N[0]] + coord[0][N[1]] + coord[0][N[2]] +
+               coord[0][N[3]]) / 4.0;
+    U(e,0,0) = xc < xs ? 1.0 : 2.0;
+  }
+
+  std::vector< std::size_t > shockmarker;
+  inciter::MarkShockCells( nelem, rdof, rdof, coeff, {0}, ndofel, inpoel,
+                           coord, fd, geoElem, U, shockmarker );
+
+  // elements with a face on the step and their face-neighbors
+  const auto& esuel = fd.Esuel();
+  std::vector< std::size_t > step( nelem, 0 );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t f=0; f<4; ++f) {
+      const auto& l = tk::lpofa[f];
+      if ( std::all_of( begin(l), end(l), [&]( std::size_t n ){
+             return std::abs( coord[0][ inpoel[4*e+n] ] - xs ) <
+                    std::numeric_limits< tk::real >::epsilon(); } ) )
+        step[e] = 1;
+    }
+  std::vector< std::size_t > expected( step );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t f=0; f<4; ++f) {
+      auto n = esuel[4*e+f];
+      if (n > -1 && step[ static_cast< std::size_t >( n ) ]) expected[e] = 1;
+    }
+
+  ensure( "no element at the step", std::count(begin(step),end(step),1) > 0 );
+  ensure_equals( "shockmarker size", shockmarker.size(), nelem );
+  for (std::size_t e=0; e<nelem; ++e)
+    ensure_equals( "element " + std::to_string(e) + " marked",
+                   shockmarker[e], expected[e] );
+  // elements away from the step are not marked
+  for (std::size_t e=0; e<nelem; ++e) {
+    const auto* N = inpoel.data() + 4*e;
+    auto xmin = std::min( { coord[0][N[0]], coord[0][N[1]], coord[0][N[2]],
+                            coord[0][N[3]] } );
+    if (xmin < xs - 1.5 || xmin > xs + 0.5)
+      ensure_equals( "element " + std::to_string(e) + " away from the step "
+                     "marked", shockmarker[e], 0UL );
+  }
+}
+
+//! Test that a zero threshold marks all elements
+template<> template<>
+void ShockIndicator_object::test< 3 >() {
+  set_test_name( "zero threshold marks all elements" );
+
+  auto nelem = inpoel.size()/4;
+  std::vector< std::size_t > ndofel( nelem, rdof );
+
+  tk::Fields U( nelem, rdof );
+  linear( 0, 1.0, 0.1, U );
+
+  std::vector< std::size_t > shockmarker;
+  inciter::MarkShockCells( nelem, rdof, rdof, 0.0, {0}, ndofel, inpoel,
+                           coord, fd, geoElem, U, shockmarker );
+
+  ensure_equals( "shockmarker size", shockmarker.size(), nelem );
+  ensure( "not all elements marked",
+          std::all_of( begin(shockmarker), end(shockmarker),
+                       []( std::size_t m ){ return m == 1; } ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
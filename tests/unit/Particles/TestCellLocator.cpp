@@ -0,0 +1,238 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Particles/TestCellLocator.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Particles/CellLocator.hpp
+  \details   Unit tests for Particles/CellLocator.hpp. The tests use small mesh
+    chunks made of unit cubes, each cube split into six tetrahedra.
+*/
+// *****************************************************************************
+
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Types.hpp"
+#include "Vector.hpp"
+#include "DerivedData.hpp"
+#include "CellLocator.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct CellLocator_common {
+  //! Generate mesh chunk of unit cubes, each split into six tetrahedra
+  //! \param[in] cubes Integer coordinates of the lower corner of the cubes
+  //! \details All cubes are split along the same main diagonal, which yields a
+  //!   conforming mesh of the cubes.
+  void mesh( const std::vector< std::array< std::size_t, 3 > >& cubes ) {
+    coord = {};
+    inpoel.clear();
+    std::map< std::array< std::size_t, 3 >, std::size_t > nodes;
+    auto node = [&]( std::array< std::size_t, 3 > c ) {
+      auto n = nodes.emplace( c, nodes.size() );
+      if (n.second)
+        for (std::size_t j=0; j<3; ++j)
+          coord[j].push_back( static_cast< tk::real >( c[j] ) );
+      return n.first->second;
+    };
+    const std::array< std::array< std::size_t, 3 >, 6 > perm{{
+      {{0,1,2}}, {{0,2,1}}, {{1,0,2}}, {{1,2,0}}, {{2,0,1}}, {{2,1,0}} }};
+    for (const auto& c : cubes)
+      for (const auto& p : perm) {
+        auto b = c;  ++b[p[0]];
+        auto d = b;  ++d[p[1]];
+        auto e = d;  ++e[p[2]];
+        std::array< std::size_t, 4 > t{{ node(c), node(b), node(d), node(e) }};
+        // swap two nodes of left-handed tetrahedra to yield positive volume
+        if (tk::Jacobian( x(t[0]), x(t[1]), x(t[2]), x(t[3]) ) < 0.0)
+          std::swap( t[2], t[3] );
+        inpoel.insert( end(inpoel), begin(t), end(t) );
+      }
+  }
+
+  //! Return coordinates of a mesh node
+  //! \param[in] p Node id
+  //! \return Coordinates of node p
+  std::array< tk::real, 3 > x( std::size_t p ) const
+  { return {{ coord[0][p], coord[1][p], coord[2][p] }}; }
+
+  //! Return the centroid of a mesh cell
+  //! \param[in] e Mesh cell id
+  //! \return Coordinates of the centroid of cell e
+  std::array< tk::real, 3 > centroid( std::size_t e ) const {
+    std::array< tk::real, 3 > c{{ 0.0, 0.0, 0.0 }};
+    for (std::size_t a=0; a<4; ++a)
+      for (std::size_t j=0; j<3; ++j) c[j] += coord[j][ inpoel[e*4+a] ] / 4.0;
+    return c;
+  }
+
+  //! Test that shapefunctions interpolate a point in a mesh cell
+  //! \param[in] msg Message to prefix failures with
+  //! \param[in] p Point coordinates
+  //! \param[in] e Mesh cell id
+  //! \param[in] N Shapefunctions evaluated at point p in cell e
+  void interpolates( const std::string& msg,
+                     const std::array< tk::real, 3 >& p,
+                     std::size_t e,
+                     const std::array< tk::real, 4 >& N ) const
+  {
+    for (std::size_t j=0; j<3; ++j) {
+      tk::real s = 0.0;
+      for (std::size_t a=0; a<4; ++a) s += N[a] * coord[j][ inpoel[e*4+a] ];
+      ensure_equals( msg + ": interpolated coordinate " + std::to_string(j),
+                     s, p[j], precision );
+    }
+  }
+
+  //! Mesh node coordinates
+  std::array< std::vector< tk::real >, 3 > coord;
+  //! Mesh connectivity
+  std::vector< std::size_t > inpoel;
+  //! Tolerance for comparing coordinates
+  const tk::real precision = 1.0e-12;
+};
+
+//! Test group shortcuts
+using CellLocator_group = test_group< CellLocator_common, MAX_TESTS_IN_GROUP >;
+using CellLocator_object = CellLocator_group::object;
+
+//! Define test group
+static CellLocator_group CellLocator( "Particles/CellLocator" );
+
+//! Test definitions for group
+
+//! Test that the face walk finds a point starting from a distant cell
+template<> template<>
+void CellLocator_object::test< 1 >() {
+  set_test_name( "locate walks across faces" );
+
+  // row of four cubes along x
+  mesh( {{ {{0,0,0}}, {{1,0,0}}, {{2,0,0}}, {{3,0,0}} }} );
+  tk::CellLocator l( inpoel );
+
+  // the point is in the cell the walk starts from
+  std::array< tk::real, 4 > N;
+  std::size_t e = 5;
+  int face = 0;
+  auto p = centroid( 5 );
+  ensure( "point not found in start cell",
+          l.locate( coord, inpoel, p, e, N, face ) );
+  ensure_equals( "cell of point in start cell", e, 5UL );
+  ensure_equals( "boundary face of point in start cell", face, -1 );
+
+  // walk from the first to each cell of the last cube
+  auto nelem = inpoel.size()/4;
+  for (std::size_t c=nelem-6; c<nelem; ++c) {
+    auto msg = "cell " + std::to_string(c);
+    p = centroid( c );
+    e = 0;
+    ensure( msg + " not found", l.locate( coord, inpoel, p, e, N, face ) );
+    ensure_equals( msg + " found in wrong cell", e, c );
+    ensure_equals( msg + ": walk reached chunk boundary", face, -1 );
+    interpolates( msg, p, e, N );
+  }
+  ensure( "bin grid generated by face walk", l.nbin()[0] == 0 );
+}
+
+//! Test that the face walk sets the face it leaves the chunk across
+template<> template<>
+void CellLocator_object::test< 2 >() {
+  set_test_name( "locate sets face at chunk boundary" );
+
+  // row of two cubes along x
+  mesh( {{ {{0,0,0}}, {{1,0,0}} }} );
+  tk::CellLocator l( inpoel );
+  auto esuel = tk::genEsuelTet( inpoel, tk::genEsup(inpoel,4) );
+
+  // point beyond the end of the row is not found and the walk stops at a
+  // boundary face of the chunk on the side of the point
+  std::array< tk::real, 4 > N;
+  std::size_t e = 0;
+  int face = -1;
+  ensure( "point outside of chunk found",
+          !l.locate( coord, inpoel, {{ 2.5, 0.4, 0.7 }}, e, N, face ) );
+  ensure( "face not set at chunk boundary", face >= 0 );
+  auto f = static_cast< std::size_t >( face );
+  ensure_equals( "face is not a chunk boundary face", esuel[f], -1 );
+  for (auto n : tk::lpofa[f%4])
+    ensure_equals( "boundary face node not at the end of the row",
+                   coord[0][ inpoel[(f/4)*4+n] ], 2.0, precision );
+}
+
+//! Test that the face walk resorts to the bin search in a non-convex chunk
+template<> template<>
+void CellLocator_object::test< 3 >() {
+  set_test_name( "locate falls back to search" );
+
+  // L-shaped chunk of three cubes, missing the cube at (0,1,0)
+  mesh( {{ {{0,0,0}}, {{1,0,0}}, {{1,1,0}} }} );
+  tk::CellLocator l( inpoel );
+
+  // point in the cube at (1,1,0) next to the missing cube, the walk from the
+  // cube at (0,0,0) heads into the missing cube and stops at the boundary
+  std::array< tk::real, 4 > N;
+  std::size_t e = 0;
+  int face = -1;
+  std::array< tk::real, 3 > p{{ 1.05, 1.9, 0.5 }};
+  ensure( "point not found", l.locate( coord, inpoel, p, e, N, face ) );
+  ensure( "face not set at chunk boundary", face >= 0 );
+  ensure( "cell of point not in cube at (1,1,0)", e >= 12 && e < 18 );
+  interpolates( "point found by search", p, e, N );
+  ensure( "bin grid not generated", l.nbin()[0] > 0 );
+}
+
+//! Test that the bin grid finds all cells and rejects points outside
+template<> template<>
+void CellLocator_object::test< 4 >() {
+  set_test_name( "search via bin grid" );
+
+  // L-shaped chunk of three cubes, missing the cube at (0,1,0)
+  mesh( {{ {{0,0,0}}, {{1,0,0}}, {{1,1,0}} }} );
+  tk::CellLocator l( inpoel );
+  l.bins( coord, inpoel );
+
+  // about as many bins as cells
+  auto nelem = inpoel.size()/4;
+  const auto& n = l.nbin();
+  ensure_equals( "number of bins", n[0]*n[1]*n[2], 8UL );
+
+  // all cells found at their centroids
+  std::array< tk::real, 4 > N;
+  for (std::size_t c=0; c<nelem; ++c) {
+    auto msg = "cell " + std::to_string(c);
+    auto p = centroid( c );
+    std::size_t e = nelem;
+    ensure( msg + " not found", l.search( coord, inpoel, p, e, N ) );
+    ensure_equals( msg + " found in wrong cell", e, c );
+    interpolates( msg, p, e, N );
+  }
+
+  // points in the last bins along the chunk boundary
+  std::size_t e = nelem;
+  ensure( "point at upper corner bin not found",
+          l.search( coord, inpoel, {{ 1.9, 1.95, 0.99 }}, e, N ) );
+  ensure( "point at upper corner bin in wrong cube", e >= 12 && e < 18 );
+
+  // points outside the bounding box and in the missing cube
+  ensure( "point below bounding box found",
+          !l.search( coord, inpoel, {{ 0.5, -0.5, 0.5 }}, e, N ) );
+  ensure( "point above bounding box found",
+          !l.search( coord, inpoel, {{ 0.5, 0.5, 1.5 }}, e, N ) );
+  ensure( "point in missing cube found",
+          !l.search( coord, inpoel, {{ 0.5, 1.5, 0.5 }}, e, N ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
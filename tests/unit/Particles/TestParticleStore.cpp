@@ -0,0 +1,271 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Particles/TestParticleStore.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Particles/ParticleStore.hpp
+  \details   Unit tests for Particles/ParticleStore.hpp. The last test is a
+    throughput benchmark of inserting, removing, and advancing particles. It
+    runs with a small number of particles by default, which can be changed by
+    setting the environment variable QUINOA_PARTICLESTORE_BENCHMARK, e.g., to
+    100000000, in which case the throughput is also printed.
+*/
+// *****************************************************************************
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Types.hpp"
+#include "Timer.hpp"
+#include "ParticleStore.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct ParticleStore_common {
+  //! Fill a particle store with particles whose first component is their id
+  //! \param[in] elp Mesh cells of the particles to append
+  //! \return Particle store with 3 components
+  tk::ParticleStore fill( const std::vector< std::size_t >& elp ) const {
+    tk::ParticleStore s( 3 );
+    for (std::size_t i=0; i<elp.size(); ++i) {
+      auto x = static_cast< tk::real >( i );
+      s.push_back( { x, 2.0*x, 3.0*x }, elp[i] );
+    }
+    return s;
+  }
+};
+
+//! Test group shortcuts
+using ParticleStore_group =
+  test_group< ParticleStore_common, MAX_TESTS_IN_GROUP >;
+using ParticleStore_object = ParticleStore_group::object;
+
+//! Define test group
+static ParticleStore_group ParticleStore( "Particles/ParticleStore" );
+
+//! Test definitions for group
+
+//! Test that appending particles keeps all particles while storage grows
+template<> template<>
+void ParticleStore_object::test< 1 >() {
+  set_test_name( "push_back growth" );
+
+  tk::ParticleStore s( 3, 5 );
+  ensure_equals( "initial size", s.size(), 5UL );
+  ensure_equals( "initial number of components", s.ncomp(), 3UL );
+
+  // append enough particles to grow the storage several times
+  const std::size_t n = 1000;
+  for (std::size_t i=0; i<n; ++i) {
+    auto x = static_cast< tk::real >( i );
+    s.push_back( { x, -x, 0.5*x }, i % 7 );
+  }
+  ensure_equals( "size after push_back", s.size(), n+5 );
+  ensure_equals( "live particles after push_back", s.nlive(), n+5 );
+
+  for (std::size_t i=0; i<5; ++i)
+    ensure_equals( "initial particle overwritten", s(i,0), 0.0, 0.0 );
+  for (std::size_t i=0; i<n; ++i) {
+    auto x = static_cast< tk::real >( i );
+    ensure_equals( "component 0 after growth", s(i+5,0), x, 0.0 );
+    ensure_equals( "component 1 after growth", s(i+5,1), -x, 0.0 );
+    ensure_equals( "component 2 after growth", s(i+5,2), 0.5*x, 0.0 );
+    ensure_equals( "cell after growth", s.elp(i+5), i % 7 );
+  }
+}
+
+//! Test that erasing an already erased particle is a no-op
+template<> template<>
+void ParticleStore_object::test< 2 >() {
+  set_test_name( "erase already erased" );
+
+  auto s = fill( { 0, 1, 2, 3 } );
+  s.erase( 2 );
+  s.erase( 2 );
+  ensure_equals( "size after erase", s.size(), 4UL );
+  ensure_equals( "live particles after double erase", s.nlive(), 3UL );
+  ensure( "particle not erased", s.dead(2) );
+  ensure_not( "wrong particle erased", s.dead(1) );
+
+  s.compact();
+  ensure_equals( "size after compact", s.size(), 3UL );
+  ensure_equals( "live particles after compact", s.nlive(), 3UL );
+}
+
+//! Test that compact() removes erased particles and sorts the rest by cell
+//!   stably
+template<> template<>
+void ParticleStore_object::test< 3 >() {
+  set_test_name( "compact stable per-cell ordering" );
+
+  const std::vector< std::size_t > elp{ 3, 1, 0, 3, 1, 2, 0, 3, 1, 0 };
+  auto s = fill( elp );
+  s.erase( 0 );
+  s.erase( 4 );
+  s.erase( 9 );
+  ensure( "store not fragmented", s.fragmented() );
+  s.compact();
+
+  ensure_equals( "size after compact", s.size(), 7UL );
+  ensure_equals( "live particles after compact", s.nlive(), 7UL );
+  ensure_not( "store fragmented after compact", s.fragmented() );
+
+  // expected particle ids grouped by cell in original order
+  const std::vector< std::size_t > id{ 2, 6, 1, 8, 5, 3, 7 };
+  for (std::size_t i=0; i<id.size(); ++i) {
+    auto x = static_cast< tk::real >( id[i] );
+    ensure_equals( "particle order after compact", s(i,0), x, 0.0 );
+    ensure_equals( "component moved incorrectly", s(i,2), 3.0*x, 0.0 );
+    ensure_equals( "cell order after compact", s.elp(i), elp[ id[i] ] );
+    ensure_not( "tombstone after compact", s.dead(i) );
+  }
+}
+
+//! Test that extract() and nlive() skip erased particles
+template<> template<>
+void ParticleStore_object::test< 4 >() {
+  set_test_name( "extract and nlive skip tombstones" );
+
+  auto s = fill( { 0, 0, 1, 1, 2 } );
+  s.erase( 1 );
+  s.erase( 4 );
+  ensure_equals( "live particles", s.nlive(), 3UL );
+
+  auto x = s.extract( 1 );
+  ensure_equals( "extracted size", x.size(), 3UL );
+  ensure_equals( "extracted component", x[0], 0.0, 0.0 );
+  ensure_equals( "extracted component", x[1], 4.0, 0.0 );
+  ensure_equals( "extracted component", x[2], 6.0, 0.0 );
+
+  // extract() of all particles erased
+  for (std::size_t i=0; i<s.size(); ++i) s.erase( i );
+  ensure_equals( "live particles after erasing all", s.nlive(), 0UL );
+  ensure( "extracted tombstones", s.extract( 0 ).empty() );
+}
+
+//! Test that a particle store survives a pack/unpack round trip
+template<> template<>
+void ParticleStore_object::test< 5 >() {
+  set_test_name( "pack/unpack round trip" );
+
+  auto s = fill( { 2, 0, 1, 2, 0 } );
+  s.erase( 3 );
+
+  PUP::sizer sizer;
+  sizer | s;
+  std::unique_ptr< char[] > buf( new char[ sizer.size() ] );
+  PUP::toMem packer( buf.get() );
+  packer | s;
+
+  tk::ParticleStore r;
+  PUP::fromMem unpacker( buf.get() );
+  unpacker | r;
+
+  ensure_equals( "size after round trip", r.size(), s.size() );
+  ensure_equals( "live particles after round trip", r.nlive(), s.nlive() );
+  ensure_equals( "components after round trip", r.ncomp(), s.ncomp() );
+  for (std::size_t i=0; i<s.size(); ++i) {
+    ensure_equals( "tombstone after round trip", r.dead(i), s.dead(i) );
+    ensure_equals( "cell after round trip", r.elp(i), s.elp(i) );
+    for (std::size_t c=0; c<s.ncomp(); ++c)
+      ensure_equals( "component after round trip", r(i,c), s(i,c), 0.0 );
+  }
+
+  // the erased particle must still be removed by compact() after unpacking
+  r.compact();
+  ensure_equals( "size after compact", r.size(), 4UL );
+}
+
+//! Benchmark inserting, removing, and advancing particles
+//! \details The number of particles is given by the environment variable
+//!   QUINOA_PARTICLESTORE_BENCHMARK, defaulting to a small number so that
+//!   the test is cheap. Particles are inserted one by one into cells, then
+//!   advanced over a number of steps. In each step 1% of the particles leave,
+//!   i.e., are erased, and the same number arrives, i.e., is appended, while
+//!   the store is compacted whenever it is fragmented.
+template<> template<>
+void ParticleStore_object::test< 6 >() {
+  set_test_name( "benchmark insert/remove/advance" );
+
+  std::size_t npar = 100000;
+  const char* env = std::getenv( "QUINOA_PARTICLESTORE_BENCHMARK" );
+  if (env) npar = std::stoul( env );
+  const std::size_t nstep = 10;
+  const std::size_t ncell = std::max< std::size_t >( npar/50, 1 );
+  const tk::real dt = 1.0e-3;
+
+  // linear congruential generator for cheap reproducible pseudo-randomness
+  uint64_t state = 12345;
+  auto rnd = [&](){
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state >> 33;
+  };
+
+  tk::ParticleStore s( 3 );
+
+  tk::Timer ti;
+  for (std::size_t i=0; i<npar; ++i) {
+    auto x = static_cast< tk::real >( rnd() % 1000 ) / 1000.0;
+    s.push_back( { x, 1.0-x, 0.5*x }, rnd() % ncell );
+  }
+  auto tinsert = ti.dsec();
+
+  tk::real tadvance = 0.0, tremove = 0.0;
+  std::size_t nremove = 0;
+  for (std::size_t n=0; n<nstep; ++n) {
+    // advance all live particles with a position-dependent velocity
+    tk::Timer ta;
+    for (std::size_t i=0; i<s.size(); ++i) {
+      if (s.dead(i)) continue;
+      auto x = s(i,0), y = s(i,1), z = s(i,2);
+      s(i,0) += dt * y;
+      s(i,1) -= dt * x;
+      s(i,2) += dt * (x - z);
+    }
+    tadvance += ta.dsec();
+
+    // remove 1% of the particles, append as many, compact if fragmented
+    tk::Timer tr;
+    auto nleave = s.nlive() / 100;
+    for (std::size_t k=0; k<nleave; ) {
+      auto i = rnd() % s.size();
+      if (!s.dead(i)) { s.erase( i ); ++k; }
+    }
+    for (std::size_t k=0; k<nleave; ++k)
+      s.push_back( { 0.5, 0.5, 0.5 }, k % ncell );
+    nremove += nleave;
+    if (s.fragmented()) s.compact();
+    tremove += tr.dsec();
+  }
+
+  ensure_equals( "number of particles changed", s.nlive(), npar );
+
+  if (env) {
+    auto mps = []( std::size_t n, tk::real t ){
+      return static_cast< tk::real >( n ) / std::max( t, 1.0e-12 ) / 1.0e6; };
+    std::cout << std::fixed << std::setprecision(1)
+      << "ParticleStore benchmark, " << npar << " particles:\n"
+      << "  insert:  " << mps( npar, tinsert ) << " M particles/s\n"
+      << "  advance: " << mps( npar*nstep, tadvance ) << " M particles/s\n"
+      << "  remove:  " << mps( 2*nremove, tremove )
+      << " M particles/s (erase, append, and compact)\n";
+  }
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -998,6 +998,22 @@ void RNGSSE_object::test< 78 >() {
   RNG_common::test_move_assignment( r );
 }
 
+//! \brief Test multi-variate Gaussian generator statistics from mrg32k3a using
+//!   multiple threads
+template<> template<>
+void RNGSSE_object::test< 79 >() {
+  set_test_name( "multi-variate Gaussian mrg32k3a from 4 emulated streams" );
+
+  tk::RNGSSE< mrg32k3a_state, unsigned long long, mrg32k3a_generate_ >
+    r( 4, mrg32k3a_init_sequence_ );
+
+  std::array< double, 3 > m3{{ 3.0, 5.0, 2.0 }};
+  std::array< double, 3*(3+1)/2 > c3{{ 16.0,  8.0,  4.0,
+                                             13.0, 17.0,
+                                                   62.0 }};
+  RNG_common::test_gaussianmv< 3 >( r, m3, c3 );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -10,6 +10,8 @@
 */
 // *****************************************************************************
 
+#include <vector>
+
 #include "NoWarning/tut.hpp"
 
 #include "NoWarning/threefry.hpp"
@@ -259,6 +261,109 @@ void Random123_object::test< 21 >() {
   RNG_common::test_move_assignment( r );
 }
 
+//! \brief Test multi-variate Gaussian generator statistics from threefry using
+//!   multiple threads
+template<> template<>
+void Random123_object::test< 22 >() {
+  set_test_name( "multi-variate Gaussian threefry from 4 emulated streams" );
+
+  tk::Random123< r123::Threefry2x64 > r( 4 );
+
+  std::array< double, 3 > m3{{ 3.0, 5.0, 2.0 }};
+  std::array< double, 3*(3+1)/2 > c3{{ 16.0,  8.0,  4.0,
+                                             13.0, 17.0,
+                                                   62.0 }};
+  RNG_common::test_gaussianmv< 3 >( r, m3, c3 );
+
+  std::array< double, 5 > m5{{ 1.0, -2.0, 3.4, 5.6, 2.3 }};
+  std::array< double, 5*(5+1)/2 > c5{{ 16.0, -8.0,  -2.0,  2.0,  1.3,
+                                              12.5, -1.0,  2.0, -0.3,
+                                                     8.5, -3.0, -1.0,
+                                                          18.0, -1.0,
+                                                                10.0 }};
+  RNG_common::test_gaussianmv< 5 >( r, m5, c5 );
+}
+
+//! \brief Test multi-variate Gaussian generator statistics from philox using
+//!   multiple threads
+template<> template<>
+void Random123_object::test< 23 >() {
+  set_test_name( "multi-variate Gaussian philox from 4 emulated streams" );
+
+  tk::Random123< r123::Philox2x64 > r( 4 );
+
+  std::array< double, 3 > m3{{ 3.0, 5.0, 2.0 }};
+  std::array< double, 3*(3+1)/2 > c3{{ 16.0,  8.0,  4.0,
+                                             13.0, 17.0,
+                                                   62.0 }};
+  RNG_common::test_gaussianmv< 3 >( r, m3, c3 );
+}
+
+//! \brief Test that numbers drawn for a particle do not depend on the stream
+//!   and local particle index used to draw them
+template<> template<>
+void Random123_object::test< 24 >() {
+  set_test_name( "per-particle streams independent of stream" );
+
+  tk::Random123< r123::Threefry2x64 > a( 2, 3 ), b( 1, 3 );
+
+  ensure_not( "positioned before enabled", a.particle( 0, 0, 0 ) );
+
+  // particle with global id 12 is local particle 2 of stream 1 of a, and local
+  // particle 12 of stream 0 of b
+  a.particles( 1, 10, 5 );
+  b.particles( 0, 0, 5 );
+
+  std::array< double, 4 > x, y;
+  ensure( "positioned", a.particle( 1, 2, 7 ) );
+  a.gaussian( 1, 4, x.data() );
+  ensure( "positioned", b.particle( 0, 12, 7 ) );
+  b.gaussian( 0, 4, y.data() );
+  ensure( "same numbers for same particle", x == y );
+
+  // the equation key selects a different sequence
+  b.particle( 0, 12, 8 );
+  b.gaussian( 0, 4, y.data() );
+  ensure( "different numbers for different equation", x != y );
+}
+
+//! \brief Test that the uniform numbers of a stream do not depend on the
+//!   number of numbers requested per call
+template<> template<>
+void Random123_object::test< 25 >() {
+  set_test_name( "uniform sequence independent of call size" );
+
+  // call sizes exercise leftover words, batched full blocks, and the rest
+  const std::vector< std::size_t > sizes{ 1, 2, 3, 64, 5, 1, 128, 7 };
+  std::size_t num = 0;
+  for (auto n : sizes) num += n;
+
+  tk::Random123< r123::Threefry2x64 > t1( 2, 7 ), tn( 2, 7 );
+  tk::Random123< r123::Philox2x64 > p1( 2, 7 ), pn( 2, 7 );
+
+  std::vector< double > a( num ), b( num ), c( num );
+  t1.uniform( 1, num, a.data() );
+  p1.uniform( 1, num, c.data() );
+  std::size_t i = 0;
+  for (auto n : sizes) {
+    // interleave draws from another stream to check streams are independent
+    double x;
+    tn.uniform( 0, 1, &x );
+    tn.uniform( 1, n, b.data() + i );
+    i += n;
+  }
+  ensure( "threefry sequence depends on call size", a == b );
+
+  i = 0;
+  for (auto n : sizes) {
+    double x;
+    pn.uniform( 0, 1, &x );
+    pn.uniform( 1, n, b.data() + i );
+    i += n;
+  }
+  ensure( "philox sequence depends on call size", c == b );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT